@@ -0,0 +1,517 @@
+//
+// Pool of worker processes running engine searches for the server.
+// The job queue and the result cache live in shared memory and are protected by a process-shared
+// mutex. Workers write a byte to a pipe after each search, so that the server's event loop wakes
+// up and collects the results without ever blocking. The mutex is robust and the server reaps the
+// workers that die, failing the search they held and forking a replacement.
+//
+
+#ifndef AWALEGAME_ANALYSIS_H
+#define AWALEGAME_ANALYSIS_H
+
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "game.h"
+#include "engine.h"
+
+#define ANALYSIS_MAX_WORKERS 16
+#define ANALYSIS_CACHE_SIZE 256
+#define ANALYSIS_QUEUE_SIZE 64
+#define ANALYSIS_DEFAULT_TIME_MS 1000
+#define ANALYSIS_MAX_TIME_MS 10000
+#define ANALYSIS_GRACE_MS 5000     // Added to the budget before a waiting request gives up
+#define ANALYSIS_TT_MB 64          // Per worker
+#define ANALYSIS_PV_LENGTH 16
+#define ANALYSIS_MAX_IN_FLIGHT 4   // Per connection, answered out of order as searches end
+
+typedef enum {
+    ANALYSIS_EMPTY,
+    ANALYSIS_PENDING,  // Queued or being searched
+    ANALYSIS_DONE
+} ANALYSIS_STATE;
+
+// A cached search, identified by the hash of its position and of the positions before it, which
+// the search scores repetitions against. Moves are slots from 0 to 11
+typedef struct {
+    uint64_t hash;      // hash_game, XOR ring_hash of the history
+    Game game;
+    RepetitionRing history;  // Positions before this one, count 0 if unknown
+    int time_ms;        // Budget the result was (or is being) searched with
+    ANALYSIS_STATE state;
+    int waiters;        // Requests waiting for this entry, which must not be evicted meanwhile
+    uint64_t last_used;
+    int move;
+    int score;          // For the player to move, in SCORE_PER_SEED units per seed
+    int depth;
+    uint64_t nodes;
+    int pv[ANALYSIS_PV_LENGTH];
+    int pv_length;
+} AnalysisEntry;
+
+// A worker process, its fields other than pid are written by the worker under the lock
+typedef struct {
+    pid_t pid;    // 0 if the slot has no process
+    bool ready;   // Its transposition table is allocated
+    int entry;    // Index of the entry it is searching, -1 if none
+} AnalysisWorker;
+
+// Shared between the server and the workers
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t work;  // Signalled when a job is queued
+    int notify[2];        // Pipe written by the workers when a search completes, non-blocking
+    int queue[ANALYSIS_QUEUE_SIZE];  // Indexes of pending entries
+    int queue_head;
+    int queue_count;
+    uint64_t clock;       // For least recently used eviction
+    int worker_count;     // Processes alive, only written by the server
+    AnalysisWorker workers[ANALYSIS_MAX_WORKERS];
+    AnalysisEntry entries[ANALYSIS_CACHE_SIZE];
+} AnalysisPool;
+
+// Result of an ANALYZE request
+typedef struct {
+    int move;
+    int score;
+    int depth;
+    uint64_t nodes;
+    int pv[ANALYSIS_PV_LENGTH];
+    int pv_length;
+    bool cached;  // Served without a new search
+} Analysis;
+
+// Pool used by the server, NULL if it could not be started
+AnalysisPool* analysis_pool = NULL;
+
+// Set by the SIGCHLD handler, which also writes to this pipe so that the event loop reaps the worker
+volatile sig_atomic_t analysis_exited = 0;
+int analysis_notify_fd = -1;
+
+// Locks the pool, taking over the lock of a worker that died holding it
+void analysis_lock(AnalysisPool* pool) {
+    if (pthread_mutex_lock(&pool->lock) == EOWNERDEAD) {
+        pthread_mutex_consistent(&pool->lock);
+    }
+}
+
+// Waits for a job with the lock held. A worker killed while waiting can swallow a signal, so the
+// wait gives up after a second and the caller checks the queue again
+void analysis_wait(AnalysisPool* pool) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec++;
+    if (pthread_cond_timedwait(&pool->work, &pool->lock, &deadline) == EOWNERDEAD) {
+        pthread_mutex_consistent(&pool->lock);
+    }
+}
+
+void analysis_on_exit(int signal) {
+    (void) signal;
+    int saved_errno = errno;
+    analysis_exited = 1;
+    char byte = 0;
+    if (analysis_notify_fd >= 0 && write(analysis_notify_fd, &byte, 1) < 0) {
+        // Full, the server wakes up anyway
+    }
+    errno = saved_errno;
+}
+
+// Closes what a worker inherited from the server but the pipes it writes to, so that a client
+// socket closed by the server is not kept open by a worker forked while it was connected
+void analysis_close_inherited(AnalysisPool* pool, int ready_fd) {
+    DIR* dir = opendir("/proc/self/fd");
+    if (!dir) return;
+    struct dirent* file;
+    while ((file = readdir(dir)) != NULL) {
+        int fd = atoi(file->d_name);
+        if (fd > STDERR_FILENO && fd != dirfd(dir) && fd != pool->notify[1] && fd != ready_fd) {
+            close(fd);
+        }
+    }
+    closedir(dir);
+}
+
+/**
+ * @brief Worker process: searches queued positions until the server dies.
+ *
+ * @param pool The pool.
+ * @param slot Its index in pool->workers.
+ * @param ready_fd Pipe to write a byte to once the worker can search, -1 if nobody waits for it.
+ */
+void analysis_worker_main(AnalysisPool* pool, int slot, int ready_fd) {
+    prctl(PR_SET_PDEATHSIG, SIGTERM);
+    analysis_close_inherited(pool, ready_fd);
+
+    TransTable tt;
+    if (tt_init(&tt, ANALYSIS_TT_MB, true)) {
+        exit(1);
+    }
+
+    AnalysisWorker* worker = &pool->workers[slot];
+    analysis_lock(pool);
+    worker->ready = true;
+    if (ready_fd >= 0) {
+        char byte = 0;
+        if (write(ready_fd, &byte, 1) < 0) {
+            perror("Error reporting an analysis worker ready");
+        }
+        close(ready_fd);
+    }
+    while (true) {
+        while (pool->queue_count == 0) {
+            analysis_wait(pool);
+        }
+        int index = pool->queue[pool->queue_head];
+        pool->queue_head = (pool->queue_head + 1) % ANALYSIS_QUEUE_SIZE;
+        pool->queue_count--;
+        worker->entry = index;
+
+        AnalysisEntry* entry = &pool->entries[index];
+        Game game = entry->game;
+        RepetitionRing history = entry->history;
+        SearchLimits limits = {.depth = 0, .time_ms = entry->time_ms, .nodes = 0, .history = &history};
+        pthread_mutex_unlock(&pool->lock);
+
+        SearchResult result;
+        int error = engine_search(&game, &limits, &tt, &result);
+
+        analysis_lock(pool);
+        worker->entry = -1;
+        entry->move = error ? -1 : result.move;
+        entry->score = error ? 0 : result.score;
+        entry->depth = error ? 0 : result.depth;
+        entry->nodes = error ? 0 : result.nodes;
+        entry->pv_length = 0;
+        for (int i = 0; !error && i < result.pv_length && i < ANALYSIS_PV_LENGTH; i++) {
+            entry->pv[entry->pv_length++] = result.pv[i];
+        }
+        entry->state = ANALYSIS_DONE;
+        char byte = 0;
+        if (write(pool->notify[1], &byte, 1) < 0 && errno != EAGAIN) {
+            perror("Error notifying the server");
+        }
+    }
+}
+
+// Forks the worker of a slot, 0 on success
+int analysis_spawn(AnalysisPool* pool, int slot, int ready_fd) {
+    AnalysisWorker* worker = &pool->workers[slot];
+    worker->ready = false;
+    worker->entry = -1;
+    fflush(NULL);  // The child must not write the server's buffered output again
+    pid_t pid = fork();
+    if (pid < 0) {
+        perror("Error forking an analysis worker");
+        return -1;
+    }
+    if (pid == 0) {
+        analysis_worker_main(pool, slot, ready_fd);
+        exit(0);
+    }
+    worker->pid = pid;
+    pool->worker_count++;
+    return 0;
+}
+
+// Stops the workers of a pool that could not start and releases it
+void analysis_stop(AnalysisPool* pool) {
+    analysis_notify_fd = -1;
+    analysis_exited = 0;
+    signal(SIGCHLD, SIG_DFL);
+    for (int i = 0; i < ANALYSIS_MAX_WORKERS; i++) {
+        if (pool->workers[i].pid > 0) {
+            kill(pool->workers[i].pid, SIGTERM);
+            waitpid(pool->workers[i].pid, NULL, 0);
+        }
+    }
+    close(pool->notify[0]);
+    close(pool->notify[1]);
+    munmap(pool, sizeof(AnalysisPool));
+}
+
+/**
+ * @brief Creates the shared pool and forks its worker processes.
+ *
+ * @param workers Number of worker processes, from 1 to ANALYSIS_MAX_WORKERS.
+ *
+ * @return AnalysisPool* The pool, or NULL on failure. init_engine must have been called.
+ */
+AnalysisPool* analysis_start(int workers) {
+    if (workers < 1) workers = 1;
+    if (workers > ANALYSIS_MAX_WORKERS) workers = ANALYSIS_MAX_WORKERS;
+
+    AnalysisPool* pool = mmap(NULL, sizeof(AnalysisPool), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (pool == MAP_FAILED) {
+        perror("Error mapping the analysis pool");
+        return NULL;
+    }
+    memset(pool, 0, sizeof(AnalysisPool));
+
+    pthread_mutexattr_t mutex_attr;
+    pthread_mutexattr_init(&mutex_attr);
+    pthread_mutexattr_setpshared(&mutex_attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&mutex_attr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&pool->lock, &mutex_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setpshared(&cond_attr, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&pool->work, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+
+    // A full pipe already wakes the server up, so the workers never block on it either
+    if (pipe(pool->notify)) {
+        perror("Error creating the analysis pipe");
+        munmap(pool, sizeof(AnalysisPool));
+        return NULL;
+    }
+    for (int i = 0; i < 2; i++) {
+        fcntl(pool->notify[i], F_SETFL, fcntl(pool->notify[i], F_GETFL) | O_NONBLOCK);
+    }
+
+    analysis_notify_fd = pool->notify[1];
+    struct sigaction action = {.sa_handler = analysis_on_exit, .sa_flags = SA_RESTART | SA_NOCLDSTOP};
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGCHLD, &action, NULL);
+
+    // Each worker writes a byte once its table is allocated, the read ends when all have written or exited
+    int ready[2];
+    if (pipe(ready)) {
+        perror("Error creating the analysis pipe");
+        analysis_stop(pool);
+        return NULL;
+    }
+    for (int i = 0; i < workers; i++) {
+        if (analysis_spawn(pool, i, ready[1])) {
+            break;
+        }
+    }
+    close(ready[1]);
+    int started = 0;
+    char bytes[ANALYSIS_MAX_WORKERS];
+    ssize_t length;
+    while ((length = read(ready[0], bytes, sizeof(bytes))) > 0 || (length < 0 && errno == EINTR)) {
+        if (length > 0) started += (int) length;
+    }
+    close(ready[0]);
+
+    if (pool->worker_count == 0 || started < pool->worker_count) {
+        fprintf(stderr, "Error: %d of %d analysis workers started\n", started, workers);
+        analysis_stop(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+/**
+ * @brief Reaps the workers that exited and forks their replacements.
+ *
+ * @details The requests waiting for the search a dead worker held fail at once, and a later
+ * request for the position searches it again. A worker that died before being ready is not
+ * replaced, it would fail again.
+ *
+ * @param pool The pool.
+ */
+void analysis_reap(AnalysisPool* pool) {
+    analysis_exited = 0;
+    pid_t pid;
+    int status;
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+        int slot = -1;
+        for (int i = 0; i < ANALYSIS_MAX_WORKERS; i++) {
+            if (pool->workers[i].pid == pid) {
+                slot = i;
+                break;
+            }
+        }
+        if (slot < 0) continue;
+
+        AnalysisWorker* worker = &pool->workers[slot];
+        analysis_lock(pool);
+        bool ready = worker->ready;
+        if (worker->entry >= 0 && pool->entries[worker->entry].state == ANALYSIS_PENDING) {
+            AnalysisEntry* entry = &pool->entries[worker->entry];
+            if (entry->waiters > 0) {
+                entry->move = -1;
+                entry->time_ms = 0;
+                entry->pv_length = 0;
+                entry->state = ANALYSIS_DONE;
+            } else {
+                entry->state = ANALYSIS_EMPTY;
+            }
+        }
+        worker->entry = -1;
+        pthread_mutex_unlock(&pool->lock);
+        worker->pid = 0;
+        pool->worker_count--;
+
+        fprintf(stderr, "Error: Analysis worker %d exited with status %d\n", pid, status);
+        if (ready && analysis_spawn(pool, slot, -1) == 0) {
+            printf("Analysis worker %d replaced by %d\n", pid, worker->pid);
+        }
+    }
+}
+
+// Entry to reuse for a new position: an empty one, or the least recently used finished one. -1 if none
+int analysis_evict(AnalysisPool* pool) {
+    int victim = -1;
+    for (int i = 0; i < ANALYSIS_CACHE_SIZE; i++) {
+        AnalysisEntry* entry = &pool->entries[i];
+        if (entry->state == ANALYSIS_EMPTY) {
+            return i;
+        }
+        if (entry->state == ANALYSIS_DONE && entry->waiters == 0 &&
+            (victim < 0 || entry->last_used < pool->entries[victim].last_used)) {
+            victim = i;
+        }
+    }
+    return victim;
+}
+
+// Copies a finished entry into a result, -1 if its search failed
+int analysis_copy(AnalysisPool* pool, AnalysisEntry* entry, bool cached, Analysis* analysis) {
+    entry->last_used = ++pool->clock;
+    analysis->move = entry->move;
+    analysis->score = entry->score;
+    analysis->depth = entry->depth;
+    analysis->nodes = entry->nodes;
+    analysis->pv_length = entry->pv_length;
+    memcpy(analysis->pv, entry->pv, sizeof(int) * entry->pv_length);
+    analysis->cached = cached;
+    return entry->move >= 0 ? 0 : -1;
+}
+
+/**
+ * @brief Submits a position to the worker pool, sharing results between identical requests.
+ *
+ * @details A finished search of the same position and history with at least the same budget
+ * is returned at once. If one is already running, the caller waits for it instead of starting
+ * another, so that many spectators asking about the same position cost a single search. A pending
+ * request must end with analysis_collect returning 1 or with analysis_cancel.
+ *
+ * @param pool The pool.
+ * @param game The position, its player to move must have a move.
+ * @param history Positions played before it, for repetitions. Can be NULL.
+ * @param time_ms Search budget, clamped to ANALYSIS_MAX_TIME_MS.
+ * @param analysis Filled with the result when it is ready.
+ * @param index Set to the entry to collect when the request is pending.
+ *
+ * @return int 1 if the result is ready, 0 if it is pending, or -1 if the pool is full or the search failed.
+ */
+int analysis_submit(AnalysisPool* pool, const Game* game, const RepetitionRing* history, int time_ms, Analysis* analysis, int* index) {
+    if (time_ms <= 0) time_ms = ANALYSIS_DEFAULT_TIME_MS;
+    if (time_ms > ANALYSIS_MAX_TIME_MS) time_ms = ANALYSIS_MAX_TIME_MS;
+    if (pool->worker_count == 0) {
+        fprintf(stderr, "Error: No analysis worker is left\n");
+        return -1;
+    }
+
+    uint64_t hash = hash_game(game) ^ (history ? ring_hash(history) : 0);
+    int result = -1;
+    analysis_lock(pool);
+    int found = -1;
+    for (int i = 0; i < ANALYSIS_CACHE_SIZE; i++) {
+        if (pool->entries[i].state != ANALYSIS_EMPTY && pool->entries[i].hash == hash) {
+            found = i;
+            break;
+        }
+    }
+    AnalysisEntry* entry = found >= 0 ? &pool->entries[found] : NULL;
+
+    if (entry && entry->state == ANALYSIS_DONE && entry->time_ms >= time_ms) {
+        result = analysis_copy(pool, entry, true, analysis) ? -1 : 1;
+    } else if (entry && entry->state == ANALYSIS_PENDING) {
+        // Wait for the running search, analysis_collect searches again if its budget was smaller
+        entry->waiters++;
+        *index = found;
+        result = 0;
+    } else {
+        // Not cached, or cached with a smaller budget: queue a new search
+        if (!entry) {
+            found = analysis_evict(pool);
+        }
+        if (found < 0 || pool->queue_count == ANALYSIS_QUEUE_SIZE) {
+            fprintf(stderr, "Error: Analysis pool is full\n");
+        } else {
+            entry = &pool->entries[found];
+            entry->hash = hash;
+            entry->game = *game;
+            if (history) {
+                entry->history = *history;
+            } else {
+                ring_clear(&entry->history);
+            }
+            entry->time_ms = time_ms;
+            entry->state = ANALYSIS_PENDING;
+            entry->waiters++;  // Earlier waiters of a re-searched entry get the new result
+            entry->last_used = ++pool->clock;
+            pool->queue[(pool->queue_head + pool->queue_count) % ANALYSIS_QUEUE_SIZE] = found;
+            pool->queue_count++;
+            pthread_cond_signal(&pool->work);
+            *index = found;
+            result = 0;
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return result;
+}
+
+/**
+ * @brief Checks whether a pending request has its result.
+ *
+ * @param pool The pool.
+ * @param index The entry given by analysis_submit, updated if the position is searched again.
+ * @param time_ms Budget of the request, a search that ended with a smaller one is run again.
+ * @param analysis Filled with the result when it is ready.
+ *
+ * @return int 1 if the result is ready, 0 if still pending, or -1 if the search failed (the
+ * request is over in both of these last cases).
+ */
+int analysis_collect(AnalysisPool* pool, int* index, int time_ms, Analysis* analysis) {
+    analysis_lock(pool);
+    AnalysisEntry* entry = &pool->entries[*index];
+    if (entry->state != ANALYSIS_DONE) {
+        pthread_mutex_unlock(&pool->lock);
+        return 0;
+    }
+    entry->waiters--;
+    if (entry->time_ms >= time_ms || entry->move < 0) {
+        int result = analysis_copy(pool, entry, false, analysis) ? -1 : 1;
+        pthread_mutex_unlock(&pool->lock);
+        return result;
+    }
+    Game game = entry->game;
+    RepetitionRing history = entry->history;
+    pthread_mutex_unlock(&pool->lock);
+    return analysis_submit(pool, &game, &history, time_ms, analysis, index);
+}
+
+// Gives up a pending request, its search still completes and stays cached
+void analysis_cancel(AnalysisPool* pool, int index) {
+    analysis_lock(pool);
+    pool->entries[index].waiters--;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Empties the notification pipe, to be called when its read end is readable, and reaps the
+// workers that exited
+void analysis_drain(AnalysisPool* pool) {
+    char bytes[64];
+    while (read(pool->notify[0], bytes, sizeof(bytes)) > 0) {
+    }
+    if (analysis_exited) {
+        analysis_reap(pool);
+    }
+}
+
+#endif //AWALEGAME_ANALYSIS_H
@@ -0,0 +1,559 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "game.h"
+#include "engine.h"
+
+#define AUDIT_BATCH 256            // Games per task
+#define AUDIT_DEQUE_SIZE 16        // Tasks queued per worker, bounds memory whatever the store size
+#define AUDIT_MAX_THREADS 256
+#define AUDIT_OUTPUT_SIZE 65536    // Report buffer per worker, flushed after each task
+#define AUDIT_TT_MB 16
+#define AUDIT_ENGINE_MIN_MOVES 20  // Moves a player needs before their play is compared with the engine
+#define AUDIT_ENGINE_MATCH 0.95    // Share of engine moves above which a player is flagged
+#define AUDIT_RELEASE_TASKS 64     // Tasks pushed between two releases of the audited part of the store
+
+// A game object inside the mapped store
+typedef struct {
+    const char* start;
+    size_t length;
+    long index;
+} GameSpan;
+
+typedef struct {
+    GameSpan games[AUDIT_BATCH];
+    int count;
+} AuditTask;
+
+// Tasks of one worker. The owner takes from the front, thieves from the back
+typedef struct {
+    pthread_mutex_t lock;
+    AuditTask tasks[AUDIT_DEQUE_SIZE];
+    int head;
+    int count;
+} TaskDeque;
+
+typedef struct Auditor Auditor;
+
+typedef struct {
+    Auditor* auditor;
+    int id;
+    TaskDeque deque;
+    _Atomic(const char*) current;  // Start of the task being audited, NULL if none
+    TransTable tt;
+    MoveHistory history;
+    char output[AUDIT_OUTPUT_SIZE];
+    size_t output_length;
+    long games;
+    long findings;
+    long replayed;
+    pthread_t thread;
+} AuditWorker;
+
+struct Auditor {
+    AuditWorker* workers;
+    int worker_count;
+    int depth;                   // Engine depth for the play check, 0 to skip it
+    pthread_mutex_t lock;        // For sleeping workers and the producer
+    pthread_cond_t work;         // Signalled when a task is pushed
+    pthread_cond_t space;        // Signalled when a task is taken
+    _Atomic bool finished;       // No more tasks will be pushed
+    pthread_mutex_t output_lock;
+};
+
+// Take the front task of a deque, or the back one when stealing, and mark it as current. Returns false if it is empty
+bool deque_take(TaskDeque* deque, bool steal, AuditTask* task, _Atomic(const char*)* current) {
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count == 0) {
+        pthread_mutex_unlock(&deque->lock);
+        return false;
+    }
+    if (steal) {
+        *task = deque->tasks[(deque->head + deque->count - 1) % AUDIT_DEQUE_SIZE];
+    } else {
+        *task = deque->tasks[deque->head];
+        deque->head = (deque->head + 1) % AUDIT_DEQUE_SIZE;
+    }
+    deque->count--;
+    atomic_store(current, task->games[0].start);
+    pthread_mutex_unlock(&deque->lock);
+    return true;
+}
+
+// Append a task to a deque, returns false if it is full
+bool deque_push(TaskDeque* deque, const AuditTask* task) {
+    pthread_mutex_lock(&deque->lock);
+    if (deque->count == AUDIT_DEQUE_SIZE) {
+        pthread_mutex_unlock(&deque->lock);
+        return false;
+    }
+    deque->tasks[(deque->head + deque->count) % AUDIT_DEQUE_SIZE] = *task;
+    deque->count++;
+    pthread_mutex_unlock(&deque->lock);
+    return true;
+}
+
+// Write the worker's report lines out
+void flush_output(AuditWorker* worker) {
+    if (worker->output_length == 0) return;
+    pthread_mutex_lock(&worker->auditor->output_lock);
+    fwrite(worker->output, 1, worker->output_length, stdout);
+    pthread_mutex_unlock(&worker->auditor->output_lock);
+    worker->output_length = 0;
+}
+
+/**
+ * @brief Adds one line to the report, as a JSON object.
+ *
+ * @param worker The calling worker.
+ * @param index Index of the game in the store.
+ * @param game The game, for the player names.
+ * @param issue Short name of the finding.
+ * @param detail Free text, must not need escaping.
+ */
+void report(AuditWorker* worker, long index, const Game* game, const char* issue, const char* detail) {
+    if (worker->output_length > AUDIT_OUTPUT_SIZE - 512) {
+        flush_output(worker);
+    }
+
+    // Names come from the store, keep only characters that need no escaping
+    char names[2][MAX_NAME_LENGTH + 1];
+    const char* sources[2] = {game->player0, game->player1};
+    for (int p = 0; p < 2; p++) {
+        int length = 0;
+        for (const char* c = sources[p]; *c && length < MAX_NAME_LENGTH; c++) {
+            names[p][length++] = (*c == '"' || *c == '\\' || (unsigned char) *c < 0x20) ? '?' : *c;
+        }
+        names[p][length] = '\0';
+    }
+
+    worker->output_length += snprintf(worker->output + worker->output_length, AUDIT_OUTPUT_SIZE - worker->output_length,
+                                      "{\"game\":%ld,\"player0\":\"%s\",\"player1\":\"%s\",\"issue\":\"%s\",\"detail\":\"%s\"}\n",
+                                      index, names[0], names[1], issue, detail);
+    worker->findings++;
+}
+
+// Compare each move of the game with the engine's choice, flag players who always agree with it
+void check_play(AuditWorker* worker, long index, const Game* game, const MoveHistory* history) {
+    Game position;
+    init_game(&position, game->player0, game->player1);
+    int moves[2] = {0, 0};
+    int matches[2] = {0, 0};
+
+    for (int ply = 0; ply < history->count; ply++) {
+        int side = position.current_state;
+        int legal[6];
+        if (list_moves(&position, legal) > 1) {
+            SearchLimits limits = {.depth = worker->auditor->depth, .time_ms = 0, .nodes = 0, .history = NULL};
+            SearchResult result;
+            if (engine_search(&position, &limits, &worker->tt, &result) == 0) {
+                moves[side]++;
+                matches[side] += result.move == history->slots[ply];
+            }
+        }
+
+        MoveUndo undo;
+        if (make_move(&position, history->slots[ply], &undo)) {
+            break;
+        }
+    }
+
+    for (int side = 0; side < 2; side++) {
+        if (moves[side] >= AUDIT_ENGINE_MIN_MOVES && matches[side] >= AUDIT_ENGINE_MATCH * moves[side]) {
+            char detail[96];
+            snprintf(detail, sizeof(detail), "player%d played the depth %d move %d times out of %d",
+                     side, worker->auditor->depth, matches[side], moves[side]);
+            report(worker, index, game, "engine_like", detail);
+        }
+    }
+}
+
+// Run every check on one stored game
+void audit_game(AuditWorker* worker, const GameSpan* span) {
+    worker->games++;
+
+    Game game;
+    memset(&game, 0, sizeof(Game));
+    cJSON* json = cJSON_ParseWithLength(span->start, span->length);
+    if (!json || parse_game(json, &game, &worker->history)) {
+        report(worker, span->index, &game, "unreadable", "not a game object");
+        cJSON_Delete(json);
+        return;
+    }
+    cJSON_Delete(json);
+
+    char detail[128];
+    if (game.current_state < MOVE_PLAYER_0 || game.current_state > DRAW) {
+        snprintf(detail, sizeof(detail), "state %d", game.current_state);
+        report(worker, span->index, &game, "invalid_state", detail);
+        return;
+    }
+
+    int seeds = game.score.player0 + game.score.player1;
+    bool valid = game.score.player0 >= 0 && game.score.player1 >= 0;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        valid = valid && game.board[i] >= 0;
+        seeds += game.board[i];
+    }
+    if (!valid || seeds > 48) {
+        snprintf(detail, sizeof(detail), "%d seeds in play or captured", seeds);
+        report(worker, span->index, &game, "invalid_board", detail);
+        return;
+    }
+
+    const MoveHistory* history = &worker->history;
+    if (!history->complete) {
+        return;  // Stored before moves were recorded, nothing to replay
+    }
+    worker->replayed++;
+
+    // Replay the recorded moves and compare with the stored position
+    Game replay;
+    init_game(&replay, game.player0, game.player1);
+    RepetitionRing ring;
+    ring_clear(&ring);
+    ring_push(&ring, hash_game(&replay));
+    bool adjudicated = false;
+    for (int ply = 0; ply < history->count; ply++) {
+        int slot = history->slots[ply];
+        if (replay.current_state != MOVE_PLAYER_0 && replay.current_state != MOVE_PLAYER_1) {
+            snprintf(detail, sizeof(detail), "%d moves recorded after the end at ply %d", history->count - ply, ply);
+            report(worker, span->index, &game, "moves_after_end", detail);
+            return;
+        }
+        if (slot / 6 != (int) replay.current_state || replay.board[slot] == 0) {
+            snprintf(detail, sizeof(detail), "slot %d at ply %d", slot + 1, ply);
+            report(worker, span->index, &game, "illegal_move", detail);
+            return;
+        }
+
+        // The server may have used a tablebase to adjudicate, any result is accepted after a repetition
+        adjudicated = play_turn_tracked(&replay, slot, &ring, NULL) == 2;
+    }
+
+    if (memcmp(replay.board, game.board, sizeof(game.board)) != 0 ||
+        replay.score.player0 != game.score.player0 || replay.score.player1 != game.score.player1) {
+        snprintf(detail, sizeof(detail), "stored score %d-%d, replayed %d-%d",
+                 game.score.player0, game.score.player1, replay.score.player0, replay.score.player1);
+        report(worker, span->index, &game, "replay_mismatch", detail);
+    } else if (replay.current_state != game.current_state && !(adjudicated && game.current_state >= WIN_PLAYER_0) &&
+               !(replay.current_state == MOVE_PLAYER_0 && game.current_state == WIN_PLAYER_1) &&
+               !(replay.current_state == MOVE_PLAYER_1 && game.current_state == WIN_PLAYER_0)) {
+        // Anything but a surrender by the player to move
+        snprintf(detail, sizeof(detail), "stored state %d, replayed %d", game.current_state, replay.current_state);
+        report(worker, span->index, &game, "result_mismatch", detail);
+    }
+
+    if (worker->auditor->depth > 0) {
+        check_play(worker, span->index, &game, history);
+    }
+}
+
+// Own tasks first, then tasks stolen from the other workers
+bool find_task(AuditWorker* worker, AuditTask* task) {
+    if (deque_take(&worker->deque, false, task, &worker->current)) {
+        return true;
+    }
+    Auditor* auditor = worker->auditor;
+    for (int i = 1; i < auditor->worker_count; i++) {
+        AuditWorker* victim = &auditor->workers[(worker->id + i) % auditor->worker_count];
+        if (deque_take(&victim->deque, true, task, &worker->current)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void* audit_worker_main(void* arg) {
+    AuditWorker* worker = arg;
+    Auditor* auditor = worker->auditor;
+    AuditTask* task = malloc(sizeof(AuditTask));
+    if (!task) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return NULL;
+    }
+
+    while (true) {
+        // Tasks are only pushed with the lock held, so checking again under it cannot miss a wake up
+        bool found = find_task(worker, task);
+        if (!found) {
+            pthread_mutex_lock(&auditor->lock);
+            while (!(found = find_task(worker, task)) && !atomic_load(&auditor->finished)) {
+                pthread_cond_wait(&auditor->work, &auditor->lock);
+            }
+            pthread_mutex_unlock(&auditor->lock);
+            if (!found) break;
+        }
+
+        pthread_mutex_lock(&auditor->lock);
+        pthread_cond_signal(&auditor->space);
+        pthread_mutex_unlock(&auditor->lock);
+
+        for (int i = 0; i < task->count; i++) {
+            audit_game(worker, &task->games[i]);
+        }
+        flush_output(worker);
+        atomic_store(&worker->current, NULL);
+    }
+
+    free(task);
+    return NULL;
+}
+
+const char* skip_whitespace(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) p++;
+    return p;
+}
+
+// Skip a JSON value starting at p, returns the first character after it or NULL if it is malformed
+const char* skip_value(const char* p, const char* end) {
+    if (p >= end) return NULL;
+
+    if (*p == '"') {
+        for (p++; p < end; p++) {
+            if (*p == '\\') p++;
+            else if (*p == '"') return p + 1;
+        }
+        return NULL;
+    }
+
+    if (*p == '{' || *p == '[') {
+        int depth = 0;
+        for (; p < end; p++) {
+            if (*p == '"') {
+                p = skip_value(p, end);
+                if (!p) return NULL;
+                p--;
+            } else if (*p == '{' || *p == '[') {
+                depth++;
+            } else if (*p == '}' || *p == ']') {
+                if (--depth == 0) return p + 1;
+            }
+        }
+        return NULL;
+    }
+
+    while (p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\n' && *p != '\r' && *p != '\t') p++;
+    return p;
+}
+
+// Position just after the '[' of the top level "games" array, or NULL if there is none
+const char* find_games(const char* p, const char* end) {
+    p = skip_whitespace(p, end);
+    if (p >= end || *p != '{') return NULL;
+    p++;
+
+    while (true) {
+        p = skip_whitespace(p, end);
+        if (p >= end || *p != '"') return NULL;
+        const char* key = p + 1;
+        p = skip_value(p, end);
+        if (!p) return NULL;
+        bool is_games = p - key - 1 == 5 && strncmp(key, "games", 5) == 0;
+
+        p = skip_whitespace(p, end);
+        if (p >= end || *p != ':') return NULL;
+        p = skip_whitespace(p + 1, end);
+        if (is_games) {
+            return p < end && *p == '[' ? p + 1 : NULL;
+        }
+
+        p = skip_value(p, end);
+        if (!p) return NULL;
+        p = skip_whitespace(p, end);
+        if (p >= end || *p != ',') return NULL;
+        p++;
+    }
+}
+
+/**
+ * @brief Drops the pages of the store that every worker is done with, so that memory use does not grow with its size.
+ *
+ * @details A task is always queued or current while it is audited, and a worker marks a task as current
+ * before it leaves its deque, so nothing before the lowest of them is read again. Dropped pages would
+ * be read back from the file anyway, the mapping is private and read only.
+ */
+void release_audited(Auditor* auditor, const char* data, const char* scanned, const char** released) {
+    const char* low = scanned;
+    for (int i = 0; i < auditor->worker_count; i++) {
+        TaskDeque* deque = &auditor->workers[i].deque;
+        pthread_mutex_lock(&deque->lock);
+        for (int t = 0; t < deque->count; t++) {
+            const char* start = deque->tasks[(deque->head + t) % AUDIT_DEQUE_SIZE].games[0].start;
+            if (start < low) low = start;
+        }
+        pthread_mutex_unlock(&deque->lock);
+    }
+    for (int i = 0; i < auditor->worker_count; i++) {
+        const char* current = atomic_load(&auditor->workers[i].current);
+        if (current && current < low) low = current;
+    }
+
+    size_t page = (size_t) sysconf(_SC_PAGESIZE);
+    const char* until = data + (size_t) (low - data) / page * page;
+    if (until > *released) {
+        madvise((void*) *released, until - *released, MADV_DONTNEED);
+        *released = until;
+    }
+}
+
+// Hand a full task to the workers, waiting while every deque is full
+void push_task(Auditor* auditor, const AuditTask* task, int* next) {
+    pthread_mutex_lock(&auditor->lock);
+    while (true) {
+        for (int i = 0; i < auditor->worker_count; i++) {
+            int target = (*next + i) % auditor->worker_count;
+            if (deque_push(&auditor->workers[target].deque, task)) {
+                *next = (target + 1) % auditor->worker_count;
+                pthread_cond_broadcast(&auditor->work);
+                pthread_mutex_unlock(&auditor->lock);
+                return;
+            }
+        }
+        pthread_cond_wait(&auditor->space, &auditor->lock);
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* store = argc > 1 ? argv[1] : JSON_FILENAME;
+    int depth = argc > 2 ? atoi(argv[2]) : 0;
+    long threads = argc > 3 ? atol(argv[3]) : sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (depth < 0 || depth >= ENGINE_MAX_PLY || threads < 1) {
+        printf("Usage: awale_audit [store] [depth] [threads]\n");
+        exit(0);
+    }
+    if (threads > AUDIT_MAX_THREADS) threads = AUDIT_MAX_THREADS;
+
+    // The store is mapped rather than read so that only the pages being audited stay in memory
+    int fd = open(store, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0 || st.st_size == 0) {
+        fprintf(stderr, "Error: Could not open %s\n", store);
+        return 1;
+    }
+    const char* data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        perror("Error mapping the store");
+        return 1;
+    }
+    madvise((void*) data, st.st_size, MADV_SEQUENTIAL);
+    const char* end = data + st.st_size;
+
+    const char* p = find_games(data, end);
+    if (!p) {
+        fprintf(stderr, "Error: No games array in %s\n", store);
+        return 1;
+    }
+
+    init_engine();
+
+    Auditor auditor;
+    auditor.worker_count = (int) threads;
+    auditor.depth = depth;
+    atomic_init(&auditor.finished, false);
+    pthread_mutex_init(&auditor.lock, NULL);
+    pthread_mutex_init(&auditor.output_lock, NULL);
+    pthread_cond_init(&auditor.work, NULL);
+    pthread_cond_init(&auditor.space, NULL);
+    auditor.workers = calloc(threads, sizeof(AuditWorker));
+    if (!auditor.workers) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+
+    for (int i = 0; i < threads; i++) {
+        AuditWorker* worker = &auditor.workers[i];
+        worker->auditor = &auditor;
+        worker->id = i;
+        atomic_init(&worker->current, NULL);
+        pthread_mutex_init(&worker->deque.lock, NULL);
+        if (depth > 0 && tt_init(&worker->tt, AUDIT_TT_MB, false)) {
+            return 1;
+        }
+    }
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < threads; i++) {
+        pthread_create(&auditor.workers[i].thread, NULL, audit_worker_main, &auditor.workers[i]);
+    }
+
+    // Cut the games array into tasks as it is read
+    AuditTask* task = malloc(sizeof(AuditTask));
+    if (!task) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    task->count = 0;
+    long index = 0;
+    int next = 0;
+    long pushed = 0;
+    const char* released = data;
+    bool malformed = false;
+    while (true) {
+        p = skip_whitespace(p, end);
+        if (p >= end) {
+            malformed = true;
+            break;
+        }
+        if (*p == ']') break;
+
+        const char* value_end = skip_value(p, end);
+        if (!value_end) {
+            malformed = true;
+            break;
+        }
+        task->games[task->count].start = p;
+        task->games[task->count].length = value_end - p;
+        task->games[task->count].index = index++;
+        if (++task->count == AUDIT_BATCH) {
+            push_task(&auditor, task, &next);
+            task->count = 0;
+            if (++pushed % AUDIT_RELEASE_TASKS == 0) {
+                release_audited(&auditor, data, value_end, &released);
+            }
+        }
+
+        p = skip_whitespace(value_end, end);
+        if (p < end && *p == ',') p++;
+    }
+    if (task->count > 0) {
+        push_task(&auditor, task, &next);
+    }
+    free(task);
+
+    pthread_mutex_lock(&auditor.lock);
+    atomic_store(&auditor.finished, true);
+    pthread_cond_broadcast(&auditor.work);
+    pthread_mutex_unlock(&auditor.lock);
+
+    long games = 0, findings = 0, replayed = 0;
+    for (int i = 0; i < threads; i++) {
+        pthread_join(auditor.workers[i].thread, NULL);
+        games += auditor.workers[i].games;
+        findings += auditor.workers[i].findings;
+        replayed += auditor.workers[i].replayed;
+        tt_free(&auditor.workers[i].tt);
+    }
+    fflush(stdout);
+
+    double seconds = elapsed_ms(&start) / 1000.0;
+    fprintf(stderr, "%ld games (%ld replayed) in %.2f s on %ld threads: %.0f games/s, %ld findings\n",
+            games, replayed, seconds, threads, seconds > 0 ? games / seconds : 0.0, findings);
+    if (malformed) {
+        fprintf(stderr, "Error: %s is truncated or malformed after game %ld\n", store, index);
+    }
+
+    free(auditor.workers);
+    munmap((void*) data, st.st_size);
+    return malformed ? 1 : 0;
+}
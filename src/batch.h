@@ -0,0 +1,214 @@
+//
+// Applies one move to many boards at once, for self-play and rollouts.
+// Boards are stored pit by pit (one byte per board) so that a vector register holds the same
+// pit of BATCH_WIDTH boards. Uses AVX2 or SSE2 when the compiler targets them, play_turn otherwise.
+//
+
+#ifndef AWALEGAME_BATCH_H
+#define AWALEGAME_BATCH_H
+
+#include <stdint.h>
+
+#include "game.h"
+
+#define BATCH_WIDTH 32
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BATCH_KERNEL "avx2"
+#define BVEC_WIDTH 32
+typedef __m256i bvec;
+bvec bv_load(const uint8_t* p) { return _mm256_load_si256((const __m256i*) p); }
+void bv_store(uint8_t* p, bvec v) { _mm256_store_si256((__m256i*) p, v); }
+bvec bv_set(uint8_t x) { return _mm256_set1_epi8((char) x); }
+bvec bv_add(bvec a, bvec b) { return _mm256_add_epi8(a, b); }
+bvec bv_sub(bvec a, bvec b) { return _mm256_sub_epi8(a, b); }
+bvec bv_and(bvec a, bvec b) { return _mm256_and_si256(a, b); }
+bvec bv_or(bvec a, bvec b) { return _mm256_or_si256(a, b); }
+bvec bv_xor(bvec a, bvec b) { return _mm256_xor_si256(a, b); }
+bvec bv_andnot(bvec mask, bvec b) { return _mm256_andnot_si256(mask, b); }
+bvec bv_eq(bvec a, bvec b) { return _mm256_cmpeq_epi8(a, b); }
+bvec bv_max(bvec a, bvec b) { return _mm256_max_epu8(a, b); }
+bool bv_any(bvec mask) { return _mm256_movemask_epi8(mask) != 0; }
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define BATCH_KERNEL "sse2"
+#define BVEC_WIDTH 16
+typedef __m128i bvec;
+bvec bv_load(const uint8_t* p) { return _mm_load_si128((const __m128i*) p); }
+void bv_store(uint8_t* p, bvec v) { _mm_store_si128((__m128i*) p, v); }
+bvec bv_set(uint8_t x) { return _mm_set1_epi8((char) x); }
+bvec bv_add(bvec a, bvec b) { return _mm_add_epi8(a, b); }
+bvec bv_sub(bvec a, bvec b) { return _mm_sub_epi8(a, b); }
+bvec bv_and(bvec a, bvec b) { return _mm_and_si128(a, b); }
+bvec bv_or(bvec a, bvec b) { return _mm_or_si128(a, b); }
+bvec bv_xor(bvec a, bvec b) { return _mm_xor_si128(a, b); }
+bvec bv_andnot(bvec mask, bvec b) { return _mm_andnot_si128(mask, b); }
+bvec bv_eq(bvec a, bvec b) { return _mm_cmpeq_epi8(a, b); }
+bvec bv_max(bvec a, bvec b) { return _mm_max_epu8(a, b); }
+bool bv_any(bvec mask) { return _mm_movemask_epi8(mask) != 0; }
+#else
+#define BATCH_KERNEL "scalar"
+#endif
+
+// BATCH_WIDTH boards, pit by pit. Every pit and score must stay at most 48 (always true in a real game)
+// and batches must be 32-byte aligned (aligned_alloc when allocated on the heap)
+typedef struct {
+    _Alignas(32) uint8_t pits[BOARD_SIZE][BATCH_WIDTH];
+    _Alignas(32) uint8_t score0[BATCH_WIDTH];
+    _Alignas(32) uint8_t score1[BATCH_WIDTH];
+    _Alignas(32) uint8_t state[BATCH_WIDTH];  // MOVE_PLAYER_0 or MOVE_PLAYER_1
+} BoardBatch;
+
+// Copy the board of a game into a lane (names are not kept)
+void batch_load(BoardBatch* batch, int lane, const Game* game) {
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        batch->pits[i][lane] = (uint8_t) game->board[i];
+    }
+    batch->score0[lane] = (uint8_t) game->score.player0;
+    batch->score1[lane] = (uint8_t) game->score.player1;
+    batch->state[lane] = (uint8_t) game->current_state;
+}
+
+// Copy a lane back into a game, leaving its names untouched
+void batch_store(const BoardBatch* batch, int lane, Game* game) {
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        game->board[i] = batch->pits[i][lane];
+    }
+    game->score.player0 = batch->score0[lane];
+    game->score.player1 = batch->score1[lane];
+    game->current_state = (GAME_STATE) batch->state[lane];
+}
+
+// Reference path: play_turn on each lane. won[i] is set to play_turn's return value
+void batch_play_scalar(BoardBatch* batch, const uint8_t slots[BATCH_WIDTH], uint8_t won[BATCH_WIDTH]) {
+    Game game;
+    for (int lane = 0; lane < BATCH_WIDTH; lane++) {
+        batch_store(batch, lane, &game);
+        won[lane] = (uint8_t) play_turn(&game, slots[lane]);
+        batch_load(batch, lane, &game);
+    }
+}
+
+#ifdef BVEC_WIDTH
+
+// Unsigned a >= b, lanes set to 0xFF where true
+bvec bv_ge(bvec a, bvec b) { return bv_eq(bv_max(a, b), a); }
+
+// Lanes of a where mask is set, lanes of b elsewhere
+bvec bv_select(bvec mask, bvec a, bvec b) { return bv_or(bv_and(mask, a), bv_andnot(mask, b)); }
+
+// Value of pit index[lane] for every lane
+bvec bv_gather_pit(const BoardBatch* batch, int offset, bvec index) {
+    bvec value = bv_set(0);
+    for (int j = 0; j < BOARD_SIZE; j++) {
+        value = bv_or(value, bv_and(bv_eq(index, bv_set((uint8_t) j)), bv_load(&batch->pits[j][offset])));
+    }
+    return value;
+}
+
+/**
+ * @brief Same as play_turn on every lane of one vector, bit for bit.
+ *
+ * @details Sowing n seeds from slot s adds one seed per lap to every pit at distance 1 to 10
+ * that the lap reaches, never to the pit before s, and empties s (as move_pebbles does).
+ * The capture walk of compute_score is run for 12 steps at most, which is enough since it
+ * always stops on the emptied starting pit.
+ */
+void batch_play_vector(BoardBatch* batch, int offset, const uint8_t* slots, uint8_t* won) {
+    const bvec zero = bv_set(0);
+    const bvec ones = bv_set(0xFF);
+    const bvec one = bv_set(1);
+    const bvec twelve = bv_set(12);
+
+    bvec slot = bv_load(slots + offset);
+    bvec seeds = bv_gather_pit(batch, offset, slot);
+
+    // Sowing
+    for (int j = 0; j < BOARD_SIZE; j++) {
+        bvec distance = bv_sub(bv_set((uint8_t) (j + 12)), slot);
+        distance = bv_sub(distance, bv_and(bv_ge(distance, twelve), twelve));
+
+        bvec origin = bv_eq(distance, zero);
+        bvec sown = bv_andnot(bv_or(origin, bv_eq(distance, bv_set(11))), ones);
+        bvec added = zero;
+        for (int lap = 0; lap < 4; lap++) {
+            added = bv_sub(added, bv_ge(seeds, bv_add(distance, bv_set((uint8_t) (12 * lap)))));
+        }
+
+        bvec pit = bv_load(&batch->pits[j][offset]);
+        pit = bv_add(pit, bv_and(added, sown));
+        bv_store(&batch->pits[j][offset], bv_andnot(origin, pit));
+    }
+
+    // Last pit reached: (slot + seeds) % 12
+    bvec last = seeds;
+    for (int lap = 0; lap < 4; lap++) {
+        last = bv_sub(last, bv_and(bv_ge(last, twelve), twelve));
+    }
+    last = bv_add(last, slot);
+    last = bv_sub(last, bv_and(bv_ge(last, twelve), twelve));
+
+    // Victory if the opponent has no seeds left
+    bvec side0 = zero, side1 = zero;
+    for (int j = 0; j < 6; j++) {
+        side0 = bv_or(side0, bv_load(&batch->pits[j][offset]));
+        side1 = bv_or(side1, bv_load(&batch->pits[j + 6][offset]));
+    }
+    bvec mover1 = bv_eq(bv_load(batch->state + offset), one);
+    bvec playing = bv_andnot(bv_select(mover1, bv_eq(side0, zero), bv_eq(side1, zero)), ones);
+
+    // Capture walk
+    bvec score0 = bv_load(batch->score0 + offset);
+    bvec score1 = bv_load(batch->score1 + offset);
+    bvec active = playing;
+    for (int step = 0; step < BOARD_SIZE && bv_any(active); step++) {
+        bvec value = bv_gather_pit(batch, offset, last);
+        active = bv_and(active, bv_or(bv_eq(value, bv_set(2)), bv_eq(value, bv_set(3))));
+
+        bvec on_side1 = bv_ge(last, bv_set(6));
+        bvec capture = bv_and(active, bv_select(mover1, bv_andnot(on_side1, ones), on_side1));
+        bvec captured = bv_and(capture, value);
+        score0 = bv_add(score0, bv_andnot(mover1, captured));
+        score1 = bv_add(score1, bv_and(mover1, captured));
+
+        for (int j = 0; j < BOARD_SIZE; j++) {
+            bvec hit = bv_and(capture, bv_eq(last, bv_set((uint8_t) j)));
+            bv_store(&batch->pits[j][offset], bv_andnot(hit, bv_load(&batch->pits[j][offset])));
+        }
+
+        last = bv_select(bv_eq(last, zero), bv_set(11), bv_sub(last, one));
+    }
+    bv_store(batch->score0 + offset, score0);
+    bv_store(batch->score1 + offset, score1);
+
+    // Victory on score (player0's, as in play_turn), otherwise switch turn
+    bvec victory = bv_or(bv_andnot(playing, ones), bv_and(playing, bv_ge(score0, bv_set(25))));
+    bv_store(won + offset, bv_and(victory, one));
+    bv_store(batch->state + offset, bv_xor(bv_load(batch->state + offset), bv_andnot(victory, one)));
+}
+
+#endif
+
+/**
+ * @brief Plays one move on every board of a batch, same result as play_turn on each.
+ *
+ * @param batch The boards, updated in place. Their state must be MOVE_PLAYER_0 or MOVE_PLAYER_1.
+ * @param slots The slot (0 to 11) to play on each board.
+ * @param won Set to 1 for boards where the player who moved has won (the turn is then not switched).
+ */
+void batch_play(BoardBatch* batch, const uint8_t slots[BATCH_WIDTH], uint8_t won[BATCH_WIDTH]) {
+#ifdef BVEC_WIDTH
+    _Alignas(32) uint8_t aligned_slots[BATCH_WIDTH];
+    _Alignas(32) uint8_t aligned_won[BATCH_WIDTH];
+    memcpy(aligned_slots, slots, BATCH_WIDTH);
+    for (int offset = 0; offset < BATCH_WIDTH; offset += BVEC_WIDTH) {
+        batch_play_vector(batch, offset, aligned_slots, aligned_won);
+    }
+    memcpy(won, aligned_won, BATCH_WIDTH);
+#else
+    batch_play_scalar(batch, slots, won);
+#endif
+}
+
+#endif //AWALEGAME_BATCH_H
@@ -0,0 +1,895 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "utils.h"
+#include "game.h"
+#include "network.h"
+#include "engine.h"
+#include "mcts.h"
+#include "batch.h"
+
+#define SUITE_SIZE 8
+#define SUITE_SEED 2024
+
+// Fixed set of positions derived from init_game by playing random legal moves with a fixed seed
+int build_suite(Game suite[SUITE_SIZE]) {
+    uint64_t rng = SUITE_SEED;
+
+    for (int p = 0; p < SUITE_SIZE; p++) {
+        init_game(&suite[p], "bench0", "bench1");
+
+        // Position p is reached after 3 * p plies
+        for (int ply = 0; ply < 3 * p; ply++) {
+            int moves[6];
+            int count = list_moves(&suite[p], moves);
+            if (count == 0) break;
+
+            Game next = suite[p];
+            if (play_turn(&next, moves[zobrist_next(&rng) % count])) {
+                break;  // Keep the last position before the game ends
+            }
+            suite[p] = next;
+        }
+    }
+    return SUITE_SIZE;
+}
+
+// Compare node counts and time of a fixed depth search with and without the transposition table
+int bench_tt(int argc, char** argv) {
+    int depth = argc > 0 ? atoi(argv[0]) : 12;
+    bool huge_pages = argc > 1 && strcmp(argv[1], "huge") == 0;
+
+    Game suite[SUITE_SIZE];
+    build_suite(suite);
+
+    TransTable tt;
+    if (tt_init(&tt, 64, huge_pages)) {
+        return 1;
+    }
+    printf("Transposition table: %zu MiB, huge pages: %s\n", tt.bytes >> 20, tt.huge_pages ? "yes" : "no");
+    printf("Depth %d\n\n", depth);
+    printf("pos\tnodes (no tt)\tms (no tt)\tnodes (tt)\tms (tt)\tmove\n");
+
+    SearchLimits limits = {.depth = depth, .time_ms = 0, .nodes = 0, .history = NULL};
+    uint64_t total_plain = 0, total_tt = 0;
+    double ms_plain = 0, ms_tt = 0;
+
+    for (int p = 0; p < SUITE_SIZE; p++) {
+        SearchResult plain, cached;
+        tt_clear(&tt);
+        if (engine_search(&suite[p], &limits, NULL, &plain) || engine_search(&suite[p], &limits, &tt, &cached)) {
+            printf("%d\t(no move)\n", p);
+            continue;
+        }
+
+        printf("%d\t%llu\t%.1f\t%llu\t%.1f\t%d/%d\n", p,
+               (unsigned long long) plain.nodes, plain.elapsed_ms,
+               (unsigned long long) cached.nodes, cached.elapsed_ms,
+               plain.move + 1, cached.move + 1);
+
+        total_plain += plain.nodes;
+        total_tt += cached.nodes;
+        ms_plain += plain.elapsed_ms;
+        ms_tt += cached.elapsed_ms;
+    }
+
+    printf("\ntotal\t%llu\t%.1f\t%llu\t%.1f\n",
+           (unsigned long long) total_plain, ms_plain, (unsigned long long) total_tt, ms_tt);
+    if (total_plain > 0 && ms_plain > 0) {
+        printf("Nodes: -%.1f%%, time: -%.1f%%\n",
+               100.0 * (1.0 - (double) total_tt / (double) total_plain), 100.0 * (1.0 - ms_tt / ms_plain));
+    }
+
+    tt_free(&tt);
+    return 0;
+}
+
+// Time to reach a fixed depth on the position suite for 1 to max_threads threads, with a fresh table each time
+int bench_smp(int argc, char** argv) {
+    int depth = argc > 0 ? atoi(argv[0]) : 14;
+    int max_threads = argc > 1 ? atoi(argv[1]) : 32;
+
+    Game suite[SUITE_SIZE];
+    build_suite(suite);
+
+    TransTable tt;
+    if (tt_init(&tt, 256, true)) {
+        return 1;
+    }
+
+    printf("Depth %d, %zu MiB table\n\n", depth, tt.bytes >> 20);
+    printf("threads\tnodes\tms\tknps\tspeedup\n");
+
+    double base_ms = 0;
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        SearchLimits limits = {.depth = depth, .time_ms = 0, .nodes = 0, .history = NULL};
+        uint64_t nodes = 0;
+        double ms = 0;
+
+        for (int p = 0; p < SUITE_SIZE; p++) {
+            SearchResult result;
+            tt_clear(&tt);
+            if (engine_search_parallel(&suite[p], &limits, &tt, threads, &result) == 0) {
+                nodes += result.nodes;
+                ms += result.elapsed_ms;
+            }
+        }
+
+        if (threads == 1) {
+            base_ms = ms;
+        }
+        printf("%d\t%llu\t%.1f\t%.0f\t%.2f\n", threads, (unsigned long long) nodes, ms,
+               ms > 0 ? (double) nodes / ms : 0.0, ms > 0 ? base_ms / ms : 0.0);
+    }
+
+    tt_free(&tt);
+    return 0;
+}
+
+// Time per move of the MCTS engine with a fixed playout budget on the position suite
+int bench_mcts(int argc, char** argv) {
+    uint32_t playouts = argc > 0 ? (uint32_t) atoi(argv[0]) : 1000;
+    int threads = argc > 1 ? atoi(argv[1]) : 1;
+    PLAYOUT_POLICY policy = argc > 2 && strcmp(argv[2], "random") == 0 ? POLICY_RANDOM : POLICY_LIGHT;
+
+    Game suite[SUITE_SIZE];
+    build_suite(suite);
+
+    MctsPool pool;
+    if (mcts_pool_init(&pool, playouts * 6 + 64)) {
+        return 1;
+    }
+
+    printf("%u playouts, %d threads, %s policy\n\n", playouts, threads, policy == POLICY_RANDOM ? "random" : "light");
+    printf("pos\tmove\twin rate\tnodes\tms\n");
+
+    double total_ms = 0;
+    for (int p = 0; p < SUITE_SIZE; p++) {
+        MctsLimits limits = {playouts, 0, policy};
+        MctsResult result;
+        if (mcts_search(&suite[p], &limits, &pool, threads, &result)) {
+            printf("%d\t(no move)\n", p);
+            continue;
+        }
+        printf("%d\t%d\t%.3f\t%u\t%.2f\n", p, result.move + 1, result.win_rate, result.nodes, result.elapsed_ms);
+        total_ms += result.elapsed_ms;
+    }
+
+    printf("\nAverage %.2f ms per move\n", total_ms / SUITE_SIZE);
+    mcts_pool_free(&pool);
+    return 0;
+}
+
+// Random positions from random games, each with a random legal move to play
+int random_positions(Game* positions, uint8_t* slots, int count, uint64_t seed) {
+    uint64_t rng = seed;
+    Game game;
+    init_game(&game, "bench0", "bench1");
+
+    for (int i = 0; i < count; i++) {
+        int moves[6];
+        int move_count = list_moves(&game, moves);
+        while (move_count == 0) {
+            init_game(&game, "bench0", "bench1");
+            move_count = list_moves(&game, moves);
+        }
+
+        positions[i] = game;
+        slots[i] = (uint8_t) moves[zobrist_next(&rng) % move_count];
+
+        if (play_turn(&game, slots[i])) {
+            init_game(&game, "bench0", "bench1");
+        }
+    }
+    return count;
+}
+
+// Check the vector kernel against play_turn bit for bit and compare their throughput
+int bench_batch(int argc, char** argv) {
+    int batches = argc > 0 ? atoi(argv[0]) : 100000;
+    int count = batches * BATCH_WIDTH;
+
+    Game* positions = malloc(sizeof(Game) * count);
+    uint8_t* slots = malloc(count);
+    BoardBatch* scalar = aligned_alloc(32, sizeof(BoardBatch) * batches);
+    BoardBatch* vector = aligned_alloc(32, sizeof(BoardBatch) * batches);
+    uint8_t* won_scalar = malloc(count);
+    uint8_t* won_vector = malloc(count);
+    if (!positions || !slots || !scalar || !vector || !won_scalar || !won_vector) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+
+    random_positions(positions, slots, count, SUITE_SEED);
+    for (int b = 0; b < batches; b++) {
+        for (int lane = 0; lane < BATCH_WIDTH; lane++) {
+            batch_load(&scalar[b], lane, &positions[b * BATCH_WIDTH + lane]);
+        }
+    }
+    memcpy(vector, scalar, sizeof(BoardBatch) * batches);
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int b = 0; b < batches; b++) {
+        batch_play_scalar(&scalar[b], slots + b * BATCH_WIDTH, won_scalar + b * BATCH_WIDTH);
+    }
+    double ms_scalar = elapsed_ms(&start);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int b = 0; b < batches; b++) {
+        batch_play(&vector[b], slots + b * BATCH_WIDTH, won_vector + b * BATCH_WIDTH);
+    }
+    double ms_vector = elapsed_ms(&start);
+
+    int mismatches = 0;
+    for (int b = 0; b < batches; b++) {
+        if (memcmp(&scalar[b], &vector[b], sizeof(BoardBatch)) != 0 ||
+            memcmp(won_scalar + b * BATCH_WIDTH, won_vector + b * BATCH_WIDTH, BATCH_WIDTH) != 0) {
+            mismatches++;
+        }
+    }
+
+    printf("Kernel: %s, %d boards\n", BATCH_KERNEL, count);
+    printf("play_turn: %.1f ms, %.1f M boards/s\n", ms_scalar, count / ms_scalar / 1000.0);
+    printf("batch:     %.1f ms, %.1f M boards/s\n", ms_vector, count / ms_vector / 1000.0);
+    printf("Mismatching batches: %d\n", mismatches);
+
+    free(positions);
+    free(slots);
+    free(scalar);
+    free(vector);
+    free(won_scalar);
+    free(won_vector);
+    return mismatches ? 1 : 0;
+}
+
+// Leaf count below a position, copying the game for every move
+uint64_t perft_copy(const Game* game, int depth) {
+    if (depth == 0) return 1;
+
+    uint64_t leaves = 0;
+    int moves[6];
+    int count = list_moves(game, moves);
+    for (int i = 0; i < count; i++) {
+        Game child = *game;
+        if (!play_turn(&child, moves[i])) {
+            leaves += perft_copy(&child, depth - 1);
+        }
+    }
+    return leaves;
+}
+
+// Same count with make_move and unmake_move on a single game. Nothing is compared inside, so that it
+// times as a search would use them: the caller checks that the game is restored at the end
+uint64_t perft_make(Game* game, int depth) {
+    if (depth == 0) return 1;
+
+    uint64_t leaves = 0;
+    int moves[6];
+    int count = list_moves(game, moves);
+    for (int i = 0; i < count; i++) {
+        MoveUndo undo;
+        if (!make_move(game, moves[i], &undo)) {
+            leaves += perft_make(game, depth - 1);
+        }
+        unmake_move(game, &undo);
+    }
+    return leaves;
+}
+
+// Check make/unmake against play_turn on random positions, then compare copy-make and make/unmake perft speed
+int bench_make(int argc, char** argv) {
+    int depth = argc > 0 ? atoi(argv[0]) : 9;
+    int count = 1000000;
+
+    Game* positions = malloc(sizeof(Game) * count);
+    uint8_t* slots = malloc(count);
+    if (!positions || !slots) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    random_positions(positions, slots, count, SUITE_SEED);
+
+    int errors = 0;
+    for (int i = 0; i < count; i++) {
+        Game copied = positions[i], made = positions[i];
+        MoveUndo undo;
+        int won_copied = play_turn(&copied, slots[i]);
+        int won_made = make_move(&made, slots[i], &undo);
+        if (won_copied != won_made || memcmp(&copied, &made, sizeof(Game)) != 0) {
+            errors++;
+        }
+        unmake_move(&made, &undo);
+        if (memcmp(&made, &positions[i], sizeof(Game)) != 0) {
+            errors++;
+        }
+    }
+    printf("%d random moves, %d mismatches with play_turn or failed unmakes\n\n", count, errors);
+    free(positions);
+    free(slots);
+
+    Game suite[SUITE_SIZE];
+    build_suite(suite);
+
+    printf("Perft depth %d\n", depth);
+    printf("pos\tleaves\tms (copy)\tms (make/unmake)\n");
+    double total_copy = 0, total_make = 0;
+    for (int p = 0; p < SUITE_SIZE; p++) {
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        uint64_t copied = perft_copy(&suite[p], depth);
+        double ms_copy = elapsed_ms(&start);
+
+        Game game = suite[p];
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        uint64_t made = perft_make(&game, depth);
+        double ms_make = elapsed_ms(&start);
+
+        if (copied != made || memcmp(&game, &suite[p], sizeof(Game)) != 0) {
+            errors++;
+        }
+        printf("%d\t%llu\t%.1f\t%.1f\n", p, (unsigned long long) copied, ms_copy, ms_make);
+        total_copy += ms_copy;
+        total_make += ms_make;
+    }
+    printf("\ntotal\t\t%.1f\t%.1f\n", total_copy, total_make);
+    printf("Errors: %d\n", errors);
+    return errors ? 1 : 0;
+}
+
+// Bytes of a request, of a game state and of the changes of a move on the wire, frame header included
+void wire_sizes(PROTOCOL protocol, const Request* request, const Game* game, const GameDelta* delta,
+                size_t* request_bytes, size_t* game_bytes, size_t* delta_bytes) {
+    if (protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        encode_request(request, &writer);
+        *request_bytes = FRAME_HEADER_SIZE + writer.length;
+        writer.length = 0;
+        write_byte(&writer, BINARY_GAME);
+        write_game(&writer, game);
+        *game_bytes = FRAME_HEADER_SIZE + writer.length;
+        writer.length = 0;
+        write_byte(&writer, BINARY_DELTA);
+        write_delta(&writer, delta);
+        *delta_bytes = FRAME_HEADER_SIZE + writer.length;
+        writer_free(&writer);
+    } else {
+        char* json = request_to_json(request);
+        *request_bytes = FRAME_HEADER_SIZE + strlen(json);
+        free(json);
+        json = game_to_json_string(game);
+        *game_bytes = FRAME_HEADER_SIZE + strlen(json);
+        free(json);
+        json = delta_to_json_string(delta);
+        *delta_bytes = FRAME_HEADER_SIZE + strlen(json);
+        free(json);
+    }
+}
+
+double cpu_ms() {
+    struct timespec now;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return now.tv_sec * 1000.0 + now.tv_nsec / 1e6;
+}
+
+int bench_wire(int argc, char** argv) {
+    int count = argc > 0 ? atoi(argv[0]) : 200000;
+
+    // Each position of the suite followed by its first legal move, as the server would reply to MOVE
+    Game suite[SUITE_SIZE], played[SUITE_SIZE];
+    GameDelta deltas[SUITE_SIZE];
+    build_suite(suite);
+    for (int p = 0; p < SUITE_SIZE; p++) {
+        int moves[6] = {0};
+        played[p] = suite[p];
+        if (list_moves(&suite[p], moves) > 0) {
+            play_turn(&played[p], moves[0]);
+        }
+        played[p].version = suite[p].version + 1;
+        diff_games(&suite[p], &played[p], moves[0] + 1, &deltas[p]);
+    }
+    Request request = empty_request();
+    request.action = MOVE;
+    strcpy(request.arguments[0], "alice");
+    strcpy(request.arguments[1], "bob");
+    strcpy(request.arguments[2], "3");
+
+    // A MOVE request answered with its changes, as between client and server, over a socket pair
+    printf("%d MOVE round trips\n", count);
+    printf("protocol\trequest B\tgame B\tdelta B\tus/round trip\tCPU us/round trip\n");
+    int errors = 0;
+    for (PROTOCOL protocol = PROTOCOL_JSON; protocol <= PROTOCOL_BINARY; protocol++) {
+        int sockets[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets)) {
+            perror("Error creating a socket pair");
+            return 1;
+        }
+        Connection client, server;
+        connection_init(&client, sockets[0]);
+        connection_init(&server, sockets[1]);
+        client.protocol = server.protocol = protocol;
+
+        size_t request_bytes, game_bytes = 0, delta_bytes = 0;
+        for (int p = 0; p < SUITE_SIZE; p++) {
+            size_t bytes, delta;
+            wire_sizes(protocol, &request, &played[p], &deltas[p], &request_bytes, &bytes, &delta);
+            game_bytes += bytes;
+            delta_bytes += delta;
+        }
+
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        double cpu_start = cpu_ms();
+        for (int i = 0; i < count; i++) {
+            Request received = empty_request();
+            Game game = suite[i % SUITE_SIZE];
+            const Game* sent = &played[i % SUITE_SIZE];
+            if (send_request(&client, &request) || receive_request(&server, &received) ||
+                send_delta(&server, received.id, &deltas[i % SUITE_SIZE]) || receive_game(&client, request.id, &game)) {
+                errors++;
+                break;
+            }
+            if (received.action != MOVE || strcmp(received.arguments[2], "3") != 0 ||
+                game.current_state != sent->current_state || memcmp(game.board, sent->board, sizeof(game.board)) != 0) {
+                errors++;
+            }
+        }
+        double cpu = cpu_ms() - cpu_start;
+        double ms = elapsed_ms(&start);
+
+        printf("%s\t%zu\t%zu\t%zu\t%.2f\t%.2f\n", protocol == PROTOCOL_BINARY ? "binary" : "json",
+               request_bytes, game_bytes / SUITE_SIZE, delta_bytes / SUITE_SIZE, ms * 1000 / count, cpu * 1000 / count);
+        connection_free(&client);
+        connection_free(&server);
+        close(sockets[0]);
+        close(sockets[1]);
+    }
+    printf("Errors: %d\n", errors);
+    return errors ? 1 : 0;
+}
+
+// Allocations made by cJSON, counted by the hooks installed in bench_json
+size_t cjson_allocations = 0;
+
+void* counting_malloc(size_t size) {
+    cjson_allocations++;
+    return malloc(size);
+}
+
+// Messages compared by bench_json, as sent by GAME, MOVE, GAMES_BATCH and LIST
+typedef enum {
+    JSON_GAME,
+    JSON_DELTA,
+    JSON_GAMES,
+    JSON_NAMES
+} JSON_MESSAGE;
+
+#define JSON_NAME_COUNT 6
+
+typedef struct {
+    Game games[SUITE_SIZE];
+    const Game* pointers[SUITE_SIZE];
+    GameDelta deltas[SUITE_SIZE];
+    const char* names[JSON_NAME_COUNT];
+} JsonSamples;
+
+// Message of the given kind for position p, with the writer
+void writer_message(JsonWriter* writer, JSON_MESSAGE kind, int p, const JsonSamples* samples) {
+    json_reset(writer);
+    switch (kind) {
+        case JSON_GAME: json_write_game(writer, &samples->games[p]); break;
+        case JSON_DELTA: json_write_delta(writer, &samples->deltas[p]); break;
+        case JSON_GAMES: json_write_games(writer, samples->pointers, p + 1); break;
+        case JSON_NAMES: json_write_names(writer, samples->names, p % JSON_NAME_COUNT + 1); break;
+    }
+}
+
+// Same message with cJSON, as the server built it before the writer (to be freed)
+char* cjson_message(JSON_MESSAGE kind, int p, const JsonSamples* samples) {
+    switch (kind) {
+        case JSON_GAME: return game_to_json_string(&samples->games[p]);
+        case JSON_DELTA: return delta_to_json_string(&samples->deltas[p]);
+        case JSON_GAMES: return games_to_json_string(samples->pointers, p + 1);
+        case JSON_NAMES: {
+            cJSON* array = cJSON_CreateArray();
+            for (int i = 0; i <= p % JSON_NAME_COUNT; i++) {
+                cJSON_AddItemToArray(array, cJSON_CreateString(samples->names[i]));
+            }
+            char* json = cJSON_PrintUnformatted(array);
+            cJSON_Delete(array);
+            return json;
+        }
+    }
+    return NULL;
+}
+
+// Check that the JSON writer prints exactly what cJSON prints, and compare their allocations and time
+int bench_json(int argc, char** argv) {
+    int count = argc > 0 ? atoi(argv[0]) : 200000;
+
+    // The suite positions, their first legal move, and names which need escaping
+    JsonSamples samples = {
+        .names = {"alice", "bob", "quote\"d", "back\\slash", "tab\tnew\nline", "ctrl\x01\x1f\x7f\xc3\xa9"}
+    };
+    build_suite(samples.games);
+    for (int p = 0; p < SUITE_SIZE; p++) {
+        int moves[6] = {0};
+        Game played = samples.games[p];
+        if (list_moves(&played, moves) > 0) {
+            play_turn(&played, moves[0]);
+        }
+        played.version = samples.games[p].version + 1;
+        diff_games(&samples.games[p], &played, moves[0] + 1, &samples.deltas[p]);
+        strcpy(samples.games[p].player1, samples.names[p % JSON_NAME_COUNT]);
+        samples.games[p].version = (uint32_t) p * 1000003u;
+        samples.pointers[p] = &samples.games[p];
+    }
+
+    cJSON_Hooks hooks = {counting_malloc, free};
+    cJSON_InitHooks(&hooks);
+
+    const char* labels[] = {"game", "delta", "games", "names"};
+    printf("%d messages of each kind\n", count);
+    printf("message\tavg B\tcJSON allocs\tcJSON ns\twriter allocs\twriter ns\n");
+    int errors = 0;
+    JsonWriter writer;
+    json_writer_init(&writer);
+    for (JSON_MESSAGE kind = JSON_GAME; kind <= JSON_NAMES; kind++) {
+        size_t bytes = 0;
+        for (int p = 0; p < SUITE_SIZE; p++) {
+            char* expected = cjson_message(kind, p, &samples);
+            writer_message(&writer, kind, p, &samples);
+            if (!expected || writer.error || writer.length != strlen(expected) || strcmp(writer.data, expected) != 0) {
+                printf("Mismatch for %s %d:\n  cJSON  %s\n  writer %s\n", labels[kind], p, expected, writer.data);
+                errors++;
+            }
+            bytes += writer.length;
+            free(expected);
+        }
+
+        cjson_allocations = 0;
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < count; i++) {
+            free(cjson_message(kind, i % SUITE_SIZE, &samples));
+        }
+        double cjson_ms = elapsed_ms(&start);
+        size_t allocations = cjson_allocations;
+
+        // A new writer per kind, so that its first growths are counted as a connection would make them
+        json_writer_free(&writer);
+        size_t growths = 0;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < count; i++) {
+            size_t capacity = writer.capacity;
+            writer_message(&writer, kind, i % SUITE_SIZE, &samples);
+            if (writer.capacity != capacity) growths++;
+        }
+        double writer_ms = elapsed_ms(&start);
+
+        printf("%s\t%zu\t%.2f\t%.0f\t%.6f\t%.0f\n", labels[kind], bytes / SUITE_SIZE,
+               (double) allocations / count, cjson_ms * 1e6 / count, (double) growths / count, writer_ms * 1e6 / count);
+    }
+    json_writer_free(&writer);
+    cJSON_InitHooks(NULL);
+    printf("Errors: %d\n", errors);
+    return errors ? 1 : 0;
+}
+
+#define DECODE_CORPUS_SIZE 64
+#define DECODE_MAX_LENGTH 4096
+#define DECODE_SHOWN 5  // Mismatches printed in full
+
+// Messages to decode, the fuzzer mutates copies of them
+typedef struct {
+    char* texts[DECODE_CORPUS_SIZE];
+    int count;
+} DecodeCorpus;
+
+void corpus_add(DecodeCorpus* corpus, char* text) {
+    if (text && corpus->count < DECODE_CORPUS_SIZE) {
+        corpus->texts[corpus->count++] = text;
+    } else {
+        free(text);
+    }
+}
+
+void corpus_add_copy(DecodeCorpus* corpus, const char* text) {
+    corpus_add(corpus, strdup(text));
+}
+
+void corpus_free(DecodeCorpus* corpus) {
+    for (int i = 0; i < corpus->count; i++) {
+        free(corpus->texts[i]);
+    }
+    corpus->count = 0;
+}
+
+// Bytes JSON gives a meaning to, so that mutations mostly reach the decoders instead of failing at once
+const char decode_alphabet[] = "{}[]\",:\\/0123456789-+.eEuUtrfalsn \t\n\x01\x7f\xc3\xa9\xef\xbb\xbf" "aAbpPvV";
+
+/**
+ * @brief Mutates a message: changes, inserts, deletes, duplicates or cuts a few bytes.
+ *
+ * @param text The message, null bytes included.
+ * @param length Length of the message, updated.
+ * @param donor Another message, parts of which can be copied in.
+ * @param rng State of the random generator.
+ */
+void mutate(char* text, size_t* length, const char* donor, uint64_t* rng) {
+    int mutations = 1 + (int) (zobrist_next(rng) % 4);
+    for (int m = 0; m < mutations; m++) {
+        size_t at = *length ? zobrist_next(rng) % *length : 0;
+        size_t span = 1 + zobrist_next(rng) % 8;
+        switch (zobrist_next(rng) % 7) {
+            case 0:
+                if (*length) text[at] = decode_alphabet[zobrist_next(rng) % (sizeof(decode_alphabet) - 1)];
+                break;
+            case 1:
+                if (*length) text[at] = (char) zobrist_next(rng);
+                break;
+            case 2:
+                if (*length + 1 < DECODE_MAX_LENGTH) {
+                    memmove(text + at + 1, text + at, *length - at);
+                    text[at] = decode_alphabet[zobrist_next(rng) % (sizeof(decode_alphabet) - 1)];
+                    (*length)++;
+                }
+                break;
+            case 3:
+                if (span > *length - at) span = *length - at;
+                memmove(text + at, text + at + span, *length - at - span);
+                *length -= span;
+                break;
+            case 4: {
+                size_t donor_length = strlen(donor);
+                size_t from = donor_length ? zobrist_next(rng) % donor_length : 0;
+                if (span > donor_length - from) span = donor_length - from;
+                if (*length + span < DECODE_MAX_LENGTH) {
+                    memmove(text + at + span, text + at, *length - at);
+                    memcpy(text + at, donor + from, span);
+                    *length += span;
+                }
+                break;
+            }
+            case 5:
+                if (*length && text[at] >= 'a' && text[at] <= 'z') text[at] = (char) (text[at] - 'a' + 'A');
+                break;
+            case 6:
+                *length = at;
+                break;
+        }
+    }
+    text[*length] = '\0';
+}
+
+// Prints a message with its unprintable bytes escaped
+void print_message(const char* label, const char* text, size_t length) {
+    printf("%s \"", label);
+    for (size_t i = 0; i < length; i++) {
+        unsigned char c = (unsigned char) text[i];
+        if (c >= ' ' && c < 0x7f && c != '\\') putchar(c);
+        else printf("\\x%02x", c);
+    }
+    printf("\"\n");
+}
+
+bool same_game(const Game* a, const Game* b) {
+    return strcmp(a->player0, b->player0) == 0 && strcmp(a->player1, b->player1) == 0 &&
+           a->current_state == b->current_state && a->score.player0 == b->score.player0 &&
+           a->score.player1 == b->score.player1 && memcmp(a->board, b->board, sizeof(a->board)) == 0 &&
+           a->version == b->version;
+}
+
+bool same_delta(const GameDelta* a, const GameDelta* b) {
+    if (a->count != b->count || a->version != b->version || a->move != b->move || a->captured != b->captured ||
+        a->score.player0 != b->score.player0 || a->score.player1 != b->score.player1 || a->state != b->state) {
+        return false;
+    }
+    for (int i = 0; i < a->count; i++) {
+        if (a->pits[i] != b->pits[i] || a->seeds[i] != b->seeds[i]) return false;
+    }
+    return true;
+}
+
+// Decodes a message as a request, a game and a batch of games both ways, returns whether the results agree
+bool same_decoding(const char* text, size_t length, const Game* start) {
+    Request cjson_request = empty_request(), direct_request = empty_request();
+    int cjson_result = cjson_to_request(text, &cjson_request);
+    int direct_result = json_to_request(text, length, &direct_request);
+    if (cjson_result != direct_result) return false;
+    if (cjson_result == 0) {
+        if (cjson_request.action != direct_request.action) return false;
+        for (int i = 0; i < MAX_ARGS; i++) {
+            if (strcmp(cjson_request.arguments[i], direct_request.arguments[i]) != 0) return false;
+        }
+    }
+
+    Game cjson_game = *start, direct_game = *start;
+    GameDelta cjson_delta = {0}, direct_delta = {0};
+    cjson_result = cjson_decode_game(text, &cjson_game, &cjson_delta);
+    direct_result = json_decode_game(text, length, &direct_game, &direct_delta);
+    if (cjson_result != direct_result || (cjson_result == 0 && !same_game(&cjson_game, &direct_game)) ||
+        (cjson_result == 1 && !same_delta(&cjson_delta, &direct_delta))) {
+        return false;
+    }
+
+    int cjson_count, direct_count;
+    Game* cjson_games = cjson_decode_games(text, &cjson_count);
+    Game* direct_games = json_decode_games(text, length, &direct_count);
+    bool same = (cjson_games == NULL) == (direct_games == NULL) && cjson_count == direct_count;
+    for (int i = 0; same && i < cjson_count; i++) {
+        same = same_game(&cjson_games[i], &direct_games[i]);
+    }
+    free(cjson_games);
+    free(direct_games);
+    return same;
+}
+
+// Check the direct JSON decoders against cJSON on mutated messages, and compare their time on valid ones
+int bench_decode(int argc, char** argv) {
+    int count = argc > 0 ? atoi(argv[0]) : 1000000;
+    uint64_t rng = argc > 1 ? strtoull(argv[1], NULL, 10) : SUITE_SEED;
+
+    // Requests and games as client and server send them, then the oddities cJSON accepts
+    DecodeCorpus corpus = {0};
+    Game suite[SUITE_SIZE];
+    const Game* pointers[SUITE_SIZE];
+    build_suite(suite);
+    const char* names[] = {"alice", "quote\"d", "back\\slash", "tab\tnew\nline", "ctrl\x01\x1f\xc3\xa9",
+                           "a name much longer than the thirty-two bytes of a player name"};
+    for (int p = 0; p < SUITE_SIZE; p++) {
+        strcpy(suite[p].player1, names[p % 6]);
+        suite[p].version = (uint32_t) p * 1000003u;
+        pointers[p] = &suite[p];
+        corpus_add(&corpus, game_to_json_string(&suite[p]));
+
+        int moves[6] = {0};
+        Game played = suite[p];
+        GameDelta delta;
+        if (list_moves(&played, moves) > 0) play_turn(&played, moves[0]);
+        played.version++;
+        diff_games(&suite[p], &played, moves[0] + 1, &delta);
+        corpus_add(&corpus, delta_to_json_string(&delta));
+
+        Request request = empty_request();
+        request.action = (ACTION) (p % (SPECTATE + 1));
+        strcpy(request.arguments[0], names[p % 6]);
+        strcpy(request.arguments[1], names[(p + 1) % 6]);
+        snprintf(request.arguments[2], MAX_ARG_LENGTH, "%d", p);
+        if (p % 2) snprintf(request.arguments[3], MAX_ARG_LENGTH, "%u", suite[p].version);
+        corpus_add(&corpus, request_to_json(&request));
+    }
+    corpus_add(&corpus, games_to_json_string(pointers, SUITE_SIZE));
+    corpus_add(&corpus, games_to_json_string(pointers, 0));
+    corpus_add_copy(&corpus, "false");
+    corpus_add_copy(&corpus, "\xef\xbb\xbf {\"action\" : \"MOVE\" , \"arguments\" : [\"a\", \"b\", \"3\"] } trailing");
+    corpus_add_copy(&corpus, "{\"action\":\"LIST\",\"action\":\"LOGIN\",\"arguments\":[1,null,[],{},\"x\"],\"arguments\":7}");
+    corpus_add_copy(&corpus, "{\"Action\":\"LOGIN\",\"action\":\"LOGIN\",\"arguments\":[\"\\u00e9\\ud83d\\ude00\\/\\b\\f\\r\",\"\\u0000cut\",\"\\uzzzz\"]}");
+    corpus_add_copy(&corpus, "{\"PLAYER0\":\"x\",\"player1\":\"y\",\"CurrentState\":1.9,\"score\":{\"PLAYER0\":1e3,\"player1\":-0,\"player1\":5},"
+                             "\"board\":[1,\"2\",3e0,-4,2147483648,-1e99,7,8,9,10,11,12,13],\"version\":4294967296}");
+    corpus_add_copy(&corpus, "{\"version\":7,\"MOVE\":3,\"pits\":[0,5,11,0,3.5,1],\"captured\":2,\"score\":{\"player0\":2,\"player1\":0},"
+                             "\"currentState\":1,\"move\":null}");
+    corpus_add_copy(&corpus, "[{\"player0\":\"a\",\"player1\":\"b\"},false,{\"move\":1,\"board\":[4,4]},[[[[[]]]]],\"x\",01,-1-2,1e5e]");
+
+    // Fuzzing: every mutated message must give the same results both ways. Failures print errors, hidden meanwhile
+    fflush(stderr);
+    int saved_stderr = dup(STDERR_FILENO);
+    int null_fd = open("/dev/null", O_WRONLY);
+    if (null_fd >= 0) dup2(null_fd, STDERR_FILENO);
+
+    char text[DECODE_MAX_LENGTH + 1];
+    int mismatches = 0, accepted = 0;
+    for (int i = 0; i < count; i++) {
+        const char* seed = corpus.texts[zobrist_next(&rng) % corpus.count];
+        size_t length = strlen(seed);
+        memcpy(text, seed, length + 1);
+        if (i >= corpus.count) {
+            mutate(text, &length, corpus.texts[zobrist_next(&rng) % corpus.count], &rng);
+        }
+        if (!same_decoding(text, length, &suite[i % SUITE_SIZE])) {
+            if (mismatches++ < DECODE_SHOWN) print_message("Mismatch:", text, length);
+        }
+        Request request;
+        accepted += json_to_request(text, length, &request) == 0;
+    }
+
+    // Time of the valid messages, and cJSON's allocations for them
+    cJSON_Hooks hooks = {counting_malloc, free};
+    cJSON_InitHooks(&hooks);
+    printf("%d messages fuzzed, %d valid requests among them\n", count, accepted);
+    printf("message\tcJSON allocs\tcJSON ns\tdirect ns\n");
+    int timed = count / 10 + 1;
+    for (int kind = 0; kind < 3; kind++) {
+        cjson_allocations = 0;
+        struct timespec start;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < timed; i++) {
+            const char* text = corpus.texts[3 * (i % SUITE_SIZE) + kind];
+            Request request;
+            Game game;
+            GameDelta delta;
+            if (kind == 2) cjson_to_request(text, &request);
+            else cjson_decode_game(text, &game, &delta);
+        }
+        double cjson_ms = elapsed_ms(&start);
+        size_t allocations = cjson_allocations;
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        for (int i = 0; i < timed; i++) {
+            const char* text = corpus.texts[3 * (i % SUITE_SIZE) + kind];
+            Request request;
+            Game game;
+            GameDelta delta;
+            if (kind == 2) json_to_request(text, strlen(text), &request);
+            else json_decode_game(text, strlen(text), &game, &delta);
+        }
+        double direct_ms = elapsed_ms(&start);
+        const char* labels[] = {"game", "delta", "request"};
+        printf("%s\t%.2f\t%.0f\t%.0f\n", labels[kind], (double) allocations / timed, cjson_ms * 1e6 / timed,
+               direct_ms * 1e6 / timed);
+    }
+    cJSON_InitHooks(NULL);
+
+    fflush(stderr);
+    if (saved_stderr >= 0) {
+        dup2(saved_stderr, STDERR_FILENO);
+        close(saved_stderr);
+    }
+    if (null_fd >= 0) close(null_fd);
+    corpus_free(&corpus);
+    printf("Mismatches: %d\n", mismatches);
+    return mismatches ? 1 : 0;
+}
+
+void usage() {
+    printf("Usage: awale_bench <benchmark> [options]\n");
+    printf("• tt [depth] [huge]  - search the position suite with and without the transposition table\n");
+    printf("• smp [depth] [max]  - time to depth and nodes per second from 1 to max threads (Lazy SMP)\n");
+    printf("• mcts [playouts] [threads] [random|light] - time per move of the MCTS engine\n");
+    printf("• batch [batches]    - check the batch move kernel against play_turn and compare boards/s\n");
+    printf("• make [depth]       - check make/unmake against play_turn and compare it with copy-make perft\n");
+    printf("• wire [count]       - bytes and CPU time per request of the JSON and binary protocols\n");
+    printf("• json [count]       - check the JSON writer against cJSON and compare allocations and time\n");
+    printf("• decode [count] [seed] - fuzz the direct JSON decoders against cJSON and compare their time\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        usage();
+        return 1;
+    }
+
+    init_engine();
+
+    if (strcmp(argv[1], "tt") == 0) {
+        return bench_tt(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "smp") == 0) {
+        return bench_smp(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "mcts") == 0) {
+        return bench_mcts(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "batch") == 0) {
+        return bench_batch(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "make") == 0) {
+        return bench_make(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "wire") == 0) {
+        return bench_wire(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "json") == 0) {
+        return bench_json(argc - 2, argv + 2);
+    }
+    if (strcmp(argv[1], "decode") == 0) {
+        return bench_decode(argc - 2, argv + 2);
+    }
+
+    usage();
+    return 1;
+}
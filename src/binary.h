@@ -0,0 +1,225 @@
+//
+// Compact binary encoding of the messages, used instead of JSON when negotiated at LOGIN.
+// Integers are varints (7 bits per byte, low bits first), strings a varint length then their bytes
+//
+
+#ifndef AWALEGAME_BINARY_H
+#define AWALEGAME_BINARY_H
+
+#include <stdint.h>
+
+#include "game.h"
+
+#define BINARY_INITIAL_CAPACITY 128
+
+// First byte of every binary response
+typedef enum {
+    BINARY_FALSE,     // Request failed
+    BINARY_TRUE,      // Request succeeded, nothing to return
+    BINARY_NAMES,     // Count, then that many strings
+    BINARY_GAME,      // A game, see write_game
+    BINARY_ANALYSIS,  // Engine result, see the ANALYZE handler
+    BINARY_DELTA,     // Changes made by a move, see write_delta
+    BINARY_NOT_MODIFIED, // The client already has the latest version of the game
+    BINARY_GAMES      // Count, then that many games
+} BINARY_TAG;
+
+// Growable output buffer, a failed allocation is remembered and reported by the caller
+typedef struct {
+    uint8_t* data;
+    size_t length;
+    size_t capacity;
+    bool error;
+} BinaryWriter;
+
+// Input buffer, reading past the end sets error and returns zeros
+typedef struct {
+    const uint8_t* data;
+    size_t length;
+    size_t offset;
+    bool error;
+} BinaryReader;
+
+void writer_init(BinaryWriter* writer) {
+    writer->data = NULL;
+    writer->length = 0;
+    writer->capacity = 0;
+    writer->error = false;
+}
+
+void writer_free(BinaryWriter* writer) {
+    free(writer->data);
+    writer_init(writer);
+}
+
+void write_bytes(BinaryWriter* writer, const void* bytes, size_t length) {
+    if (writer->error) return;
+    if (writer->length + length > writer->capacity) {
+        size_t capacity = writer->capacity ? writer->capacity * 2 : BINARY_INITIAL_CAPACITY;
+        while (capacity < writer->length + length) capacity *= 2;
+        uint8_t* data = realloc(writer->data, capacity);
+        if (!data) {
+            writer->error = true;
+            return;
+        }
+        writer->data = data;
+        writer->capacity = capacity;
+    }
+    memcpy(writer->data + writer->length, bytes, length);
+    writer->length += length;
+}
+
+void write_byte(BinaryWriter* writer, uint8_t byte) {
+    write_bytes(writer, &byte, 1);
+}
+
+void write_varint(BinaryWriter* writer, uint64_t value) {
+    uint8_t bytes[10];
+    size_t length = 0;
+    while (value >= 0x80) {
+        bytes[length++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    bytes[length++] = (uint8_t) value;
+    write_bytes(writer, bytes, length);
+}
+
+// Signed values (scores) are zigzag encoded so that small negative numbers stay short
+void write_signed(BinaryWriter* writer, int64_t value) {
+    write_varint(writer, ((uint64_t) value << 1) ^ (uint64_t) (value >> 63));
+}
+
+void write_string(BinaryWriter* writer, const char* string) {
+    size_t length = strlen(string);
+    write_varint(writer, length);
+    write_bytes(writer, string, length);
+}
+
+void reader_init(BinaryReader* reader, const void* data, size_t length) {
+    reader->data = data;
+    reader->length = length;
+    reader->offset = 0;
+    reader->error = false;
+}
+
+bool reader_done(const BinaryReader* reader) {
+    return reader->offset >= reader->length;
+}
+
+uint8_t read_byte(BinaryReader* reader) {
+    if (reader->offset >= reader->length) {
+        reader->error = true;
+        return 0;
+    }
+    return reader->data[reader->offset++];
+}
+
+uint64_t read_varint(BinaryReader* reader) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte = read_byte(reader);
+        value |= (uint64_t) (byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+    }
+    reader->error = true;  // More than 10 bytes
+    return 0;
+}
+
+int64_t read_signed(BinaryReader* reader) {
+    uint64_t value = read_varint(reader);
+    return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+}
+
+/**
+ * @brief Reads a string into a fixed buffer.
+ *
+ * @param reader The input.
+ * @param string Filled with the null-terminated string.
+ * @param size Size of the buffer, longer strings are an error.
+ *
+ * @return int Returns 0 on success, or -1 on failure (the reader's error is set).
+ */
+int read_string(BinaryReader* reader, char* string, size_t size) {
+    uint64_t length = read_varint(reader);
+    if (reader->error || length >= size || length > reader->length - reader->offset) {
+        reader->error = true;
+        string[0] = '\0';
+        return -1;
+    }
+    memcpy(string, reader->data + reader->offset, length);
+    string[length] = '\0';
+    reader->offset += length;
+    return 0;
+}
+
+// Players, state, score, board and version: about 20 bytes plus the names for any real game
+void write_game(BinaryWriter* writer, const Game* game) {
+    write_string(writer, game->player0);
+    write_string(writer, game->player1);
+    write_byte(writer, (uint8_t) game->current_state);
+    write_varint(writer, game->score.player0);
+    write_varint(writer, game->score.player1);
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        write_varint(writer, game->board[i]);
+    }
+    write_varint(writer, game->version);
+}
+
+// Returns 0 on success, or -1 if the input is truncated or invalid
+int read_game(BinaryReader* reader, Game* game) {
+    read_string(reader, game->player0, sizeof(game->player0));
+    read_string(reader, game->player1, sizeof(game->player1));
+    uint8_t state = read_byte(reader);
+    if (state > DRAW) reader->error = true;
+    game->current_state = (GAME_STATE) state;
+    game->score.player0 = (int) read_varint(reader);
+    game->score.player1 = (int) read_varint(reader);
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        game->board[i] = (int) read_varint(reader);
+    }
+    game->version = (uint32_t) read_varint(reader);
+    return reader->error ? -1 : 0;
+}
+
+// Version, move, changed pits as index and seeds pairs, captured seeds, score and state
+void write_delta(BinaryWriter* writer, const GameDelta* delta) {
+    write_varint(writer, delta->version);
+    write_varint(writer, delta->move);
+    write_varint(writer, delta->count);
+    for (int i = 0; i < delta->count; i++) {
+        write_byte(writer, (uint8_t) delta->pits[i]);
+        write_varint(writer, delta->seeds[i]);
+    }
+    write_varint(writer, delta->captured);
+    write_varint(writer, delta->score.player0);
+    write_varint(writer, delta->score.player1);
+    write_byte(writer, (uint8_t) delta->state);
+}
+
+// Returns 0 on success, or -1 if the input is truncated or invalid
+int read_delta(BinaryReader* reader, GameDelta* delta) {
+    delta->version = (uint32_t) read_varint(reader);
+    delta->move = (int) read_varint(reader);
+    uint64_t count = read_varint(reader);
+    if (count > BOARD_SIZE) {
+        reader->error = true;
+        return -1;
+    }
+    delta->count = (int) count;
+    for (int i = 0; i < delta->count; i++) {
+        delta->pits[i] = read_byte(reader);
+        delta->seeds[i] = (int) read_varint(reader);
+        if (delta->pits[i] >= BOARD_SIZE) reader->error = true;
+    }
+    delta->captured = (int) read_varint(reader);
+    delta->score.player0 = (int) read_varint(reader);
+    delta->score.player1 = (int) read_varint(reader);
+    uint8_t state = read_byte(reader);
+    if (state > DRAW) reader->error = true;
+    delta->state = (GAME_STATE) state;
+    return reader->error ? -1 : 0;
+}
+
+#endif //AWALEGAME_BINARY_H
@@ -0,0 +1,56 @@
+//
+// Opening book compiled into the binaries, generated offline by awale_book.
+// To be used by bots so that their opening moves cost no search
+//
+
+#ifndef AWALEGAME_BOOK_H
+#define AWALEGAME_BOOK_H
+
+#include <stdint.h>
+
+#include "game.h"
+#include "zobrist.h"
+
+// Best move for a position, identified by its hash_game
+typedef struct {
+    uint64_t hash;
+    uint8_t move;  // Slot from 0 to 11
+} BookEntry;
+
+#include "book_data.h"
+
+/**
+ * @brief Looks up the book move of a position (binary search on the sorted table).
+ *
+ * @param game The position, init_zobrist must have been called.
+ *
+ * @return int The slot to play, or -1 if the position is not in the book.
+ */
+int book_probe(const Game* game) {
+    uint64_t hash = hash_game(game);
+    size_t low = 0, high = OPENING_BOOK_SIZE;
+
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (OPENING_BOOK[middle].hash < hash) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low == OPENING_BOOK_SIZE || OPENING_BOOK[low].hash != hash) {
+        return -1;
+    }
+
+    // Never trust a hash collision with an illegal move
+    int moves[6];
+    int count = list_moves(game, moves);
+    for (int i = 0; i < count; i++) {
+        if (moves[i] == OPENING_BOOK[low].move) {
+            return moves[i];
+        }
+    }
+    return -1;
+}
+
+#endif //AWALEGAME_BOOK_H
@@ -0,0 +1,6452 @@
+//
+// Opening book generated by awale_book 6 12, do not edit.
+// Best move of every position reachable in fewer than 6 plies, searched to depth 12
+//
+
+#ifndef AWALEGAME_BOOK_DATA_H
+#define AWALEGAME_BOOK_DATA_H
+
+#define OPENING_BOOK_PLIES 6
+#define OPENING_BOOK_DEPTH 12
+#define OPENING_BOOK_SIZE 6435
+
+// Sorted by hash_game
+const BookEntry OPENING_BOOK[OPENING_BOOK_SIZE] = {
+    {0x000f597fca04d3a7ull, 10},
+    {0x0013cec0bb08ce5aull, 3},
+    {0x001f2276777db673ull, 6},
+    {0x0032824b9c50e08bull, 6},
+    {0x0045d44221807db4ull, 8},
+    {0x004d7d5695597850ull, 8},
+    {0x00554f41c339ba54ull, 6},
+    {0x005d5a0f9698b211ull, 7},
+    {0x005dcab3b6109bf7ull, 7},
+    {0x00658276fe881c4dull, 6},
+    {0x006bd54f3cdc4558ull, 2},
+    {0x006fcdaddb4238deull, 11},
+    {0x00814da330379468ull, 6},
+    {0x00942f682fc6ffb6ull, 10},
+    {0x00b976a400a1ecd9ull, 6},
+    {0x00c0d08d4fec008full, 6},
+    {0x00c642d2f6c36d50ull, 10},
+    {0x00c721ad9c9b7e56ull, 11},
+    {0x01146ac70037d6edull, 8},
+    {0x011a7ef8878ddedcull, 10},
+    {0x011beee35f5fcc0full, 3},
+    {0x0135cac361c871c7ull, 6},
+    {0x013700df8e64bd6cull, 6},
+    {0x013a1a3cc22242cfull, 6},
+    {0x013e0c5fefb635aeull, 8},
+    {0x014870ac806c757dull, 10},
+    {0x0159989b01a2562aull, 11},
+    {0x0162b4e2af7f0a75ull, 6},
+    {0x0170dbcff1e96e20ull, 10},
+    {0x019650b240674e48ull, 10},
+    {0x01a236d5d65cb0e3ull, 8},
+    {0x01b665e9a9845604ull, 6},
+    {0x01b7f036a02596c2ull, 6},
+    {0x01bc350b24bbfe2dull, 10},
+    {0x01ca85e15649e013ull, 11},
+    {0x01d67003e7ff610dull, 8},
+    {0x01f624f6e43df3e9ull, 8},
+    {0x0208ca17ad723455ull, 8},
+    {0x0212be1466a75e50ull, 9},
+    {0x0219c17356a7ec7eull, 0},
+    {0x021b5a3d999eefd3ull, 6},
+    {0x022898ce9d27ac55ull, 6},
+    {0x023b4034333802f5ull, 10},
+    {0x0260fccaaff57d05ull, 8},
+    {0x0262bb39bcd8bb5bull, 2},
+    {0x02708773b6e951f8ull, 6},
+    {0x028e2436e75ebb91ull, 9},
+    {0x02949c8018a1fdb7ull, 10},
+    {0x0299d8b7845915aaull, 10},
+    {0x029c83471942837dull, 7},
+    {0x02bd2116f091a351ull, 7},
+    {0x02bf90f889e39a21ull, 6},
+    {0x02c586ac9c23b95cull, 6},
+    {0x02e70747c62c4693ull, 3},
+    {0x02fb8a7e50ac96d6ull, 2},
+    {0x032a7b1cec50decfull, 0},
+    {0x032de7ba53f6b7d4ull, 8},
+    {0x033887337a9342fbull, 11},
+    {0x033e2560f311d22eull, 11},
+    {0x03407de0e3b2cd97ull, 3},
+    {0x0340cc6df746239full, 10},
+    {0x0342575fa9edba18ull, 6},
+    {0x036c9deb6b0ffda9ull, 8},
+    {0x0377d47b062ce20aull, 6},
+    {0x037cc7cf05d10febull, 6},
+    {0x037fcf5410b5a3e2ull, 11},
+    {0x0380acd0b405699aull, 6},
+    {0x0381e94d91309e65ull, 9},
+    {0x0385006d9ce7856full, 6},
+    {0x038a37bd93fd3b1full, 7},
+    {0x0391a5117afc4c94ull, 10},
+    {0x03a3ea815b4cfbdcull, 9},
+    {0x03b1edaaa9b391faull, 9},
+    {0x03ba5d8f19411d62ull, 5},
+    {0x03cc55a43a05b1dcull, 6},
+    {0x03d6e06caccb6906ull, 0},
+    {0x03dab3dd5f97dd8full, 6},
+    {0x03db851611b54ef9ull, 9},
+    {0x03df974e0dd9cccaull, 7},
+    {0x03effedc03d1d121ull, 7},
+    {0x040586731d004fb4ull, 1},
+    {0x0406e732c4e9f592ull, 10},
+    {0x0412f4ce5957b08eull, 8},
+    {0x0414c31089695c17ull, 11},
+    {0x041fc8d833d5748full, 6},
+    {0x0427705ee9cd50a1ull, 7},
+    {0x042beac5bef7fd61ull, 7},
+    {0x042e7595f11e2cf6ull, 8},
+    {0x04477e23dece1257ull, 7},
+    {0x0451fff0aa59cd2eull, 8},
+    {0x0454cf179418ad0aull, 8},
+    {0x04568610264de647ull, 0},
+    {0x045d5447451c5b28ull, 7},
+    {0x0464e07035fdb587ull, 6},
+    {0x0474269360236dd4ull, 10},
+    {0x047429311405159cull, 7},
+    {0x04842a2fd40841d5ull, 9},
+    {0x0486c1ff01f3f1bbull, 8},
+    {0x049278fd89cfbbeeull, 4},
+    {0x04b1d108e5729569ull, 9},
+    {0x04b2a1d50b66b617ull, 6},
+    {0x04c36af95df41c1eull, 7},
+    {0x04ccb169f24d7d57ull, 6},
+    {0x04cda81fb7011088ull, 6},
+    {0x04d4b9a4f6155653ull, 8},
+    {0x04e799003fabf4f5ull, 6},
+    {0x04e7b7f885cfd9deull, 8},
+    {0x04eae002c6d05bc6ull, 7},
+    {0x04fa7727c7419bacull, 7},
+    {0x05194791577bb080ull, 6},
+    {0x05371d414574f64dull, 9},
+    {0x0540ce2560fcf895ull, 4},
+    {0x054e5bc3e1fe94f3ull, 11},
+    {0x055f7ec57a82be55ull, 11},
+    {0x0566d2646d3134b6ull, 9},
+    {0x0567be9ba3ab952cull, 7},
+    {0x0573bc2a4b940b87ull, 7},
+    {0x0577e9bc8b7f5a5full, 8},
+    {0x058d29ed0fbee1a3ull, 9},
+    {0x058ef4f4a9944954ull, 10},
+    {0x058f916b916368baull, 10},
+    {0x059603622b419886ull, 7},
+    {0x05a647f3ccc80152ull, 6},
+    {0x05a6b27a51a00fa1ull, 6},
+    {0x05a9b022e74a8c84ull, 9},
+    {0x05ad2904e561dd0aull, 6},
+    {0x05b5f381a351fd29ull, 10},
+    {0x05c1cff80e642b88ull, 7},
+    {0x05d9e1aa249fe9c9ull, 6},
+    {0x05dec603ce4aa62full, 7},
+    {0x05e8d4cdcb084dd5ull, 7},
+    {0x05ef11227cd90aefull, 7},
+    {0x05f3a3e27b7bfa41ull, 10},
+    {0x05f5603782ac2484ull, 11},
+    {0x05f6a03aaefd5b24ull, 9},
+    {0x05faedf1612e1b3cull, 6},
+    {0x05fc9c138613f907ull, 6},
+    {0x0601d53f70eb275full, 11},
+    {0x06052dc92c526477ull, 3},
+    {0x060997e15c26dddbull, 7},
+    {0x060ba311be4c1e87ull, 7},
+    {0x061c951c69e90f16ull, 8},
+    {0x062027b3b6cdb02full, 9},
+    {0x0624cec8c1a1161aull, 8},
+    {0x0631816773589940ull, 7},
+    {0x0634bcfbe033be2cull, 7},
+    {0x0645c7b22557714full, 8},
+    {0x065f9345b23daebaull, 8},
+    {0x067afe7ed4d0a511ull, 4},
+    {0x0681f63a2d6e8f6cull, 11},
+    {0x0689e0242ee5d26bull, 6},
+    {0x06aa500e61880dc7ull, 9},
+    {0x06acb10b8dcc51e8ull, 7},
+    {0x06b15b4b89776b7full, 9},
+    {0x06b1c7e6a27686ddull, 11},
+    {0x06b1f0a6102c2d5cull, 0},
+    {0x06c7f3cf7e1e69fdull, 6},
+    {0x06ceefb8b91fbd0bull, 10},
+    {0x06d4d461b0a05389ull, 10},
+    {0x06e18c5fa33c1646ull, 11},
+    {0x06e9808a042bc148ull, 6},
+    {0x06f0f8b2921e4c9bull, 11},
+    {0x06f117e36849e948ull, 8},
+    {0x06f759d003c7ff30ull, 6},
+    {0x0704a4dee88d881bull, 6},
+    {0x070a1ed9e4cd210dull, 7},
+    {0x070aff60a5278c6cull, 6},
+    {0x07390f9066051274ull, 8},
+    {0x07460a54077f6650ull, 8},
+    {0x074856778e6df156ull, 7},
+    {0x0766b793b1c5a207ull, 7},
+    {0x07670ab68799e29aull, 11},
+    {0x076b5ed59c17df67ull, 9},
+    {0x0772713f6b2b5e7aull, 10},
+    {0x07811de4bb64bf76ull, 1},
+    {0x079a39784e8e85f5ull, 7},
+    {0x07ae54de187fc2beull, 11},
+    {0x07b7bbb0b925beeeull, 0},
+    {0x07bfc0fa46164708ull, 11},
+    {0x07c547054ab03e81ull, 7},
+    {0x07cbf9ae95bccfdeull, 6},
+    {0x07d32e626af7229cull, 9},
+    {0x07e04ff31493faa2ull, 7},
+    {0x07e6eef0260d1006ull, 4},
+    {0x07e8305c59f9cdcdull, 9},
+    {0x07ea1fc9f76e9de2ull, 4},
+    {0x07ed9d261d071df8ull, 7},
+    {0x0809fbe4c8ea565dull, 3},
+    {0x080b8712858f1095ull, 10},
+    {0x081276bc56684e73ull, 6},
+    {0x08178f252430479eull, 6},
+    {0x08192424dddc80a6ull, 9},
+    {0x0819b865473c9635ull, 10},
+    {0x081c32e9befed43eull, 11},
+    {0x081d78ba85145604ull, 8},
+    {0x082fb938a6ee03beull, 6},
+    {0x083a7fcc88ea6c55ull, 3},
+    {0x084be135628e1d84ull, 7},
+    {0x08514e4d22eb5fc4ull, 8},
+    {0x0869f7aae8d6ba53ull, 10},
+    {0x08732f54d987941aull, 11},
+    {0x08accadef01eafb3ull, 6},
+    {0x08b36fce03f6d4eaull, 0},
+    {0x08cb4abbe5fc0761ull, 8},
+    {0x08cde2e11fda2cf0ull, 6},
+    {0x08cf07504bd625b5ull, 6},
+    {0x08dc0557af3de4acull, 8},
+    {0x08e966eaf173775full, 9},
+    {0x08edb5df214ae1baull, 8},
+    {0x08fc33b641a7446cull, 6},
+    {0x08fe76fd5017f7d6ull, 2},
+    {0x090284e362d60f9eull, 1},
+    {0x090848c579042f85ull, 8},
+    {0x0908ba54b963ff7bull, 8},
+    {0x0908faf929b8a8d9ull, 7},
+    {0x0919ff2db372446eull, 6},
+    {0x091c5218b1bc7be2ull, 0},
+    {0x091d147ea39175f5ull, 11},
+    {0x092dfc37e8b793caull, 8},
+    {0x0937c1b69b644da3ull, 6},
+    {0x0946fd2684cc5e36ull, 6},
+    {0x094a8848caaad53full, 10},
+    {0x098444849b533a2cull, 6},
+    {0x098860659121dc09ull, 0},
+    {0x0988ae8d553e1e26ull, 5},
+    {0x098aa7c4a32c1117ull, 7},
+    {0x098b1f323b5a498aull, 6},
+    {0x09999effe3a62cbeull, 10},
+    {0x099b0f0dbb7e6d99ull, 11},
+    {0x09a898ed34905c26ull, 8},
+    {0x09b0b0161a0cf1a9ull, 7},
+    {0x09c0fb690b66143eull, 6},
+    {0x09c189fc4b559e3bull, 6},
+    {0x09c95e522ef361faull, 11},
+    {0x09d02a9f6ecab9e2ull, 11},
+    {0x09d5bea58017f0a2ull, 1},
+    {0x09d771edd22fb044ull, 0},
+    {0x09dde4cc4cb4e97dull, 7},
+    {0x09fe9e3c745392beull, 6},
+    {0x0a04520ba0b57f2full, 8},
+    {0x0a2b6efe618ec4e7ull, 8},
+    {0x0a36b0a1c3f88102ull, 6},
+    {0x0a426fc50ab23394ull, 9},
+    {0x0a61a70cfa8cc4b1ull, 9},
+    {0x0a7000e52c9b9ce1ull, 1},
+    {0x0a76b18220075249ull, 10},
+    {0x0a7a5d3d69fa05deull, 8},
+    {0x0a8699e0ab1146a9ull, 3},
+    {0x0a88db83b41d2c77ull, 10},
+    {0x0aab395791d71447ull, 7},
+    {0x0aae8b771cb3d33cull, 7},
+    {0x0abdbef4225a4941ull, 7},
+    {0x0acec470c2b96e9bull, 11},
+    {0x0add1f54faf503a2ull, 7},
+    {0x0aebefdca2b3e084ull, 9},
+    {0x0b010ff608af8c6aull, 9},
+    {0x0b0bea95e2d2f19dull, 0},
+    {0x0b13f1267c75845bull, 7},
+    {0x0b1e4d6e3b29c288ull, 1},
+    {0x0b44908b63e5b53eull, 6},
+    {0x0b4aa11c1bdc5237ull, 9},
+    {0x0b59ed2d9ba39d4aull, 9},
+    {0x0b5ae00914712c05ull, 9},
+    {0x0b5ed64332e9bbfbull, 6},
+    {0x0b62be32c78d08b3ull, 8},
+    {0x0b63dad19c8d1d6cull, 10},
+    {0x0b68c40dfb13b6cfull, 9},
+    {0x0b7dd53e1a64395bull, 6},
+    {0x0b7f111f2a4dbb7dull, 7},
+    {0x0b80467713456120ull, 6},
+    {0x0b8be163a217f765ull, 6},
+    {0x0b914ba6af5bffb5ull, 0},
+    {0x0b98ef6c80e31a49ull, 10},
+    {0x0ba150105c2535baull, 4},
+    {0x0ba836a43ffbd3daull, 7},
+    {0x0baca6134bdf95fcull, 9},
+    {0x0baed79410b27858ull, 7},
+    {0x0bb06f749b3dc3b3ull, 9},
+    {0x0be08f2424d6f922ull, 7},
+    {0x0be39282945d2a1dull, 6},
+    {0x0bfd12425ef6c1e4ull, 6},
+    {0x0bff3264e2f03f5cull, 11},
+    {0x0c07b7e5788d62a2ull, 7},
+    {0x0c0baac45e2255ddull, 8},
+    {0x0c0c71710b4fc4ffull, 8},
+    {0x0c12602c13817ff1ull, 7},
+    {0x0c3fffd07b98842dull, 11},
+    {0x0c496093eff7a55bull, 6},
+    {0x0c4eeff3db9c2919ull, 8},
+    {0x0c52a2892587e2e2ull, 6},
+    {0x0c547184c0cb49d7ull, 7},
+    {0x0c583c2ba4230cf9ull, 9},
+    {0x0c67a966b46d0ba7ull, 9},
+    {0x0c693fa172cafaf2ull, 6},
+    {0x0c6a5ae78e934ddcull, 7},
+    {0x0c8da7da7a397957ull, 2},
+    {0x0c8e91fab91611b2ull, 9},
+    {0x0c92c50c535c2bf9ull, 2},
+    {0x0c9334b1277c4620ull, 6},
+    {0x0ca3b54ef27d9917ull, 1},
+    {0x0cb90fd5ffa670b5ull, 7},
+    {0x0cc20101a526654cull, 7},
+    {0x0cd49379e602e0f0ull, 6},
+    {0x0cd4e5b2a7b12c8bull, 4},
+    {0x0cdca22dfd5bb7efull, 10},
+    {0x0ceb74175f0d5b73ull, 9},
+    {0x0cf566a463483fbbull, 7},
+    {0x0d01aa3ad640737bull, 8},
+    {0x0d0d80e06c7a5d01ull, 8},
+    {0x0d13798849cc080cull, 5},
+    {0x0d1b467bfde464f1ull, 7},
+    {0x0d1d1f34dcf6cdeeull, 6},
+    {0x0d351a3751bd3763ull, 8},
+    {0x0d36657c3e14a8b4ull, 9},
+    {0x0d38caf05d37242cull, 6},
+    {0x0d3ab0ad6ded6ec1ull, 8},
+    {0x0d3ca608a5f2e543ull, 10},
+    {0x0d3fd7bc7847ac81ull, 0},
+    {0x0d444331eadd7151ull, 2},
+    {0x0d44adf69238fba4ull, 4},
+    {0x0d454b42c686858full, 8},
+    {0x0d552cd4094ebc9dull, 8},
+    {0x0d69ec515a074c63ull, 1},
+    {0x0d74a80684cc9c27ull, 7},
+    {0x0d7aef3443890967ull, 8},
+    {0x0d842a287f0374f2ull, 6},
+    {0x0d93505ae769d773ull, 7},
+    {0x0da0b76b9d34cea1ull, 6},
+    {0x0da59f90b3c6e8a4ull, 7},
+    {0x0da96c26f75a85ceull, 6},
+    {0x0dad12051754cad7ull, 10},
+    {0x0db1b418abf51a24ull, 8},
+    {0x0dbc6c146316de52ull, 6},
+    {0x0dbcbe17532f84bfull, 6},
+    {0x0dd7775d5d571897ull, 8},
+    {0x0de10c618f651eb6ull, 7},
+    {0x0de52f558b044a98ull, 6},
+    {0x0df0e7d5440c64c1ull, 9},
+    {0x0dfb2951d7c5f128ull, 2},
+    {0x0dfd314ede9ba01eull, 6},
+    {0x0e061b7857559fa2ull, 7},
+    {0x0e1387bd6c1c93ceull, 6},
+    {0x0e1ba35c57abd1afull, 8},
+    {0x0e31669bbaef7fc9ull, 6},
+    {0x0e35b98dd81e85fbull, 11},
+    {0x0e4c5cfdf2f58fc4ull, 10},
+    {0x0e569228cdeb1af4ull, 3},
+    {0x0e6207f7df3fc2caull, 8},
+    {0x0e65252e9dfedb64ull, 9},
+    {0x0e69bc539bef507eull, 6},
+    {0x0e8888fd8aa39ac8ull, 6},
+    {0x0e8ec3e04f7f7958ull, 7},
+    {0x0e8fbf5c78075ac0ull, 2},
+    {0x0e9084cbbb01028full, 6},
+    {0x0eb5af17e6b511acull, 8},
+    {0x0ebb582cc870ce34ull, 8},
+    {0x0ec82b55e84d0759ull, 9},
+    {0x0ec8b26552b88dd4ull, 6},
+    {0x0eed094907df3e88ull, 10},
+    {0x0ef2365d77bfb10cull, 6},
+    {0x0ef5b067ca4fabd7ull, 6},
+    {0x0efc8390bab6cdedull, 10},
+    {0x0f136c29ca41120cull, 9},
+    {0x0f13afd28adaefd7ull, 5},
+    {0x0f20e7896f09e23full, 6},
+    {0x0f22b4bf48435846ull, 11},
+    {0x0f2470e3c3699316ull, 0},
+    {0x0f39f6f8f530afd3ull, 1},
+    {0x0f39fb6f1db7329eull, 6},
+    {0x0f4b7cb6c2629304ull, 0},
+    {0x0f54a8796ec41928ull, 11},
+    {0x0f57a773b76d9ebbull, 7},
+    {0x0f583197ccf0121dull, 8},
+    {0x0f5b46f764043ee8ull, 0},
+    {0x0f5c7c096e8c72d8ull, 0},
+    {0x0f6b3028988d9a59ull, 8},
+    {0x0f6baf6a2b7b5f3cull, 11},
+    {0x0f71c0488883c551ull, 6},
+    {0x0f77124009fdabe4ull, 0},
+    {0x0f811496b0cdf17full, 8},
+    {0x0f875692ff0b2f46ull, 3},
+    {0x0f8d2fb02bcb958aull, 0},
+    {0x0fb1b92dc62f2e38ull, 7},
+    {0x0fb27e419edf89caull, 11},
+    {0x0fbc64333136c255ull, 6},
+    {0x0fbce662537d0a25ull, 7},
+    {0x0fbdd5582782bbccull, 7},
+    {0x0fc3bf6d6d4906a5ull, 8},
+    {0x0fc4bae032fecbabull, 6},
+    {0x0fc9f8723deed469ull, 9},
+    {0x0fcf7dde4682a823ull, 6},
+    {0x0fd80ae7d77d21b9ull, 11},
+    {0x0fe6354940c86e34ull, 9},
+    {0x0fee454b5e770a90ull, 7},
+    {0x0fef05737fac1d6full, 9},
+    {0x0ff2ab6d3d726775ull, 3},
+    {0x10077d75ffad8998ull, 11},
+    {0x10178aac0ff27a87ull, 7},
+    {0x101e937978903996ull, 8},
+    {0x101ffcfbcf9ffcd8ull, 8},
+    {0x1024ce5a01a211cbull, 1},
+    {0x104a2749905896b7ull, 8},
+    {0x10505525bc380c2bull, 6},
+    {0x105b22bed8ab566bull, 6},
+    {0x105cbcdc01714b06ull, 7},
+    {0x105d7dca96116320ull, 9},
+    {0x108e4d693cd52e19ull, 8},
+    {0x109a7e7286ce7956ull, 6},
+    {0x10a8b03d06b1e916ull, 8},
+    {0x10b02cef87716879ull, 7},
+    {0x10b676938411714aull, 11},
+    {0x10b9e12c52e2f7e4ull, 0},
+    {0x10c79014ef837d4bull, 7},
+    {0x10ca028b35de424cull, 0},
+    {0x10cc82ec3d39e5f5ull, 1},
+    {0x10d51c9790b54b63ull, 7},
+    {0x10d9544afd7b79ecull, 4},
+    {0x10dba324fb7c53abull, 8},
+    {0x10ed2e8ed302cccaull, 6},
+    {0x10f11ea9cadb22b1ull, 7},
+    {0x10f355f0a03a4973ull, 8},
+    {0x1107e4e3bad34923ull, 10},
+    {0x1122889e7e2ba2fcull, 6},
+    {0x1129a851589426a3ull, 11},
+    {0x112d5b28b1d647d5ull, 8},
+    {0x112d5f6b00df74a8ull, 7},
+    {0x1134f324653f0512ull, 10},
+    {0x114b143d4fb57ee0ull, 11},
+    {0x115d1aa518d2dcd8ull, 8},
+    {0x1184181118be527cull, 8},
+    {0x11842df07e6509a1ull, 10},
+    {0x11916c189a549cc2ull, 9},
+    {0x1195503340157eb3ull, 6},
+    {0x119a10ad93f5dbddull, 6},
+    {0x119f97b49b5f6c8bull, 9},
+    {0x11a12d9c0e38e764ull, 5},
+    {0x11bd59fba2f1d10full, 11},
+    {0x11bec1230680cdeaull, 6},
+    {0x11c40b499b4d84edull, 11},
+    {0x11cc2fa26d0fb8ddull, 0},
+    {0x120ae9ac084000bcull, 9},
+    {0x122c63cb98532f02ull, 10},
+    {0x123bb3932b6f0311ull, 11},
+    {0x1241961dbaed41f4ull, 6},
+    {0x1243cc6c2a2e1bf0ull, 7},
+    {0x125cbae2e158bb01ull, 10},
+    {0x1288349adbf1ea5dull, 6},
+    {0x128922989aae8936ull, 7},
+    {0x12915fe9e1010925ull, 10},
+    {0x12a1f748a06c3e4aull, 9},
+    {0x12ad399f00f569e9ull, 11},
+    {0x12b09d44348f2f05ull, 6},
+    {0x12ba93441e13cd71ull, 2},
+    {0x12bb9a2e0c45a743ull, 8},
+    {0x12bde674f6882719ull, 8},
+    {0x12be87c83500a48aull, 6},
+    {0x12ca7499a4ae72eeull, 2},
+    {0x12cee1f72e660f81ull, 11},
+    {0x12d0ecd7e76bf625ull, 10},
+    {0x12d3438c42354a9eull, 8},
+    {0x12d3676edfb47384ull, 6},
+    {0x12e7dbf914744fdcull, 1},
+    {0x12f08e1cb77cf994ull, 10},
+    {0x12f4989221f7284full, 1},
+    {0x12fd7a16bd629d0cull, 7},
+    {0x13180fe24cef8c6full, 7},
+    {0x131f6a7e481be033ull, 2},
+    {0x13205b1503b5d6f1ull, 0},
+    {0x13476d7ae8188f2aull, 7},
+    {0x134f3c0124426b83ull, 9},
+    {0x135c99150afda428ull, 6},
+    {0x136a0574d752927eull, 8},
+    {0x1378e9058a607fa4ull, 10},
+    {0x1386ef0c701a8c3full, 0},
+    {0x13894161a86a5ad1ull, 9},
+    {0x13a02ad460c162edull, 7},
+    {0x13a2e9f71be10cd0ull, 11},
+    {0x13a75334ecd54984ull, 2},
+    {0x13a8320ca08b6b50ull, 7},
+    {0x13bc30ad1c0d32a8ull, 9},
+    {0x13cfd1522b3349bfull, 11},
+    {0x13da65a149c5804bull, 7},
+    {0x13dc2630a97342feull, 11},
+    {0x13f52ff1b3d3653full, 9},
+    {0x13fadb64931785f1ull, 11},
+    {0x14044a14f37058b6ull, 10},
+    {0x140811c37afd6a09ull, 7},
+    {0x140c79170b5bcfe6ull, 10},
+    {0x1412cec416022847ull, 6},
+    {0x141357ed012808fcull, 8},
+    {0x1414ced66fc21aa8ull, 10},
+    {0x141c5a348db0adfeull, 8},
+    {0x1421a3defdfb11f8ull, 9},
+    {0x14352279880d7c95ull, 6},
+    {0x14353bea7318d19full, 7},
+    {0x1446ce5e2a08c59cull, 10},
+    {0x144ab37c2344f659ull, 11},
+    {0x1457bfe4fca3d57bull, 1},
+    {0x1464bcead9bf019dull, 6},
+    {0x146ac9e56dac7c28ull, 8},
+    {0x147362625e90041dull, 6},
+    {0x14752ba532e79a04ull, 10},
+    {0x147be3f0e675f7f8ull, 9},
+    {0x147e1cf087846594ull, 11},
+    {0x148612c219d143baull, 9},
+    {0x149a46bed3041ab9ull, 1},
+    {0x149d1d223ad2e9a0ull, 7},
+    {0x149e7865a7964578ull, 7},
+    {0x149f270d70304bf1ull, 10},
+    {0x14a469eddaaa9e3cull, 10},
+    {0x14ba0c356f52db16ull, 8},
+    {0x14bd41c8defa20e8ull, 9},
+    {0x14d4c9549d765167ull, 11},
+    {0x14d67dd3daa31377ull, 0},
+    {0x14f2754bbd0743e2ull, 11},
+    {0x14fb26fb849bf189ull, 6},
+    {0x1508a19f6f7e2acaull, 10},
+    {0x1508dee1cdfe30b9ull, 11},
+    {0x150c284aa00a0d19ull, 9},
+    {0x151990d1af1bf7ffull, 6},
+    {0x151e263cdcf377ccull, 6},
+    {0x1546031356042d44ull, 7},
+    {0x154618b25bbf6858ull, 7},
+    {0x154c1f2343a95a43ull, 11},
+    {0x154cf4323a090c92ull, 10},
+    {0x154e3a9df71f2c30ull, 1},
+    {0x156264725e22d8e7ull, 1},
+    {0x1566c4c44bbdd4d8ull, 6},
+    {0x157b1ffcb89faee4ull, 8},
+    {0x1596f7b0a8fc4225ull, 7},
+    {0x15a4cda05c8b45c5ull, 10},
+    {0x15a7f9543ee3172cull, 9},
+    {0x15c88cf4572df6d5ull, 8},
+    {0x15db3930e7b88061ull, 4},
+    {0x15ebe6789e3d8a0full, 11},
+    {0x15f5f4134e27cbf5ull, 6},
+    {0x160b0025ca3962abull, 7},
+    {0x1610a598953ac6edull, 11},
+    {0x161b250eecc8f432ull, 0},
+    {0x162c5562194ed4c1ull, 8},
+    {0x163125d36b9b0043ull, 0},
+    {0x1633d643923abd83ull, 11},
+    {0x16345dd38f0b3db0ull, 11},
+    {0x163a80d4b3032d1dull, 8},
+    {0x163efe46446b3577ull, 9},
+    {0x16448791e2f4a7b1ull, 6},
+    {0x1656b0d4c1f9a0b3ull, 8},
+    {0x165a66a7d917feecull, 6},
+    {0x165ed352a7dea034ull, 6},
+    {0x166245cf4a3a1b86ull, 0},
+    {0x166d06dc00d95c17ull, 6},
+    {0x166d26a878227e42ull, 8},
+    {0x1678be470fc8a6f1ull, 9},
+    {0x1681621ee1e5601dull, 7},
+    {0x168366463c1c9bf7ull, 7},
+    {0x16872d1fb0d30572ull, 1},
+    {0x168ce39bd59ef9b9ull, 6},
+    {0x168d89c2c978ad85ull, 7},
+    {0x1694597e65cd732eull, 7},
+    {0x169574bbeb991df1ull, 3},
+    {0x16b61e5d77bcc0fdull, 11},
+    {0x16bfb3e8ffb2f0f9ull, 8},
+    {0x16cb1a9ca2981d1aull, 2},
+    {0x16cbc5adabcfa402ull, 6},
+    {0x16d80f517141b23full, 10},
+    {0x16dd7b5cb8b6a506ull, 7},
+    {0x16e1c53f69156512ull, 7},
+    {0x16fcc5adeb2b61dbull, 1},
+    {0x1701bda89d2531ecull, 6},
+    {0x1719a91c3c9a9e82ull, 2},
+    {0x171df9e282958c7cull, 6},
+    {0x17207f0548ab17ccull, 11},
+    {0x1724e333aa5748eaull, 10},
+    {0x1729566e26551fb1ull, 11},
+    {0x174119eb2ba1c2dfull, 7},
+    {0x1748411641f8426dull, 0},
+    {0x1748a380ca39431aull, 10},
+    {0x175535d35239ba10ull, 9},
+    {0x176232f3b0045da6ull, 1},
+    {0x1767ffd3f5bf676aull, 7},
+    {0x1778fab6c199d339ull, 6},
+    {0x17797fddd15d6128ull, 0},
+    {0x17a05ff89ccb4caaull, 6},
+    {0x17af07eec69da303ull, 10},
+    {0x17c9748d4a3791a6ull, 8},
+    {0x17c97e803eb83148ull, 11},
+    {0x17e5418236244245ull, 8},
+    {0x17fc84a0ed1c31ebull, 1},
+    {0x1815485af4c6132full, 7},
+    {0x181b321cca1fa5f1ull, 5},
+    {0x182107c7b91c946aull, 8},
+    {0x1822852c45cd81fbull, 1},
+    {0x1828595ad992b118ull, 3},
+    {0x18326a49a7d1a966ull, 10},
+    {0x183bed2d03f9a984ull, 8},
+    {0x185702e78a4faf94ull, 3},
+    {0x1858e682a512df5bull, 6},
+    {0x186765f5d0f925a3ull, 10},
+    {0x186c61e3441262e7ull, 8},
+    {0x18893c214c807ea1ull, 7},
+    {0x188b4b7a1e26b0c3ull, 7},
+    {0x188bd3b7e5198b8dull, 7},
+    {0x188eb1a787230268ull, 9},
+    {0x18a5c8bda19c419cull, 2},
+    {0x18af66b2523c92b0ull, 9},
+    {0x18b1768b3e14e4e7ull, 9},
+    {0x18bec656505433afull, 7},
+    {0x18c3b70e9efeeddaull, 10},
+    {0x18cdecc5d5a8e048ull, 1},
+    {0x18f55843dff1a315ull, 8},
+    {0x190894109eaf9d07ull, 9},
+    {0x1919eb14266bb06bull, 6},
+    {0x191eb598f3a60805ull, 0},
+    {0x195238febb043114ull, 8},
+    {0x19555945d9425268ull, 9},
+    {0x19640ea76ad60f76ull, 6},
+    {0x196ec8f85eaa54e8ull, 8},
+    {0x197e54889e6c4d10ull, 9},
+    {0x198abc0411ae677cull, 9},
+    {0x199724331e9a80a1ull, 11},
+    {0x19a2b20b9e743c0dull, 9},
+    {0x19ad524a33d85410ull, 11},
+    {0x19d17cc4f18a7941ull, 1},
+    {0x19dafa9ed22351aeull, 9},
+    {0x19e2cfa53bc8bdd0ull, 10},
+    {0x19e8dc33edb7548full, 1},
+    {0x19f12a3980b9c0d4ull, 0},
+    {0x19fb1a65ce641d58ull, 9},
+    {0x1a0094a362205f2dull, 7},
+    {0x1a0676284c394a26ull, 10},
+    {0x1a0821d7eaa6e1bfull, 8},
+    {0x1a0c8879d6222704ull, 7},
+    {0x1a1d0aaeb996d30eull, 7},
+    {0x1a21cf487680f980ull, 6},
+    {0x1a2ee2bf3f7636aaull, 0},
+    {0x1a42fded886ec72full, 8},
+    {0x1a4664dc04b9d6f0ull, 9},
+    {0x1a5665be457cffafull, 9},
+    {0x1a599d0ec7ee5d08ull, 6},
+    {0x1a5fde8e3f7ee722ull, 6},
+    {0x1a6ae2fd14e94c6dull, 9},
+    {0x1a70522b2b181bcfull, 10},
+    {0x1a77c44073f974a6ull, 8},
+    {0x1a948589bbddc8c0ull, 7},
+    {0x1aad96a05eac8f48ull, 2},
+    {0x1ab05d3a892e143dull, 7},
+    {0x1ab07800299c1e4aull, 6},
+    {0x1ab9c21022b8aaedull, 1},
+    {0x1acc720a89471cbeull, 8},
+    {0x1acce0099e3edbf7ull, 9},
+    {0x1ad024e2b53d350aull, 6},
+    {0x1ad24f0ac3f32f89ull, 8},
+    {0x1afe8002f12f549eull, 1},
+    {0x1b0c8e01d7524b44ull, 8},
+    {0x1b0eae4e6e21c674ull, 7},
+    {0x1b1731540fc16256ull, 1},
+    {0x1b1dfb55d221d76cull, 3},
+    {0x1b2d770937c3182cull, 6},
+    {0x1b3b6fbba6fc9681ull, 2},
+    {0x1b40c2815bf3d99dull, 7},
+    {0x1b6603950c69fee8ull, 6},
+    {0x1b7b8ee35e117c1bull, 9},
+    {0x1b82ec3cc7bba9d1ull, 9},
+    {0x1b9f78997cbcea2cull, 7},
+    {0x1baed43335ecaf7full, 0},
+    {0x1bd7e2fd9d30af0bull, 11},
+    {0x1bde76bfed510484ull, 7},
+    {0x1be1937cdf471a5dull, 8},
+    {0x1bf4aea15b309b00ull, 11},
+    {0x1bf4f2a591ce0c69ull, 6},
+    {0x1bf6d233dc119aeeull, 10},
+    {0x1bf8397ac8b8f307ull, 0},
+    {0x1bfcf3b7f8ae768dull, 7},
+    {0x1c07f207f08de0cdull, 6},
+    {0x1c1c72a69a724af9ull, 10},
+    {0x1c254e8f1da31085ull, 9},
+    {0x1c376a264ea1ca6full, 6},
+    {0x1c50f333a294cb88ull, 10},
+    {0x1c6b4775bbf01d8cull, 8},
+    {0x1c71cb673fd8676dull, 9},
+    {0x1c7e80f0c634dad6ull, 6},
+    {0x1c82372f3139ac62ull, 10},
+    {0x1c8e7f72ad5f8959ull, 8},
+    {0x1c924c5c34a21a94ull, 8},
+    {0x1c9533a09bfd0ac4ull, 6},
+    {0x1c963af33c5e848eull, 0},
+    {0x1c9bb9ac30d6cd4cull, 8},
+    {0x1c9f5a52e2e50ed2ull, 8},
+    {0x1cac32263005e312ull, 8},
+    {0x1cb2689cb9b2caa7ull, 1},
+    {0x1cb2d799b645c94full, 6},
+    {0x1cb4625c4b831b23ull, 10},
+    {0x1cc5bb04a5666aa1ull, 11},
+    {0x1ccfd6631148c1b5ull, 5},
+    {0x1cd666ce07eff15full, 9},
+    {0x1ce1cdc6ea6e120full, 8},
+    {0x1ce25685ab1e8cdaull, 9},
+    {0x1cec08a1a13575f6ull, 8},
+    {0x1cefab331923b4d7ull, 4},
+    {0x1cf1d10f6db98f54ull, 11},
+    {0x1cf5fc9529f8973eull, 7},
+    {0x1cfa3fb1284a5e5eull, 3},
+    {0x1d059501e21171b6ull, 6},
+    {0x1d0b39b9a887c7faull, 0},
+    {0x1d1c0c797f5588c1ull, 7},
+    {0x1d305dec267cbc70ull, 6},
+    {0x1d3c732eec2a5955ull, 0},
+    {0x1d49cdb8bcbb2d03ull, 6},
+    {0x1d52d8a2ce18fc9dull, 6},
+    {0x1d58a7f677b47e88ull, 7},
+    {0x1d5be5e84b52e39dull, 7},
+    {0x1d6031d51ddf6b8cull, 7},
+    {0x1d65be80798bbccdull, 8},
+    {0x1d8b8a0f540c3b8bull, 8},
+    {0x1d8e335e0e0f148aull, 1},
+    {0x1d91f193257e99ddull, 6},
+    {0x1d941bb611c1af21ull, 0},
+    {0x1da0ac09894cdf86ull, 8},
+    {0x1da18b9aefc3233aull, 8},
+    {0x1dcb7b8df1e7e887ull, 9},
+    {0x1e1468fe5e8ca84full, 7},
+    {0x1e1e87261d6a5726ull, 7},
+    {0x1e21f22c943309dcull, 6},
+    {0x1e2fe1a1771c7d07ull, 1},
+    {0x1e413ea1798e4cb2ull, 7},
+    {0x1e46ba7cb11ddcfdull, 8},
+    {0x1e77da401ef150e4ull, 7},
+    {0x1e8c175e686b0505ull, 6},
+    {0x1e9d3a2359882e7cull, 8},
+    {0x1e9d5a43fd338851ull, 8},
+    {0x1ea99c87e753134eull, 6},
+    {0x1ead54bbd38ec56eull, 6},
+    {0x1ebb634fc270993full, 10},
+    {0x1ed51d97400188d2ull, 10},
+    {0x1ed94ffe7d5105c7ull, 2},
+    {0x1ee05b2f4f078b72ull, 6},
+    {0x1eea011695a5928full, 7},
+    {0x1eea396d43eff822ull, 0},
+    {0x1eee12df7211a5bbull, 6},
+    {0x1f0a16fd69f6713eull, 6},
+    {0x1f0ee620c2cd984aull, 6},
+    {0x1f13ab4fd7244f3eull, 11},
+    {0x1f2558e96e1df1c5ull, 11},
+    {0x1f2dbdaf5e2871c4ull, 10},
+    {0x1f319c6321123a78ull, 10},
+    {0x1f37b7a0d16fc13bull, 10},
+    {0x1f38977824a21c77ull, 6},
+    {0x1f44626abf9ef6f3ull, 6},
+    {0x1f45ddd770eb14e2ull, 0},
+    {0x1f5ff8e9e7e85bfbull, 6},
+    {0x1f6a82ca954b4be6ull, 11},
+    {0x1f74007476027dedull, 2},
+    {0x1f769c7c23309db6ull, 5},
+    {0x1f816a98863a3cd6ull, 7},
+    {0x1f959401b5212b1dull, 1},
+    {0x1f96c08804dc2732ull, 9},
+    {0x1f987bac8db43cdbull, 7},
+    {0x1fb0560845a1f0d7ull, 3},
+    {0x1fbeb56487de37a0ull, 6},
+    {0x1fc506c2957360b1ull, 9},
+    {0x1feeb23dd52e1889ull, 10},
+    {0x1fef2fa19f1466a4ull, 8},
+    {0x1ff6d7893d9084d9ull, 7},
+    {0x1ffbb4fccf61015cull, 6},
+    {0x2028ed2c7ef49ca0ull, 6},
+    {0x2029dfd822ee91b0ull, 7},
+    {0x202ad11e49537927ull, 3},
+    {0x202b272d80a79882ull, 7},
+    {0x20337c4ec5279272ull, 6},
+    {0x20364d9579c4bb93ull, 6},
+    {0x203da283cc0d13faull, 8},
+    {0x20473ff007efbcf7ull, 8},
+    {0x205d6b3342c5bb72ull, 7},
+    {0x20601485d44812b3ull, 6},
+    {0x20617fb4ba9fff72ull, 7},
+    {0x20682b7d32715fefull, 6},
+    {0x206e8f5074bf1c4full, 7},
+    {0x2072c3e48098bde8ull, 7},
+    {0x20899d5e39046151ull, 11},
+    {0x208c4d901843a3c4ull, 10},
+    {0x208c7ab305dd9d82ull, 10},
+    {0x208e3657c2cdcfa7ull, 0},
+    {0x209c6c28a13bbdc2ull, 7},
+    {0x20a092ef3299db52ull, 9},
+    {0x20a832ac5cf8f962ull, 9},
+    {0x20b61240ca8752c0ull, 1},
+    {0x20cbb982d8ea65c3ull, 6},
+    {0x20cec880c34c6443ull, 7},
+    {0x20d2d4e6d99e8795ull, 2},
+    {0x20d4ea7596a527a3ull, 11},
+    {0x20dc0cc76fe35dfbull, 7},
+    {0x20e2efc09e68736dull, 7},
+    {0x20f6e24fb37da3f8ull, 6},
+    {0x20fb8b995263b4c4ull, 8},
+    {0x20fcdb562d4bc621ull, 11},
+    {0x20fe50f4028e2183ull, 10},
+    {0x210eb62d2afed264ull, 8},
+    {0x210f3e4407e3a100ull, 6},
+    {0x21198e8e52274d17ull, 8},
+    {0x211ea4a372081510ull, 7},
+    {0x213386ad57434c4full, 7},
+    {0x215732c6516830c1ull, 7},
+    {0x215dc4dcbbfa4cd8ull, 7},
+    {0x215edccc9f8d9bb2ull, 10},
+    {0x216c8a725e32495bull, 6},
+    {0x217aaa65dc34e6c7ull, 7},
+    {0x219a4fda7cd40839ull, 0},
+    {0x219c74c9187ce0d8ull, 9},
+    {0x219fc89915a281deull, 7},
+    {0x21a3e97130a342c6ull, 6},
+    {0x21b21a37dc6868b2ull, 6},
+    {0x21b2bf14403219e8ull, 1},
+    {0x21bf498435704087ull, 11},
+    {0x21d1195412c8babdull, 8},
+    {0x21d6ad67d22ca29bull, 9},
+    {0x21dc5442076f87e8ull, 7},
+    {0x21df1d1ff06f0fa2ull, 7},
+    {0x21e937aed70f6b45ull, 6},
+    {0x21f48c9c37c6f96eull, 7},
+    {0x21f6393c7f93e439ull, 7},
+    {0x21fba53e29d91daaull, 11},
+    {0x220aa7af12ff5974ull, 9},
+    {0x2218287644557af5ull, 11},
+    {0x2219f465545bd17bull, 6},
+    {0x221bb5c6378e6b29ull, 0},
+    {0x224e6f2ab4dfebaaull, 8},
+    {0x2257deaa86a1cafbull, 7},
+    {0x225ddc14150c4794ull, 8},
+    {0x22606c336f249f8eull, 10},
+    {0x2272f06caf8895f2ull, 7},
+    {0x2288578151be7587ull, 6},
+    {0x22889df3238864f0ull, 1},
+    {0x229320fcd44987f7ull, 8},
+    {0x229bde98160b0363ull, 1},
+    {0x22a23b6a7dee0973ull, 9},
+    {0x22a58f59bd0a1155ull, 8},
+    {0x22c142044011f159ull, 7},
+    {0x22c88207b473fbfbull, 6},
+    {0x22e204bed777c785ull, 11},
+    {0x22eaffde9a364152ull, 6},
+    {0x231a195ddb7db7a7ull, 11},
+    {0x23330a91453ee120ull, 5},
+    {0x2343786cee650d7cull, 1},
+    {0x23573d0a01bf82c6ull, 7},
+    {0x235da919fd4f4902ull, 6},
+    {0x2374c202ee809cf6ull, 8},
+    {0x2380d63a4a2732c3ull, 2},
+    {0x238f1d94fda11f2cull, 11},
+    {0x239a899954bcc01full, 9},
+    {0x23a91a6aa35f5ba6ull, 10},
+    {0x23aa919eeef5851bull, 6},
+    {0x23d5c24e9bca6373ull, 8},
+    {0x23e1cf9f4047baa8ull, 6},
+    {0x23e5553f8b38e559ull, 3},
+    {0x23f6ce15de7b9186ull, 10},
+    {0x23f8ecbeaa1f366aull, 10},
+    {0x24328262e9a13e41ull, 8},
+    {0x243720ffe6cf9a86ull, 11},
+    {0x2443dcbc0b6a990bull, 2},
+    {0x2449fdd7d6a6e3abull, 10},
+    {0x24588490ac3fa6a2ull, 0},
+    {0x24621b5c6d686d41ull, 8},
+    {0x24644e85c7422abfull, 6},
+    {0x24650ec44accadb8ull, 11},
+    {0x2467d9a2b417757eull, 4},
+    {0x246f835b81069abcull, 5},
+    {0x24758c083c4c604bull, 9},
+    {0x248248be7b60ac80ull, 6},
+    {0x24aef02c3d65b98dull, 10},
+    {0x24b3b31c36b6109bull, 6},
+    {0x24d2ced128282159ull, 10},
+    {0x24ea14c8f4fd467cull, 8},
+    {0x24f473e43115c5d2ull, 7},
+    {0x24f9b219b6581395ull, 7},
+    {0x24fd1598ae4bf291ull, 6},
+    {0x250d27b1fedac97dull, 6},
+    {0x251009ceaadbd206ull, 8},
+    {0x251af70bfbad826dull, 10},
+    {0x251d7dd8d639caaaull, 8},
+    {0x25217c97c0e3071cull, 1},
+    {0x2525f4ff6eda7fa8ull, 10},
+    {0x2539209e270dc902ull, 10},
+    {0x2550b09b0cc87c8bull, 9},
+    {0x2557fd66bd608775ull, 6},
+    {0x256ca50e0ddabdf1ull, 7},
+    {0x2577b7ed013646daull, 4},
+    {0x25792edd03d31245ull, 6},
+    {0x25854acc93d307f8ull, 9},
+    {0x2591fb06ce205776ull, 8},
+    {0x2594c78a723382b1ull, 7},
+    {0x259aabe7fd30f766ull, 7},
+    {0x25a8d65a71149048ull, 8},
+    {0x25b0a6c32df1a3adull, 7},
+    {0x25b0d43d9549d33cull, 7},
+    {0x25b55323b467c161ull, 6},
+    {0x25ba4eb72e918918ull, 1},
+    {0x25bb22e9368a1807ull, 8},
+    {0x25d4a9f2b957d44dull, 8},
+    {0x25d970d750f35e2dull, 8},
+    {0x25eafae59447a9bcull, 7},
+    {0x25f0f681cf1ea15dull, 6},
+    {0x25f3fee3590f1057ull, 7},
+    {0x25f560dae71e12feull, 9},
+    {0x260cc9510a1f5918ull, 11},
+    {0x261392f7c75fcf4bull, 9},
+    {0x261a5673288204cbull, 8},
+    {0x261d5890ed2603beull, 2},
+    {0x261d5aebc17ca7f8ull, 6},
+    {0x262485de9805cdc5ull, 6},
+    {0x262ee5969d2b86f7ull, 9},
+    {0x2630cece23de426eull, 7},
+    {0x264858b28d74710full, 11},
+    {0x2650ef73e9eda441ull, 10},
+    {0x266d4a4bb91b3591ull, 7},
+    {0x267386bb74a48324ull, 2},
+    {0x2678a6fe80258be7ull, 6},
+    {0x2688b1de2f3904ebull, 11},
+    {0x26940d73e81491bcull, 11},
+    {0x269ccfe8b0446041ull, 8},
+    {0x269e32bf3d483543ull, 6},
+    {0x26ab9082c159e363ull, 7},
+    {0x26ae094911b8e74aull, 7},
+    {0x26b2767f63ce826eull, 8},
+    {0x26b303546be1259dull, 7},
+    {0x26b44349b2277896ull, 6},
+    {0x26b7495b46bd9913ull, 9},
+    {0x26bdc901af9c64d7ull, 0},
+    {0x26c2a8ef5094a822ull, 6},
+    {0x26c87e899c9d39d1ull, 9},
+    {0x26cb066b05d88589ull, 9},
+    {0x26cb42fbe6aa11f0ull, 9},
+    {0x26cc809acee346c0ull, 9},
+    {0x26cf46b5ec13d4d8ull, 8},
+    {0x26d4d5113dcf7d57ull, 6},
+    {0x26f1b3974fd379ebull, 7},
+    {0x26f4584feea8c2e1ull, 1},
+    {0x26fa32b1dc6536ddull, 3},
+    {0x2701d7a91cfe4c24ull, 8},
+    {0x2702f4befe2844e2ull, 7},
+    {0x271833745d02d275ull, 7},
+    {0x27228525d9568795ull, 8},
+    {0x272cb965e0b72c17ull, 11},
+    {0x273656efd5c53e4bull, 6},
+    {0x27416ea359893203ull, 6},
+    {0x274e72248c51aa31ull, 11},
+    {0x277729b28f73985cull, 9},
+    {0x2777da6e6e639ec0ull, 7},
+    {0x277a1f092538f939ull, 8},
+    {0x2786664034fccd15ull, 7},
+    {0x2786b5f419117d99ull, 1},
+    {0x2792f818f925f68cull, 1},
+    {0x27a4494f4bbb3df6ull, 11},
+    {0x27bfc8d974d016a4ull, 0},
+    {0x27d5d0877bb3ff4dull, 9},
+    {0x27f02eb9258ebf22ull, 5},
+    {0x27f1798d733f4e10ull, 10},
+    {0x28060beb80207aa0ull, 6},
+    {0x280af3daa7ca9408ull, 7},
+    {0x281c3635fa39c857ull, 5},
+    {0x281d8479e08d7f7bull, 7},
+    {0x2823131809b0e7aaull, 10},
+    {0x28267bdb073c6dfeull, 8},
+    {0x283e6cdb7a5411bdull, 10},
+    {0x2842b9f546d4b93cull, 11},
+    {0x2842f6482a92e1e5ull, 9},
+    {0x28471f50ee6e9a34ull, 3},
+    {0x284cf44c2191118aull, 10},
+    {0x2857b85be98896c6ull, 10},
+    {0x2858ae1e74c2038aull, 10},
+    {0x285aafa15d097de4ull, 10},
+    {0x285c366bff0acc92ull, 6},
+    {0x286b73a56cfb4038ull, 11},
+    {0x286de3821d5b4b58ull, 6},
+    {0x287bc266dcf2871aull, 6},
+    {0x288383ddbb82c132ull, 9},
+    {0x2883dd4e00d9dba7ull, 2},
+    {0x288cbab21fb28758ull, 6},
+    {0x28a6153a1c05b299ull, 7},
+    {0x28a8b85eb70d378dull, 10},
+    {0x28ad6eb4882fb427ull, 2},
+    {0x28b4eed7d7c5b673ull, 4},
+    {0x28c814a318d4947full, 6},
+    {0x28e6cdcd92c0035bull, 6},
+    {0x28ea0c591a64beeeull, 11},
+    {0x28ee76639a251671ull, 10},
+    {0x28f5f2a4dabd8788ull, 7},
+    {0x290f88622da6ea77ull, 7},
+    {0x29168d4e7bb1caacull, 6},
+    {0x2925f79d66e9322bull, 9},
+    {0x292a1b6843416c9cull, 9},
+    {0x292c29149f8681dcull, 2},
+    {0x293c943a7eca970full, 10},
+    {0x2961bffbc4d2206eull, 6},
+    {0x296c12c08f07d5d8ull, 8},
+    {0x296c7b4f28ebba3cull, 7},
+    {0x296d476cc083f40dull, 10},
+    {0x2971f392c45a2329ull, 3},
+    {0x297a430de8c0eda0ull, 6},
+    {0x2987979fedd814d4ull, 9},
+    {0x2989c2b9857f46e4ull, 7},
+    {0x298d864defb9a39cull, 9},
+    {0x2994107650d3ad8cull, 6},
+    {0x29996fb4d9d48f44ull, 1},
+    {0x29bc776584ff1243ull, 6},
+    {0x29c35e3af9d72299ull, 6},
+    {0x29c39fc200da83b2ull, 9},
+    {0x29c899048dab4111ull, 7},
+    {0x29cb6be19d4a1ed0ull, 7},
+    {0x29cf0a5ea0ec6019ull, 9},
+    {0x29d7f8aef8f22991ull, 8},
+    {0x29e0129862fe176aull, 10},
+    {0x29e4488d0cf791e9ull, 11},
+    {0x29e6620a29fb3745ull, 6},
+    {0x29e7d6ccddcf267cull, 11},
+    {0x29ed10a42b38c576ull, 10},
+    {0x29f1b4ce20309b88ull, 0},
+    {0x29f6b6ca8af9d261ull, 7},
+    {0x29f6ec1b6130b512ull, 9},
+    {0x29fb00ad5434b89eull, 7},
+    {0x29fe271383c11717ull, 8},
+    {0x29ff8eb997cc58e8ull, 0},
+    {0x2a005295b41a4e45ull, 8},
+    {0x2a09ec04245169d7ull, 6},
+    {0x2a0b9401c7d8e818ull, 11},
+    {0x2a0fc1b8725abfafull, 11},
+    {0x2a12650a4eeff0e0ull, 6},
+    {0x2a133e2fded1f5ddull, 8},
+    {0x2a1e09f525c76806ull, 11},
+    {0x2a26161e41896824ull, 6},
+    {0x2a2a29c0b06f47baull, 4},
+    {0x2a3a81ebb20e1bb5ull, 10},
+    {0x2a426fb91b6e5599ull, 9},
+    {0x2a432560e7def31cull, 1},
+    {0x2a4a3a47f39534ffull, 10},
+    {0x2a6089788de45d1bull, 8},
+    {0x2a721b9c4d0fad60ull, 5},
+    {0x2a8faf83dbaa92a8ull, 7},
+    {0x2a90de80a3353a01ull, 11},
+    {0x2a94d55ca10bf997ull, 9},
+    {0x2aac2183b74279b5ull, 6},
+    {0x2ab12894882a4d60ull, 7},
+    {0x2ac2f93ca8122950ull, 11},
+    {0x2ac732ecbf2f6d25ull, 6},
+    {0x2ac9d3f45d5d6d8aull, 7},
+    {0x2ae72352f1c1218cull, 11},
+    {0x2aea6b3cd0e08e2dull, 7},
+    {0x2b0b7cf55edbb6b7ull, 10},
+    {0x2b0d011d13c7ba5dull, 10},
+    {0x2b113cd063a34754ull, 6},
+    {0x2b12776a4bd37002ull, 7},
+    {0x2b1a58278aa93486ull, 8},
+    {0x2b1f7da693082dfbull, 7},
+    {0x2b209b595bb092faull, 8},
+    {0x2b277a942303f9e1ull, 7},
+    {0x2b2a609178b722b1ull, 1},
+    {0x2b3862418e53ba62ull, 8},
+    {0x2b3898c3886064d1ull, 6},
+    {0x2b3efe8312a3d379ull, 10},
+    {0x2b4b3ef6ffd81e1cull, 0},
+    {0x2b59ce74717055c9ull, 6},
+    {0x2b5b0fa4d1854bebull, 7},
+    {0x2b7552f4b3f94531ull, 10},
+    {0x2b78775e383d497aull, 0},
+    {0x2b8789a21fca2b98ull, 11},
+    {0x2b904247cf9807abull, 8},
+    {0x2b95d4888b033b5bull, 6},
+    {0x2b99fe5d2401410bull, 8},
+    {0x2b9bbd7ec687a4efull, 8},
+    {0x2ba0e219fa8cb82eull, 7},
+    {0x2bc57c9761b99d62ull, 7},
+    {0x2bd744ee4f697817ull, 2},
+    {0x2bdbe12f17babeebull, 6},
+    {0x2bef2aceef3f1934ull, 0},
+    {0x2c019525e36935cbull, 5},
+    {0x2c071aa6a5724b26ull, 11},
+    {0x2c0bcac3b6b58f10ull, 3},
+    {0x2c23654d30e2e8bfull, 6},
+    {0x2c34a3bb0bba8ac9ull, 1},
+    {0x2c36e672ad1a34fbull, 7},
+    {0x2c49bd11f1a9d9c8ull, 11},
+    {0x2c4be9d908c16a0aull, 7},
+    {0x2c4e3efaed5896b2ull, 7},
+    {0x2c543c2ea90ecfa8ull, 11},
+    {0x2c5957e72325a369ull, 7},
+    {0x2c79c686ab5aa542ull, 1},
+    {0x2c86ab4588499903ull, 11},
+    {0x2c9b2e3c29c946a1ull, 8},
+    {0x2c9ff31e9e1fb1e3ull, 7},
+    {0x2cb7737ea5dc7298ull, 7},
+    {0x2cd13cb045a08918ull, 8},
+    {0x2ce2512545e1f40aull, 7},
+    {0x2ce4536062e1e0bdull, 1},
+    {0x2cef5f8433cbdd11ull, 8},
+    {0x2cfefa18cb7b5519ull, 7},
+    {0x2d20626d63b25d67ull, 8},
+    {0x2d335d6442800a9aull, 0},
+    {0x2d3a83edbbefb96dull, 9},
+    {0x2d3be356368b8bd8ull, 10},
+    {0x2d3d9a5eb61899b1ull, 6},
+    {0x2d4d1d51e6a33ecaull, 8},
+    {0x2d4e9cf8632c10d6ull, 8},
+    {0x2d55312a85983c35ull, 7},
+    {0x2d5f7a7412b0c1a3ull, 8},
+    {0x2d628a19d96e0a44ull, 9},
+    {0x2d66b7c4973c472aull, 7},
+    {0x2d6dbc9683f66048ull, 8},
+    {0x2d76b202a6ebc12eull, 6},
+    {0x2d7d01bfd6e8c254ull, 10},
+    {0x2d85e2fc0fe5c475ull, 7},
+    {0x2d90886c8301e6bdull, 0},
+    {0x2dcadfed0870eccdull, 11},
+    {0x2dfc51fbdfa45a77ull, 6},
+    {0x2e1030bac23de780ull, 7},
+    {0x2e1268cf0152bec8ull, 10},
+    {0x2e2a870cfd0f5d2eull, 6},
+    {0x2e2a9d926f2dba06ull, 10},
+    {0x2e37ed3c748a357full, 10},
+    {0x2e38150a758c7a01ull, 11},
+    {0x2e3a0af5cceebb3eull, 8},
+    {0x2e49b497091f7f64ull, 10},
+    {0x2e50972259aabc0cull, 6},
+    {0x2e562c94ad04e5a2ull, 7},
+    {0x2e5853031c5df410ull, 11},
+    {0x2e593a226590a6b3ull, 11},
+    {0x2e5d7239a184e51cull, 6},
+    {0x2e61b142c7154ca7ull, 6},
+    {0x2e64835f341bc11dull, 3},
+    {0x2e6a34ce539e369dull, 8},
+    {0x2e6d1e35633908b1ull, 1},
+    {0x2e7d8112a6936deeull, 6},
+    {0x2e8643fb31ad1e3aull, 8},
+    {0x2e8671c925bf7b10ull, 6},
+    {0x2eade0633322a94dull, 7},
+    {0x2eaef7275ce4dafbull, 7},
+    {0x2eaf4bf1bf152a77ull, 11},
+    {0x2ec42ea9950ab87eull, 11},
+    {0x2ec6878bee125cd6ull, 10},
+    {0x2ee8f438a9357084ull, 10},
+    {0x2eee3e49065aad5bull, 6},
+    {0x2ef1f46fc39325e1ull, 2},
+    {0x2f04d91d96ed2263ull, 6},
+    {0x2f06964d059953efull, 11},
+    {0x2f0c7e86d0666a04ull, 11},
+    {0x2f16ed6c64eecccaull, 11},
+    {0x2f1b467e41fe56c1ull, 0},
+    {0x2f20b337924a9c03ull, 7},
+    {0x2f25e6266d4e6164ull, 11},
+    {0x2f343d808a65b48aull, 7},
+    {0x2f45fca4cac67a0aull, 7},
+    {0x2f553238aa757832ull, 6},
+    {0x2f5ab3d9ff5d51efull, 11},
+    {0x2f5b0bc3b3b4a6ddull, 11},
+    {0x2f83d2075c2ada3full, 6},
+    {0x2f8684201c799badull, 8},
+    {0x2f8e7fd2512c1b6bull, 6},
+    {0x2fba8935ff9568d6ull, 7},
+    {0x2fc210f2a52e2164ull, 3},
+    {0x2fccc6bee6c5534eull, 2},
+    {0x2fceaf8d0307ed00ull, 8},
+    {0x2fd2ef4dd155c761ull, 8},
+    {0x2fd95693aa89c44bull, 8},
+    {0x2ff3e296ece4bd61ull, 10},
+    {0x2ff73da6ba4817f7ull, 8},
+    {0x30010ef0eb648db1ull, 6},
+    {0x300844d9618cd7c9ull, 11},
+    {0x300b22f26d061fe5ull, 7},
+    {0x300d6bbb835b6e48ull, 10},
+    {0x30124e47449dce24ull, 10},
+    {0x30213ff0805aea8dull, 0},
+    {0x3040b81e80a3d09cull, 6},
+    {0x304d4e4f9a538fb9ull, 9},
+    {0x305614a5c9f30732ull, 8},
+    {0x305dfdac97c42bbbull, 11},
+    {0x30653cb9fddb8cecull, 11},
+    {0x3077eaae2351384eull, 7},
+    {0x3079a2840e2c2f1aull, 6},
+    {0x30828ebeb5b64ff8ull, 0},
+    {0x3082e68f97aedb93ull, 7},
+    {0x30832bff6ce3a28eull, 6},
+    {0x308b68f841d73066ull, 2},
+    {0x309ca1207e99a50aull, 7},
+    {0x309cd3e0aba59c1eull, 8},
+    {0x309cf7134a9703afull, 11},
+    {0x30a3e9672b24ae69ull, 6},
+    {0x30b70f950c6f582dull, 8},
+    {0x30b98322e8217412ull, 10},
+    {0x30c5a314e90611c7ull, 8},
+    {0x30d66370002055cdull, 10},
+    {0x30d6f3a8ec60fd8bull, 6},
+    {0x30ec632f5e60adb5ull, 6},
+    {0x30fbbd408a831ea4ull, 7},
+    {0x30fc0ab5304da89eull, 4},
+    {0x310af96f26d8501eull, 7},
+    {0x31171b836d398552ull, 7},
+    {0x312380dce4818337ull, 6},
+    {0x312a1188c71aba60ull, 0},
+    {0x312e36a6d4dbcbdbull, 6},
+    {0x3145949448ab4ed6ull, 4},
+    {0x31737242954f8bb4ull, 7},
+    {0x3179529d1405630cull, 10},
+    {0x3192c75f1bacb64full, 6},
+    {0x31962dab32401ab6ull, 0},
+    {0x31a368ba3e2ec571ull, 10},
+    {0x31a53d639404828full, 10},
+    {0x31b4acfc551fd666ull, 8},
+    {0x31ce86fd9d90363cull, 1},
+    {0x31d3caec9979db6dull, 10},
+    {0x31d65119817543c3ull, 8},
+    {0x31e849129c0c33b6ull, 10},
+    {0x31e86185015a4f6dull, 6},
+    {0x31ea2c5ff7b641e9ull, 9},
+    {0x31f5b45c53addb2full, 6},
+    {0x3208a2c384a88f56ull, 11},
+    {0x320c12de9d42f139ull, 6},
+    {0x321632568348c0d7ull, 0},
+    {0x321add812b2ee03bull, 10},
+    {0x3222105528bcdb5eull, 6},
+    {0x32237284fe493f6bull, 7},
+    {0x323286da87ef2cfdull, 8},
+    {0x3239019d3758f62full, 6},
+    {0x324c0e5c283b766dull, 2},
+    {0x324fb4bc4ada4aa6ull, 11},
+    {0x32654872ebf6ff31ull, 6},
+    {0x32689f0e66ea8b27ull, 6},
+    {0x3275f1b52ddbddfdull, 6},
+    {0x327e21cf6118148full, 7},
+    {0x32b79d090f1f74beull, 8},
+    {0x32bc8b644f31b7ffull, 11},
+    {0x32c50aee1946acbdull, 1},
+    {0x32c52f0c699579a7ull, 6},
+    {0x32cddc8906dbb001ull, 0},
+    {0x32d45eb1716fc251ull, 11},
+    {0x32e0d0c646ee487bull, 1},
+    {0x32e373f62ea5312eull, 11},
+    {0x32fe56af0252c958ull, 6},
+    {0x33080981a33b0515ull, 11},
+    {0x330ab7323615519eull, 11},
+    {0x33167b2d829ecab5ull, 2},
+    {0x331ab047a47b1e3aull, 6},
+    {0x3330717b8a6f6bcaull, 10},
+    {0x33367ee9c077c28eull, 10},
+    {0x333ab6acdae2f7abull, 9},
+    {0x3358dc9d86c6f42dull, 8},
+    {0x3363bfd2a0770537ull, 8},
+    {0x336413f9844d6ff3ull, 8},
+    {0x3366d84aeb5f65ccull, 10},
+    {0x33712be62bb211e4ull, 8},
+    {0x33749a5d65a7436dull, 8},
+    {0x33796dd3ca93a1d4ull, 8},
+    {0x338159e78dc593e3ull, 6},
+    {0x33af851ba35e3099ull, 11},
+    {0x33afe95001ba3583ull, 2},
+    {0x33b0ab83c40f0fe6ull, 2},
+    {0x33b9a6669b37422aull, 2},
+    {0x33c7693d25fa4b20ull, 4},
+    {0x33c7fca6274ade91ull, 11},
+    {0x33ca43b62b85cf38ull, 7},
+    {0x33ca9c82edbdb4f2ull, 9},
+    {0x33cbebbedf48df2full, 8},
+    {0x33dd3b6bc11c581dull, 6},
+    {0x33e576b2624c96e0ull, 6},
+    {0x33e8611ee555a847ull, 7},
+    {0x33eec9bc49f00e37ull, 6},
+    {0x3403d4af416db955ull, 6},
+    {0x3409c572255b4edaull, 8},
+    {0x341248569784db98ull, 11},
+    {0x34133b84be55d47bull, 8},
+    {0x3413eacaaf3fafc6ull, 6},
+    {0x34141d8f3dae9c66ull, 11},
+    {0x3414d7a58c2bc09full, 5},
+    {0x3422efb5f5c0639dull, 11},
+    {0x3429bbda0eeb1790ull, 1},
+    {0x342f684f2c61af72ull, 7},
+    {0x34310cae910e0a73ull, 0},
+    {0x3432bdd051ce614aull, 10},
+    {0x3442bfc98a22d913ull, 3},
+    {0x345132b9cb88b3dbull, 9},
+    {0x345fa739039dc073ull, 7},
+    {0x3470badee4dc06f3ull, 11},
+    {0x3480a6dd121724bdull, 5},
+    {0x3485a608f12c70eaull, 7},
+    {0x3495ecf769bfaaedull, 6},
+    {0x34a569c7ed4fdae7ull, 8},
+    {0x34ad3f76b2cea4f6ull, 4},
+    {0x34be8f1cf3fba010ull, 11},
+    {0x34caff69d9d93dd1ull, 10},
+    {0x34ccee604dffac25ull, 6},
+    {0x34d27fe88647eb0aull, 8},
+    {0x34d2fa4342cf1b0aull, 4},
+    {0x34de1ab41feb2861ull, 7},
+    {0x34e3c2d35ad1c240ull, 7},
+    {0x34eb8f3c37a20d0full, 7},
+    {0x34f78129b266e02aull, 10},
+    {0x34f8976c2f2c7566ull, 10},
+    {0x34f999633d8965e0ull, 7},
+    {0x34fc0762157e4b0cull, 7},
+    {0x34fc6c2443408192ull, 9},
+    {0x350622d77c5ce797ull, 10},
+    {0x350b391f03106eb1ull, 1},
+    {0x35195abe5c7442f1ull, 11},
+    {0x3533c6633e04c57aull, 10},
+    {0x3536c7069e6b3427ull, 11},
+    {0x354113a20cd9bfaaull, 3},
+    {0x354b4e9e574d0590ull, 6},
+    {0x35568fb8d117a48dull, 10},
+    {0x356a7e0eeab23a73ull, 6},
+    {0x3572500c2c75eaf0ull, 8},
+    {0x357ee5c9ca92d897ull, 6},
+    {0x3582ca70ba986b88ull, 7},
+    {0x3585a1fddc86a9dbull, 6},
+    {0x358a6d70747172dcull, 7},
+    {0x35958ec5bceff891ull, 9},
+    {0x35a7f9cd6154cc04ull, 11},
+    {0x35a9418c9fbe0bf1ull, 1},
+    {0x35abf50f0e030884ull, 7},
+    {0x35ac0930df94e857ull, 6},
+    {0x35c724ed07896e5cull, 11},
+    {0x35cb5f3de66a0b25ull, 8},
+    {0x35d276d243f8cc37ull, 8},
+    {0x35d38fa98baf4680ull, 11},
+    {0x35e496dc6c7e60e1ull, 8},
+    {0x35e5e6bf52ef33e4ull, 10},
+    {0x35e9a28f0d3c0a72ull, 10},
+    {0x35eb344ed64f1bd4ull, 6},
+    {0x35fb8c928f34bb28ull, 11},
+    {0x35fcdf3c0b7f3f92ull, 7},
+    {0x35ff059d8b65ecedull, 8},
+    {0x360dbea0c6a1a6c1ull, 8},
+    {0x36167fceece39a04ull, 8},
+    {0x36251a928da490d5ull, 11},
+    {0x362e12b8ac9b08c6ull, 3},
+    {0x3631e7ff505f5e2eull, 0},
+    {0x363af77c277db1c9ull, 2},
+    {0x364517ee774f77f0ull, 6},
+    {0x36506bdd45ad6b3dull, 8},
+    {0x36589865aa9d8613ull, 6},
+    {0x365c4f80af61cfbeull, 2},
+    {0x366256db88757c4dull, 8},
+    {0x366dccb3f3b6e919ull, 11},
+    {0x3673dd2f2e8f3125ull, 6},
+    {0x3692789ef45fcf93ull, 10},
+    {0x369418f65308468eull, 7},
+    {0x3694453b2d0e7d01ull, 6},
+    {0x36a46b27c2e52c45ull, 8},
+    {0x36a91380b7d13563ull, 6},
+    {0x36acc60c2ee5c10dull, 11},
+    {0x36bfc93049a8a0cdull, 8},
+    {0x36d2a8f9dbdd3b47ull, 3},
+    {0x36df6302a1c1a36cull, 6},
+    {0x36e3fa10cde473dfull, 10},
+    {0x36f313bb352bf26aull, 9},
+    {0x36f7cc6710d71377ull, 11},
+    {0x3725a4b4644a1833ull, 9},
+    {0x373dcefa0996336eull, 0},
+    {0x374a96a8562ed22aull, 11},
+    {0x3750fe28d30f4fe9ull, 10},
+    {0x375cecaa6aac25dfull, 2},
+    {0x375e12ccd1d7f358ull, 8},
+    {0x37657e5dd8c5dcb8ull, 7},
+    {0x37692984505c9036ull, 7},
+    {0x37a652ea51d18124ull, 8},
+    {0x37a8bf8e6b726a24ull, 6},
+    {0x37af59e8167d6242ull, 8},
+    {0x37b885db51dc4660ull, 7},
+    {0x37bd7b3682a726c0ull, 9},
+    {0x37be6964761b9639ull, 10},
+    {0x37cae7981aac7c65ull, 6},
+    {0x37ccdaaac02d7d92ull, 7},
+    {0x37d1ffca428d710full, 8},
+    {0x37e16e80d43bdf68ull, 7},
+    {0x37e6cfa58c905f11ull, 7},
+    {0x37e8cdbb84ba2283ull, 8},
+    {0x37edc37d80e426baull, 8},
+    {0x37fb36d68a6b3d07ull, 7},
+    {0x381bcd8584d41425ull, 7},
+    {0x382490b79cfcc7f9ull, 10},
+    {0x3830a85345d2c137ull, 11},
+    {0x38333e3d669e09e4ull, 7},
+    {0x38384ff65225acc1ull, 2},
+    {0x384220ee797cc3b6ull, 10},
+    {0x384e685688443841ull, 6},
+    {0x3850b5f3ce0bc17cull, 8},
+    {0x38601b55db6d6ae5ull, 7},
+    {0x386646aff1479b30ull, 0},
+    {0x386bc60600fc0075ull, 6},
+    {0x387834195d4ac702ull, 1},
+    {0x388044257f31c1dbull, 9},
+    {0x38b42980005ed5c9ull, 7},
+    {0x38b73b9ab92df282ull, 8},
+    {0x38c320a425e2c331ull, 7},
+    {0x38d72e50512cea56ull, 10},
+    {0x38e02586cf46d03cull, 9},
+    {0x38e409c960b6a85bull, 7},
+    {0x38e54b076b51a318ull, 7},
+    {0x38e5ee56122cf11aull, 10},
+    {0x38f5bc0aa7ca147eull, 9},
+    {0x3900a277ea949190ull, 8},
+    {0x39046fa1cb954dadull, 6},
+    {0x3904e3c17132da98ull, 8},
+    {0x39156a51ef89b78dull, 10},
+    {0x39156ae07acc61baull, 2},
+    {0x391970fc05505329ull, 6},
+    {0x391c41ca75eb6301ull, 10},
+    {0x39226784b10a885aull, 6},
+    {0x393470a37fe7a2efull, 11},
+    {0x3934fef829ddf45dull, 11},
+    {0x39371163b6f690f8ull, 7},
+    {0x39387c6110b0666full, 6},
+    {0x3939f22a2ebb2a94ull, 9},
+    {0x3947dfc660275973ull, 3},
+    {0x394cdd3e2559a2b6ull, 6},
+    {0x395b40cc056f48d3ull, 6},
+    {0x395e54635375526aull, 11},
+    {0x395f7888b865e488ull, 8},
+    {0x39749c7ac6e428adull, 7},
+    {0x3974ba3511aa1485ull, 7},
+    {0x3975f9170c2ac7dbull, 10},
+    {0x397b14896df8a660ull, 8},
+    {0x39808e4b80ee46f2ull, 10},
+    {0x3981dfceedd134c6ull, 10},
+    {0x39a61066b0bc41e7ull, 8},
+    {0x39ad54b299bd6d2eull, 9},
+    {0x39bfe9c55e5dc00cull, 9},
+    {0x39c78d2a350a16a4ull, 8},
+    {0x39cc08b2ff6f961full, 7},
+    {0x39d43027dc4fa2bbull, 1},
+    {0x39d78e9f5ad83036ull, 0},
+    {0x39f089e957260a67ull, 7},
+    {0x39f44eac3c942b70ull, 5},
+    {0x39f4d5770feedcc5ull, 7},
+    {0x39f907a2067a3b9full, 9},
+    {0x39fc6da186ecd1b1ull, 10},
+    {0x3a0f8284c23a0d88ull, 8},
+    {0x3a27b4941735e173ull, 10},
+    {0x3a3b49c2f1f440d5ull, 7},
+    {0x3a3cf69aebaa16adull, 8},
+    {0x3a40e6aed0250907ull, 6},
+    {0x3a4252912b600cc5ull, 3},
+    {0x3a70b013f63559f6ull, 1},
+    {0x3a714bf62e6b6919ull, 9},
+    {0x3a7599bcb4692f9full, 6},
+    {0x3a84f200dbf24501ull, 9},
+    {0x3a866c3790734125ull, 7},
+    {0x3a87f9aacdf96aa3ull, 7},
+    {0x3a880beece41a377ull, 3},
+    {0x3a8bf18aba11556cull, 4},
+    {0x3a90f7bc78303482ull, 7},
+    {0x3ab24a3e9369391dull, 0},
+    {0x3aba81e8d2928b3eull, 9},
+    {0x3ac095079065b2adull, 10},
+    {0x3ad21d6f03e7d108ull, 9},
+    {0x3ad45717d95f81a7ull, 7},
+    {0x3ada924206abdd9bull, 9},
+    {0x3ae939cab022ea17ull, 3},
+    {0x3af07c5cbd644e25ull, 7},
+    {0x3b09253121b54d7bull, 9},
+    {0x3b143e8f5614c5a1ull, 3},
+    {0x3b29c813245ac8bdull, 11},
+    {0x3b2f59c411937734ull, 0},
+    {0x3b39f24220722fb4ull, 6},
+    {0x3b404ad2c4667a11ull, 8},
+    {0x3b4870eb2e0569f6ull, 9},
+    {0x3b5536bae91270b3ull, 8},
+    {0x3b5ab3de9d3893b7ull, 7},
+    {0x3b755fbae0deacb6ull, 7},
+    {0x3b87a3d6fa563567ull, 6},
+    {0x3b94b38b60847bd4ull, 6},
+    {0x3b99d3ff93c4feb9ull, 11},
+    {0x3ba3b85dfeee41beull, 10},
+    {0x3bbf016ab05b5ddeull, 7},
+    {0x3bf0ee9077007ccbull, 6},
+    {0x3bf226c277405d4dull, 10},
+    {0x3bfa58d117d66218ull, 11},
+    {0x3c00ab9d6977adbeull, 8},
+    {0x3c0e184c19086a15ull, 9},
+    {0x3c1b4a9e170783bdull, 8},
+    {0x3c3b5c04dc4bf68cull, 7},
+    {0x3c488fb4df0e814dull, 8},
+    {0x3c49f5ee24195c60ull, 11},
+    {0x3c4b3701a5067d7bull, 7},
+    {0x3c4f9a62f2be34efull, 10},
+    {0x3c7189c622cec0ceull, 8},
+    {0x3c7352f95ac05c5eull, 6},
+    {0x3c77c9b93a62cce8ull, 11},
+    {0x3c8ffcd0fce3f097ull, 9},
+    {0x3c93453c9ec9e49eull, 6},
+    {0x3c97cca0e0f0c44cull, 8},
+    {0x3cac0cf3fb9014a4ull, 6},
+    {0x3cac51bcfb0b5425ull, 10},
+    {0x3cb8798f9202f625ull, 0},
+    {0x3cb9b51c8545f8f6ull, 6},
+    {0x3cbd85667efa788aull, 9},
+    {0x3cc01020c1b44137ull, 1},
+    {0x3cc4d664d9bd682dull, 10},
+    {0x3cc925313bac27f8ull, 11},
+    {0x3ce0bc092f37092eull, 8},
+    {0x3ce9812356a95c81ull, 7},
+    {0x3cef7ae00eef8546ull, 6},
+    {0x3d016a3db16ed3a0ull, 6},
+    {0x3d0fae97dc32a281ull, 8},
+    {0x3d28cc75ab0444cdull, 8},
+    {0x3d2b053bdd215a7dull, 2},
+    {0x3d32d9f4162fa036ull, 10},
+    {0x3d36c74c65712396ull, 8},
+    {0x3d3f81cbc196c397ull, 0},
+    {0x3d58f2e9d4c0977dull, 11},
+    {0x3d5fc72da05eaf15ull, 5},
+    {0x3d69431bcb3a29c8ull, 6},
+    {0x3d6c6a0064c030beull, 9},
+    {0x3d7319586ada0529ull, 9},
+    {0x3d75a8542dabda99ull, 6},
+    {0x3d7adf31bf72fee4ull, 11},
+    {0x3db59c5643b6ccd3ull, 9},
+    {0x3dbc0a9e38dc595bull, 6},
+    {0x3dcf31735e7a6624ull, 7},
+    {0x3dd0d0c74477c3acull, 6},
+    {0x3dd13bb972c7740cull, 10},
+    {0x3dd891137f3aee5bull, 6},
+    {0x3e142f7b7517fe02ull, 4},
+    {0x3e1e13f212cec01cull, 8},
+    {0x3e28f3133a6ee050ull, 10},
+    {0x3e29861b08ffdde9ull, 8},
+    {0x3e41ce7cdeaa6222ull, 10},
+    {0x3e4281bec6d63100ull, 9},
+    {0x3e4cc6bb16319362ull, 6},
+    {0x3e4e9e4d976037f1ull, 6},
+    {0x3e69e61924cffec3ull, 6},
+    {0x3e6d3b3b93190981ull, 10},
+    {0x3e6f40cdcc27ef84ull, 9},
+    {0x3e70c22607f732b4ull, 11},
+    {0x3e72949077079192ull, 7},
+    {0x3e8589014bea4198ull, 6},
+    {0x3e8f4bbd483ad566ull, 6},
+    {0x3e9c311b5ab19932ull, 9},
+    {0x3ea7365489dd96dcull, 9},
+    {0x3eae9c952a167a68ull, 6},
+    {0x3eb6b7a4b636628bull, 1},
+    {0x3eb8b3cb65e2e045ull, 1},
+    {0x3ec75f0b7048b2e3ull, 11},
+    {0x3ed031103b3ee0cdull, 6},
+    {0x3eda9545ec41e5b1ull, 0},
+    {0x3ee8d1d0bd06b602ull, 6},
+    {0x3ee9d85127c07b7dull, 6},
+    {0x3f0b305358bfb94dull, 5},
+    {0x3f0e5d9fa06a1e4eull, 7},
+    {0x3f15c8f0993e3ad1ull, 6},
+    {0x3f1ddff7b9e4f287ull, 8},
+    {0x3f2083279bb3b6cdull, 11},
+    {0x3f415cb014ce50ccull, 7},
+    {0x3f4ae974713f9a4dull, 10},
+    {0x3f4f22c28002d9feull, 7},
+    {0x3f55c61a5a616553ull, 7},
+    {0x3f58790a56ae74faull, 7},
+    {0x3f59b26e878fd9c7ull, 5},
+    {0x3f71b5eb39cfac44ull, 11},
+    {0x3f73a597d1b5ee4dull, 11},
+    {0x3f7b670c89e51fb0ull, 11},
+    {0x3f9b2a8ea0e1e2b8ull, 10},
+    {0x3f9eb8c6d1a7ff60ull, 7},
+    {0x3fb3b12f791ea1bcull, 6},
+    {0x3fb8307eaf3eff63ull, 6},
+    {0x3fbb4144d93f3d9dull, 11},
+    {0x3fc6ea3ff9cc5d49ull, 6},
+    {0x3fc947c1a9918cd9ull, 11},
+    {0x3fceecc85258222full, 5},
+    {0x3fd8c7b154c9ffcdull, 10},
+    {0x3fda1c7a1eade861ull, 0},
+    {0x3fdd5084456eab65ull, 6},
+    {0x3ff23094a08d29f4ull, 7},
+    {0x3ff439a594ecb449ull, 7},
+    {0x3ffb9655f5a9c598ull, 11},
+    {0x3ffef3fbbc6c85ffull, 11},
+    {0x40107e84c9bd302aull, 9},
+    {0x401c48c9becdd3f7ull, 6},
+    {0x401d515ce74edc1bull, 7},
+    {0x402cb373780a40c5ull, 10},
+    {0x4045a61a24c6f818ull, 6},
+    {0x405342ecbba2e77bull, 6},
+    {0x405b600af90a5adeull, 9},
+    {0x405cd43939ee42f8ull, 8},
+    {0x40611fedf0664b1aull, 6},
+    {0x4069b4c000cc88d3ull, 7},
+    {0x406bcd2d3631f576ull, 8},
+    {0x408807e848277fa3ull, 2},
+    {0x4096d444fd185910ull, 6},
+    {0x40afc0464546e165ull, 7},
+    {0x40b4b2db550891a4ull, 4},
+    {0x40c9452978e71ed8ull, 6},
+    {0x40cb1c0326298fb3ull, 11},
+    {0x40cf22cfbe41f51full, 9},
+    {0x411b9b255b837069ull, 3},
+    {0x411f970e5677289full, 7},
+    {0x41336f0dfab1b990ull, 6},
+    {0x414c85c578ef2111ull, 7},
+    {0x414d85d3dc01a354ull, 6},
+    {0x4168b4aaaa9a5d60ull, 9},
+    {0x417df9ddcd916eb8ull, 7},
+    {0x418e083b4506c8ceull, 8},
+    {0x4192b508ef4be549ull, 8},
+    {0x419d40da7be3bd50ull, 0},
+    {0x41a248918baaae91ull, 6},
+    {0x41a30ac34b1ca88bull, 6},
+    {0x41a5872318a7b447ull, 6},
+    {0x41a797f42865803bull, 10},
+    {0x41b61d2d950c735eull, 10},
+    {0x41c053d5b673b69bull, 7},
+    {0x41cc5bab614fcabbull, 8},
+    {0x41d8e891025f04afull, 6},
+    {0x41dbdb73aa9be86bull, 11},
+    {0x41ee50616522dfedull, 6},
+    {0x41fd167a07925f83ull, 9},
+    {0x42074fa8aae6990aull, 11},
+    {0x42096fd06253c550ull, 7},
+    {0x420d77812033d8bfull, 8},
+    {0x420e2188b89192ffull, 7},
+    {0x421678e4e728f9e0ull, 9},
+    {0x42210c6ad89436a4ull, 8},
+    {0x42234a7116784e4cull, 6},
+    {0x423071896c33b7d4ull, 10},
+    {0x42500ee1574b7f8bull, 4},
+    {0x4252b7e9af13003bull, 9},
+    {0x4261447c5b253ea1ull, 7},
+    {0x426560b918fa75cfull, 10},
+    {0x427b8fafe66eec8bull, 6},
+    {0x4297194b17a2ccbeull, 7},
+    {0x4299723be4f3ff4cull, 7},
+    {0x429efc43a15d7923ull, 7},
+    {0x42b454ba9fb4eeb2ull, 8},
+    {0x42bacbe5de6825d2ull, 8},
+    {0x42bcd89dd364d3fcull, 11},
+    {0x42bfea6a8e257e02ull, 2},
+    {0x42c9db5027b5366full, 10},
+    {0x42d942a5e4d7b2ebull, 6},
+    {0x4303e82b7e068d7cull, 6},
+    {0x430b5efbfd7b0802ull, 10},
+    {0x431bf717b00e16dbull, 9},
+    {0x431e29b75fbc92acull, 7},
+    {0x43284234962ce910ull, 8},
+    {0x433eb03ce050c547ull, 10},
+    {0x434b2514f21463c1ull, 6},
+    {0x4363217b2ea5e81full, 7},
+    {0x4369c751488c77f3ull, 7},
+    {0x43a408c1160db0daull, 7},
+    {0x43ab5728f7f0df1cull, 9},
+    {0x43b37b2d750180c0ull, 4},
+    {0x43b58eccdce568a4ull, 3},
+    {0x43d9ae1415e8c079ull, 2},
+    {0x43ea1b15a245ebeeull, 6},
+    {0x43f031a98abc67f2ull, 3},
+    {0x43f3a6d5738b8accull, 8},
+    {0x43fe339db17dee98ull, 7},
+    {0x4403e689c6a11bc6ull, 11},
+    {0x440d8ac96ecbf807ull, 8},
+    {0x44159dd18e76a07aull, 10},
+    {0x441e0ede01121544ull, 8},
+    {0x441e7c1ed42e2c50ull, 10},
+    {0x4420402fa90ee338ull, 6},
+    {0x4427a9476af07189ull, 1},
+    {0x4434cf17af5d6210ull, 11},
+    {0x4442d0a76bf57e81ull, 7},
+    {0x444b2f30911c62e9ull, 6},
+    {0x44557cf4b6fe1f6cull, 8},
+    {0x4469f7dcc5b3a718ull, 7},
+    {0x4476374c435c8faaull, 9},
+    {0x4478168a4530e799ull, 6},
+    {0x447f73c8059080b0ull, 6},
+    {0x44800e7166810134ull, 10},
+    {0x44810ce65cf4a262ull, 3},
+    {0x448bd54be2bd3013ull, 11},
+    {0x448c1cb4d1cf5288ull, 6},
+    {0x449c36480cbdf16dull, 11},
+    {0x44a3d04e94dfd15aull, 7},
+    {0x44a80c32a541e055ull, 6},
+    {0x44aa69f6eb204e48ull, 6},
+    {0x44ae2883cb9c84e4ull, 11},
+    {0x44af7e7a0a82fa0bull, 7},
+    {0x44b2c2c22bf75518ull, 2},
+    {0x44bd68222e0d215aull, 6},
+    {0x44c36c1c50bff935ull, 0},
+    {0x44c9d95aa5fe4c25ull, 8},
+    {0x44cadc779b7aa6c8ull, 11},
+    {0x44cf31840882b6f4ull, 10},
+    {0x44d271d1af59a4faull, 6},
+    {0x44d320a32f5fc308ull, 8},
+    {0x44d79d36fc77c13full, 10},
+    {0x44e4a3ac19e2179full, 6},
+    {0x44f6740813c773bcull, 10},
+    {0x44fd69caaca07cdfull, 10},
+    {0x4515d83ffe53e69cull, 8},
+    {0x451a9716a7a1792aull, 1},
+    {0x4525fd105df1aa83ull, 2},
+    {0x453bb6e8db95a3e7ull, 6},
+    {0x4554e141bfbdda15ull, 6},
+    {0x45550c71a6371086ull, 8},
+    {0x4583785371348f9bull, 7},
+    {0x45841b9a006aa787ull, 9},
+    {0x45853100350e515full, 11},
+    {0x4585a6a91968c648ull, 7},
+    {0x459d319c25d4ce1dull, 6},
+    {0x45a10435a86b095eull, 10},
+    {0x45c35b287adca72full, 7},
+    {0x45c5701c3ef490ffull, 8},
+    {0x45c5c4149eccb7a1ull, 11},
+    {0x45cd2c7e82784207ull, 11},
+    {0x45cf8b9c59712ff1ull, 11},
+    {0x45dc0ec74978e71dull, 9},
+    {0x45f38d709891bdafull, 10},
+    {0x45f44e06df161620ull, 5},
+    {0x45f7a69b88d04d7aull, 8},
+    {0x45f7bc2699a7c117ull, 6},
+    {0x45f962454dd3348bull, 7},
+    {0x45fc6a1addeb3a92ull, 9},
+    {0x4609c1ce33fcff73ull, 7},
+    {0x46278001e53ca568ull, 7},
+    {0x4628a8f7a01b97c4ull, 9},
+    {0x462f7bcff565f863ull, 7},
+    {0x463282bcf39e9a75ull, 7},
+    {0x46400855c584a1eaull, 0},
+    {0x4643c178b1c14943ull, 7},
+    {0x465f78b903715c87ull, 6},
+    {0x4664ace3d74dec37ull, 8},
+    {0x4667e7091b21440bull, 9},
+    {0x4667efe44439b3a6ull, 11},
+    {0x466be3e47b9e33beull, 5},
+    {0x467ac37c335278faull, 8},
+    {0x4695a8de72d38d65ull, 6},
+    {0x469916b1a4d0fdefull, 10},
+    {0x469b012d7d9af22eull, 11},
+    {0x46b78ffe63c17045ull, 8},
+    {0x46d1c0eb9da24970ull, 8},
+    {0x46d73f7e0799f63dull, 9},
+    {0x46e20f00ca113ce7ull, 8},
+    {0x46e24d7e338b3e46ull, 9},
+    {0x46ea4230cc5d027dull, 6},
+    {0x4700b6cf76ecdeb1ull, 9},
+    {0x470b5e63f5f4221dull, 9},
+    {0x470df8717acecd15ull, 11},
+    {0x4726bb168ee87368ull, 6},
+    {0x4729b23dd7c51cebull, 7},
+    {0x4729baece93d3c31ull, 7},
+    {0x47340613cf756e83ull, 11},
+    {0x47395bb3a9b09cf9ull, 7},
+    {0x4746f640073a45f1ull, 1},
+    {0x4747ebf418357cedull, 10},
+    {0x4749368075ff5675ull, 10},
+    {0x4754ac17677061e3ull, 6},
+    {0x47645099c8cf5aa9ull, 4},
+    {0x477826243cd03345ull, 0},
+    {0x47877bfe513ae34bull, 6},
+    {0x4788399ee546ff18ull, 1},
+    {0x478fb965096a12b6ull, 11},
+    {0x47926a9dbfd250a5ull, 10},
+    {0x479595c21c49dfe3ull, 1},
+    {0x47986d790ecc9760ull, 6},
+    {0x479d96e93aabdcedull, 11},
+    {0x47b7fa11ff7d52ddull, 2},
+    {0x47c6301bbb6c6002ull, 8},
+    {0x47da902ef9f7f842ull, 1},
+    {0x47dc9fd5436c4a36ull, 6},
+    {0x47e2c51af6fd0b1cull, 9},
+    {0x47e8e925d225fa05ull, 8},
+    {0x47ef1105402eef97ull, 7},
+    {0x47f9621d6a4dfec1ull, 7},
+    {0x48199797e8752b10ull, 8},
+    {0x48352cf59effacd8ull, 6},
+    {0x484cd5d54e78fb56ull, 6},
+    {0x484df47ddebd0e91ull, 11},
+    {0x4853fddc43008ec9ull, 6},
+    {0x485a6b245d01fa52ull, 7},
+    {0x48667494ad3a1733ull, 7},
+    {0x486a4749a4edac61ull, 7},
+    {0x486da7dea4580c1cull, 7},
+    {0x487651edafa0b59aull, 7},
+    {0x487b5ef7768a88baull, 7},
+    {0x487ed800772faaf8ull, 6},
+    {0x488bcf3c21323baaull, 6},
+    {0x488bf65cfb8ec4b5ull, 6},
+    {0x48a3632acb9c555eull, 8},
+    {0x48b197a824cd73f0ull, 11},
+    {0x48cdac1214e2a33cull, 9},
+    {0x48e03c335a6e7ccbull, 7},
+    {0x48e4e111edb88b89ull, 10},
+    {0x48eafd185f5172caull, 11},
+    {0x48ef88cce57304b5ull, 6},
+    {0x48f2ac411b1fd944ull, 8},
+    {0x4905bb3103f457f9ull, 8},
+    {0x4906850d9f888999ull, 6},
+    {0x4906d4cf79ebfba1ull, 0},
+    {0x49136ca166324b0bull, 9},
+    {0x493d187985a54bf2ull, 11},
+    {0x4941d066cca12e9dull, 11},
+    {0x4953b7bb5cd4ac57ull, 7},
+    {0x495b4a6cc1913269ull, 7},
+    {0x4962e61e4263f742ull, 11},
+    {0x496aa77d7b6f9e15ull, 8},
+    {0x496b3e564eabeae8ull, 6},
+    {0x49ac35287495705full, 7},
+    {0x49afd507390ec751ull, 10},
+    {0x49b0cf40f14701b8ull, 6},
+    {0x49b4fc625c9f87a2ull, 11},
+    {0x49bbced30e23457aull, 11},
+    {0x49c139210ab7e9cfull, 8},
+    {0x49cdb70595d6b37bull, 1},
+    {0x49cfc9389e6016ebull, 7},
+    {0x49d1d78df78bb526ull, 9},
+    {0x49d6af479f012cffull, 7},
+    {0x49ddcf7d24e9e2a6ull, 6},
+    {0x4a1126c120390cf7ull, 8},
+    {0x4a15e078553800e6ull, 8},
+    {0x4a2b29fb5a6a86d3ull, 7},
+    {0x4a3c31ac6bd40e77ull, 0},
+    {0x4a40ff1b450da5f0ull, 9},
+    {0x4a437fef14f63336ull, 3},
+    {0x4a48bad2767d5c56ull, 6},
+    {0x4a53d92c78c10e33ull, 11},
+    {0x4a58487b46f66cebull, 0},
+    {0x4a6596bec283b96dull, 10},
+    {0x4a69361b6f9dea8aull, 10},
+    {0x4a6b056f8d77f227ull, 6},
+    {0x4a79c7f020c25a71ull, 7},
+    {0x4a87bdf1fa4172a5ull, 1},
+    {0x4a88ce5708367416ull, 7},
+    {0x4a8c4b4e3ebc7376ull, 0},
+    {0x4a976231ef77a45eull, 7},
+    {0x4aa5418058491eceull, 9},
+    {0x4aa6884068abdb6full, 5},
+    {0x4aafc0366afb1eedull, 11},
+    {0x4ac0afe1a976afa3ull, 8},
+    {0x4ac281c52875a958ull, 9},
+    {0x4ac46a49862ef7e7ull, 10},
+    {0x4adb430a96cc6cb9ull, 9},
+    {0x4afadd40fe55aee9ull, 10},
+    {0x4afe0268a4d77ea9ull, 6},
+    {0x4b0eda39822037c0ull, 6},
+    {0x4b1ac64eab3e35e9ull, 11},
+    {0x4b36807035624809ull, 9},
+    {0x4b395f4d0941354dull, 5},
+    {0x4b3aed4005897639ull, 7},
+    {0x4b3eb82e4f99d367ull, 11},
+    {0x4b3ebdbebb8664c7ull, 2},
+    {0x4b43f3e25ef0348aull, 6},
+    {0x4b4e9f9b55a07b5eull, 9},
+    {0x4b650196edc4a9deull, 2},
+    {0x4b696f171d047324ull, 9},
+    {0x4b70edaa0a3aa0aeull, 7},
+    {0x4b76e49b3e5b3d13ull, 11},
+    {0x4b7cf265a51c49dcull, 7},
+    {0x4b9ae68cb533d919ull, 11},
+    {0x4bb19fb31ae8eb3bull, 8},
+    {0x4bb6d50f3a4b4095ull, 10},
+    {0x4bb8c25244a27e90ull, 9},
+    {0x4bb996dcf067cb31ull, 11},
+    {0x4bcafdd8763cf2deull, 8},
+    {0x4bdb90026a00cbaeull, 1},
+    {0x4be51e7020b8b9d3ull, 7},
+    {0x4be81f0d55fe2e6bull, 6},
+    {0x4be9274b2662f60bull, 10},
+    {0x4bf2a3f0e2b55090ull, 0},
+    {0x4c013a1be2b192b9ull, 11},
+    {0x4c02ad4ed179240dull, 7},
+    {0x4c05dc8ef535994bull, 10},
+    {0x4c0951e88cfcf37bull, 6},
+    {0x4c0975241a6cac9full, 7},
+    {0x4c0d282aa553c709ull, 8},
+    {0x4c16f18d6efc7132ull, 6},
+    {0x4c174ca667211153ull, 3},
+    {0x4c1759546e0b26feull, 7},
+    {0x4c2304db0a803e60ull, 7},
+    {0x4c2cea8ce7a36466ull, 11},
+    {0x4c2d2791148b49c5ull, 10},
+    {0x4c36f4beaae95c93ull, 9},
+    {0x4c3c6d2036dd460full, 9},
+    {0x4c53da11b1b4ebbdull, 6},
+    {0x4c56c0850903b4b3ull, 6},
+    {0x4c76d7a3dc7a6829ull, 7},
+    {0x4c7e6a3f2fa18956ull, 3},
+    {0x4c80a3e5ec119929ull, 8},
+    {0x4c80a4801c63b51full, 8},
+    {0x4c82d4f096aa7670ull, 10},
+    {0x4c888ff605c0272eull, 8},
+    {0x4c8d852fb68cb534ull, 6},
+    {0x4c956de25be1c03full, 1},
+    {0x4cb18091e970575eull, 7},
+    {0x4cb82d4cde415907ull, 1},
+    {0x4cc0a900bc4785acull, 7},
+    {0x4cc0fe466959eae5ull, 7},
+    {0x4cc4176ce4c51e2eull, 4},
+    {0x4cc9ec62f4de12a7ull, 10},
+    {0x4ccc4ca11de40e5aull, 8},
+    {0x4cd1be289b44b8fdull, 11},
+    {0x4cd3c6f2ebc9e9abull, 10},
+    {0x4cef2776668a2880ull, 8},
+    {0x4cf0ee5a24eef6f7ull, 6},
+    {0x4cfec7edcba1488full, 1},
+    {0x4d02f6f2ff01faedull, 6},
+    {0x4d173a62323913e7ull, 11},
+    {0x4d295566622adea3ull, 9},
+    {0x4d2a6277804fc3b6ull, 10},
+    {0x4d2d6b62b11ec888ull, 7},
+    {0x4d3eba3e179031cdull, 11},
+    {0x4d47090256f1dca8ull, 8},
+    {0x4d4fdcc850e01bfcull, 11},
+    {0x4d5015c2074b14acull, 6},
+    {0x4d51096730e656f6ull, 9},
+    {0x4d5d3fc3a91837c9ull, 10},
+    {0x4d5dabb3060e2238ull, 7},
+    {0x4d619e47c6909fa4ull, 11},
+    {0x4d797b6a37256f37ull, 11},
+    {0x4d7f7ae15d862397ull, 8},
+    {0x4d94665fe8bddeaaull, 0},
+    {0x4d993090c4062b8dull, 8},
+    {0x4d9ab9dafc9273e3ull, 7},
+    {0x4d9def54d64bf604ull, 10},
+    {0x4da48d60edb7610cull, 10},
+    {0x4db10f8439428c41ull, 10},
+    {0x4db8ea8c8fbd39dcull, 6},
+    {0x4dcf5f29cd6608ccull, 8},
+    {0x4dcf838ef6b839d1ull, 11},
+    {0x4dd3460aabe3ab19ull, 9},
+    {0x4ddcec9097b3f2bbull, 8},
+    {0x4dea002c37ca92b3ull, 8},
+    {0x4df725eddbcf924aull, 1},
+    {0x4dfc85909e7f2ebeull, 8},
+    {0x4e041f0e142643f7ull, 8},
+    {0x4e0d01c1f4615f0aull, 1},
+    {0x4e0faa7c4c2d2612ull, 1},
+    {0x4e1b5fc400ca3d0cull, 8},
+    {0x4e416e6c4911e493ull, 8},
+    {0x4e4d56bfd4a80a65ull, 9},
+    {0x4e568a2973e808fdull, 11},
+    {0x4e5e0a09a3496a59ull, 9},
+    {0x4e5ef47a2f8d685eull, 10},
+    {0x4e63d9f943e13799ull, 9},
+    {0x4e9af2d67194dd5cull, 8},
+    {0x4eada9f0b16d793eull, 6},
+    {0x4eba4b474df43d0eull, 8},
+    {0x4ec3fbe909937829ull, 7},
+    {0x4ecbfac407dd41beull, 10},
+    {0x4ecdc31ec9bced73ull, 10},
+    {0x4ee6451a9893f664ull, 10},
+    {0x4ef6a62b19b6bbadull, 9},
+    {0x4f01b8bcfd715522ull, 6},
+    {0x4f0e4f1332ac0862ull, 10},
+    {0x4f0ff1f5816e3e74ull, 10},
+    {0x4f202a89110b70b8ull, 0},
+    {0x4f219d3d7dab120cull, 8},
+    {0x4f3f1b40cbf3762aull, 7},
+    {0x4f45c7c2e5be6d14ull, 11},
+    {0x4f4af62615a8efcfull, 6},
+    {0x4f4bfdac57ffb000ull, 7},
+    {0x4f6f4712f3f0d9f2ull, 6},
+    {0x4f81ac1b2e5838c7ull, 6},
+    {0x4f95357688836ccdull, 10},
+    {0x4fa1359091b46f2cull, 6},
+    {0x4fb6b7055e72d429ull, 2},
+    {0x4fb886f38b414878ull, 6},
+    {0x4fc581b91bfb85c9ull, 5},
+    {0x4fdeb1d5007c4105ull, 9},
+    {0x4fe2ec5257a67b61ull, 7},
+    {0x4fe6ca0f48a12d7bull, 8},
+    {0x4feb16a3dd1141afull, 7},
+    {0x4febad1b43680d86ull, 6},
+    {0x4ff642fd3968dd98ull, 10},
+    {0x4ffed1e5ba30d3f5ull, 6},
+    {0x5004b225cd05403dull, 9},
+    {0x50149a8a2ad2538full, 7},
+    {0x50324a83ceb4034dull, 8},
+    {0x5040bf7858ff495dull, 9},
+    {0x5043c3532c96332bull, 11},
+    {0x50455ab0b042c4c8ull, 9},
+    {0x506e616ba6af1455ull, 10},
+    {0x5076aeda9ba24c88ull, 7},
+    {0x507d291dfed57f88ull, 9},
+    {0x50855b268b6e6841ull, 0},
+    {0x508809280b2690efull, 0},
+    {0x508dce1737f248f7ull, 9},
+    {0x508e1961213e5d67ull, 11},
+    {0x509dade55ab28ec4ull, 8},
+    {0x50b2a95fe8348305ull, 10},
+    {0x50b42013a060bc65ull, 6},
+    {0x50b5d1aed440d1bcull, 2},
+    {0x50bd8ef8e34afa08ull, 7},
+    {0x50c3aacacb350574ull, 9},
+    {0x50c3eaf0c4fa2baeull, 1},
+    {0x50deab645550ca23ull, 0},
+    {0x50e30bb1ce281332ull, 4},
+    {0x50f66d9acee739a1ull, 0},
+    {0x50fe9d32f3cc9349ull, 7},
+    {0x5105f7c6b935e2fdull, 6},
+    {0x5113da2400899324ull, 9},
+    {0x5118547fd4286d12ull, 11},
+    {0x5137ab7fd622e425ull, 9},
+    {0x5158614346c0a96bull, 9},
+    {0x51628890e9caed14ull, 7},
+    {0x5167abe9ac11a0fbull, 7},
+    {0x5181b50a84b06b50ull, 10},
+    {0x51825b6e0c31764dull, 6},
+    {0x519d371594fe33a3ull, 0},
+    {0x519f832a6fbb3661ull, 10},
+    {0x51b64e671056ea01ull, 6},
+    {0x51ca25ac99d4c013ull, 1},
+    {0x51d0e7007da432eeull, 9},
+    {0x51d424e96b5dd9b7ull, 8},
+    {0x51d7c4fed28936e2ull, 8},
+    {0x51d942186ccb19dbull, 11},
+    {0x51da69c5995cc354ull, 9},
+    {0x51dcebc212f3f66eull, 7},
+    {0x51e68a7368cdaafeull, 5},
+    {0x51eb16e4fe74c7a7ull, 11},
+    {0x51f8c67cb213d9f1ull, 7},
+    {0x51fd92c15de054d4ull, 7},
+    {0x5212ed1ca2f6e969ull, 11},
+    {0x5216d04d42a318e6ull, 8},
+    {0x521944d4fbd24627ull, 9},
+    {0x521f381930d8251full, 6},
+    {0x5226e774d6db86bbull, 6},
+    {0x5248175ee69a65bcull, 8},
+    {0x5253c0e4558042d2ull, 9},
+    {0x5257a6c41a63c2e3ull, 9},
+    {0x526178492cc361abull, 9},
+    {0x52800c46bdbe365dull, 8},
+    {0x528801b4468cc800ull, 9},
+    {0x529f85ae47918ae4ull, 1},
+    {0x52a4710dd2669906ull, 7},
+    {0x52a7b3bdb69a30faull, 0},
+    {0x52a8e811835f16e7ull, 6},
+    {0x52b7831d5eb6270full, 7},
+    {0x52d6ff9425611175ull, 7},
+    {0x52d9ea0f5493c605ull, 11},
+    {0x52da82e72dec54dfull, 0},
+    {0x52eb1527c0799d89ull, 8},
+    {0x52ed94afb9e3a8b7ull, 11},
+    {0x52f6cd63a3f3dda5ull, 6},
+    {0x52fe337bf8a71cb5ull, 9},
+    {0x53033521e7791137ull, 8},
+    {0x530993eaf3485c3bull, 6},
+    {0x5318563d9ce7dfdeull, 5},
+    {0x532e71373d821362ull, 0},
+    {0x5330575660cd78f3ull, 6},
+    {0x5363668e97f0d468ull, 6},
+    {0x5365da36ac39b2e2ull, 6},
+    {0x536fff6ab39abfc6ull, 8},
+    {0x5370242862c7ebd5ull, 9},
+    {0x537108e74868fbbbull, 9},
+    {0x537c5255e318c4adull, 0},
+    {0x53a1ac89fa19a42full, 7},
+    {0x53b0cc43af877f64ull, 8},
+    {0x53b6ea2a5e3c8467ull, 6},
+    {0x53ba56c6684982b5ull, 2},
+    {0x53bacc321f29a3e0ull, 6},
+    {0x53c07e1f8cf65897ull, 9},
+    {0x53c11f87a1b3937bull, 1},
+    {0x53c14bbe9e696193ull, 1},
+    {0x53cd5fb0261958bcull, 11},
+    {0x53d67c63a068de4aull, 1},
+    {0x53e93be8f570252cull, 8},
+    {0x53f48744ce97156aull, 10},
+    {0x53fbcfe6a3aafaffull, 3},
+    {0x53fe8626ea5867a7ull, 10},
+    {0x53fefce16439a590ull, 10},
+    {0x5410ffa8b4b68a72ull, 6},
+    {0x5423149b85debf77ull, 10},
+    {0x54358740aac7f72cull, 2},
+    {0x543cc1553bf212efull, 6},
+    {0x54531eca48367da4ull, 0},
+    {0x54556796a2860e4bull, 6},
+    {0x54585b452a37802eull, 6},
+    {0x546cf597e592e7c1ull, 7},
+    {0x54765aefa5f7a581ull, 9},
+    {0x5478dcb4d2da0518ull, 3},
+    {0x547a1cff98c3b7dbull, 7},
+    {0x547e066887fc4f7bull, 7},
+    {0x548cb02db94cd077ull, 9},
+    {0x54a9f09d94c85434ull, 0},
+    {0x54accc83c769369eull, 7},
+    {0x54b9aee5b39b5dfcull, 9},
+    {0x54bc4c8ef3ab245dull, 10},
+    {0x54bf7fbd66ba9aa0ull, 6},
+    {0x54c2364a18ac3105ull, 6},
+    {0x54e921ec94606309ull, 6},
+    {0x54eaf64398c6d6b5ull, 6},
+    {0x54eeee5e076d79dfull, 6},
+    {0x54f967739465a3b4ull, 9},
+    {0x5504fc31dbd491bcull, 0},
+    {0x5508604de6e8b1deull, 7},
+    {0x551622e8c0ba6908ull, 7},
+    {0x551892e4d6638163ull, 5},
+    {0x5540291b2034cdf7ull, 9},
+    {0x55411f30b41f9275ull, 8},
+    {0x555892d39726b95dull, 6},
+    {0x5558f567abd8db88ull, 9},
+    {0x555cb991084763a2ull, 7},
+    {0x5567d44d9059c9ebull, 8},
+    {0x55686dac0b0471d4ull, 7},
+    {0x556f3e1c93732301ull, 7},
+    {0x557853d03643a9baull, 7},
+    {0x557df60f7f07944aull, 6},
+    {0x55876ee792e4c605ull, 6},
+    {0x559fcd6cd3a6871bull, 11},
+    {0x55ac0b90bc46b3cfull, 6},
+    {0x55ac27beb25f6451ull, 5},
+    {0x55bf24a4730224cdull, 6},
+    {0x55c23f76ec62c2c3ull, 11},
+    {0x55d13d21d4e28035ull, 2},
+    {0x55d2ea071b63eef2ull, 6},
+    {0x55d720db63377b04ull, 7},
+    {0x55ef1aa9fa6ef365ull, 6},
+    {0x56004c69eddeae59ull, 7},
+    {0x562184fd5458d1bbull, 9},
+    {0x564f9a27d3825728ull, 1},
+    {0x5650749478b1effcull, 3},
+    {0x56536531d16b597full, 11},
+    {0x5653a1c3975e159dull, 11},
+    {0x566b18ef6b8f5a1bull, 8},
+    {0x566b983d1b02fbf5ull, 7},
+    {0x5681dccb91605804ull, 8},
+    {0x56915132a081be14ull, 6},
+    {0x569efd3df92c09e7ull, 6},
+    {0x56a8511814720363ull, 6},
+    {0x56b52467e8fff3d3ull, 10},
+    {0x56b5b19ef67ad14aull, 7},
+    {0x56b83c09c07859a3ull, 9},
+    {0x56d9f9f1ce08f183ull, 1},
+    {0x56df012abfbbceceull, 8},
+    {0x56e96fa51f5739e5ull, 11},
+    {0x56eab1aa2bdbfc6bull, 7},
+    {0x56ef61bc09c77d42ull, 7},
+    {0x57018eff3095746cull, 10},
+    {0x570c0f4adeed16deull, 6},
+    {0x5719de94b0d9cda3ull, 9},
+    {0x571a2d4447552d11ull, 11},
+    {0x571ab5cc053013ceull, 8},
+    {0x572576b42aa48f31ull, 11},
+    {0x572788c7e7f4d64cull, 3},
+    {0x572df2a2bfdec6f8ull, 6},
+    {0x573ef7eb74d95adcull, 9},
+    {0x57491e397d8c80e7ull, 7},
+    {0x577df4ab936dd640ull, 9},
+    {0x57a089faf8b2e905ull, 8},
+    {0x57a8524675596a07ull, 11},
+    {0x57b1eae5ca5ee217ull, 9},
+    {0x57b276de8b8a34ccull, 11},
+    {0x57b65f04284705f0ull, 1},
+    {0x57b9e056121986f1ull, 6},
+    {0x57c42f1aa899bcdbull, 9},
+    {0x57fb21f720170f9bull, 10},
+    {0x58077cc7220b1a0full, 0},
+    {0x580840f629676634ull, 6},
+    {0x581e6f7e27351152ull, 9},
+    {0x5823aed6b9ec3810ull, 6},
+    {0x5830250ed6a14711ull, 7},
+    {0x583aa74f2a7eec67ull, 7},
+    {0x583b5f9f6ddb551eull, 2},
+    {0x5843b514963696eeull, 6},
+    {0x584d22eeea5b209dull, 7},
+    {0x58561ffe9b77ec5full, 1},
+    {0x585c656bf72cdb68ull, 0},
+    {0x5864e052421bc30eull, 8},
+    {0x586edbef8871b6e5ull, 2},
+    {0x58706ece727f6d9cull, 10},
+    {0x588cb2dedd8842a8ull, 9},
+    {0x58a833ba42b0178dull, 7},
+    {0x58a9fdf3ff23d883ull, 10},
+    {0x58b54c0d439b1558ull, 7},
+    {0x58c284ab9ba7f7b4ull, 7},
+    {0x58c347644e6ab3b3ull, 1},
+    {0x58d68629c9813b9cull, 11},
+    {0x58dff6bed3a567aaull, 6},
+    {0x58e0fd80bd90a82bull, 10},
+    {0x58e198ab4588de96ull, 10},
+    {0x58e59953e9271db0ull, 10},
+    {0x58ed59754aba4315ull, 3},
+    {0x58f895a35b6c3631ull, 6},
+    {0x58f99fb0f19895d5ull, 10},
+    {0x590ac884905098f0ull, 9},
+    {0x5924767c47d801bfull, 8},
+    {0x5925e69ca1580e1bull, 9},
+    {0x592b397beb0bde36ull, 0},
+    {0x592d8a6fc084923eull, 6},
+    {0x594a765f4d130972ull, 8},
+    {0x594e3478ea73f9b4ull, 9},
+    {0x59508cb9d4284643ull, 9},
+    {0x59579bcf0f01b314ull, 10},
+    {0x596deba2ff0f4266ull, 8},
+    {0x59725823630b77fdull, 7},
+    {0x5986069abfb073a8ull, 7},
+    {0x59911a740d37a4f8ull, 6},
+    {0x5997e5e1970c1bb5ull, 7},
+    {0x599b8f9a807bd50bull, 6},
+    {0x59a9691deceb1e0bull, 7},
+    {0x59aa3d4f88a21be6ull, 9},
+    {0x59ac00583ec221c3ull, 7},
+    {0x59c678151de5e3d8ull, 3},
+    {0x59c7177fe6c21336ull, 6},
+    {0x59cd8584997dc40dull, 6},
+    {0x59e93b6e45d4dab2ull, 8},
+    {0x59f75561f3549dcdull, 11},
+    {0x59fddab7389dbac5ull, 6},
+    {0x59ff14fba84cbe26ull, 6},
+    {0x5a06f0c911573d89ull, 1},
+    {0x5a09349d3eeb7ca5ull, 10},
+    {0x5a11e379220e095aull, 2},
+    {0x5a12f4165768c4a9ull, 6},
+    {0x5a15980c774cfe16ull, 10},
+    {0x5a162934e0be33ebull, 10},
+    {0x5a37d4b46596a908ull, 6},
+    {0x5a3c2f49a8bd05c3ull, 2},
+    {0x5a3ea954db7df090ull, 7},
+    {0x5a40a4ea85783b9full, 9},
+    {0x5a5dfe3cadd93d1cull, 7},
+    {0x5a60c246ad4216fdull, 11},
+    {0x5a6a2cc2976cbd84ull, 6},
+    {0x5a72ac020089743eull, 10},
+    {0x5a7659ae564d4b4full, 7},
+    {0x5a82b9d318703c54ull, 8},
+    {0x5a870c33f649e769ull, 10},
+    {0x5a8d6daefa230c3aull, 8},
+    {0x5aa231d849e87c62ull, 11},
+    {0x5aa77878f3b92b96ull, 10},
+    {0x5aa7f098a113bcc8ull, 9},
+    {0x5ac84fbdc05af6c8ull, 6},
+    {0x5acc246fe6babff6ull, 10},
+    {0x5acd3757e4b31746ull, 1},
+    {0x5ad3f309f64b13e1ull, 7},
+    {0x5ae12bb891c90a1aull, 8},
+    {0x5af136144dd73bfbull, 10},
+    {0x5af49d431a6bf070ull, 11},
+    {0x5af68d22b540a479ull, 11},
+    {0x5b0d13918101ac71ull, 8},
+    {0x5b28b0845c2bfa01ull, 7},
+    {0x5b34c219ae1b9384ull, 6},
+    {0x5b35c949b31951ecull, 11},
+    {0x5b38540b5522e18cull, 7},
+    {0x5b42fc68ad137df0ull, 9},
+    {0x5b53b2e2b2955df0ull, 6},
+    {0x5b5b1f80f7d93da8ull, 7},
+    {0x5b63b692fae2b673ull, 9},
+    {0x5b7023d8075f8849ull, 9},
+    {0x5b7244f6998a2a91ull, 6},
+    {0x5b7dac4b56ad47e5ull, 8},
+    {0x5b8836e82c3cce53ull, 0},
+    {0x5b8c03aef4ae9dd9ull, 6},
+    {0x5b8fe652ba2814cbull, 4},
+    {0x5bb513c4ac8015e6ull, 6},
+    {0x5bb8708ecc1cfde3ull, 8},
+    {0x5bca6f143b1a9995ull, 6},
+    {0x5bd2270cdd561582ull, 2},
+    {0x5bd7e94c9e47934eull, 7},
+    {0x5bdceb00fb39be3dull, 7},
+    {0x5beef750f510208full, 6},
+    {0x5bef6deee99dc522ull, 8},
+    {0x5bf4db95a849405cull, 10},
+    {0x5c0675a9a50b10a0ull, 7},
+    {0x5c06ef0f0c2d4a9full, 2},
+    {0x5c20572b51612770ull, 7},
+    {0x5c2086febb5c485bull, 10},
+    {0x5c370d42c738952aull, 6},
+    {0x5c3d1fcf5f9b5540ull, 11},
+    {0x5c432663cdb2e260ull, 10},
+    {0x5c51fcd413990b52ull, 11},
+    {0x5c6410f338778a01ull, 11},
+    {0x5c6888082197b24aull, 8},
+    {0x5c83892ed5321ab9ull, 3},
+    {0x5c9148cdfa381628ull, 11},
+    {0x5c9302995283f45cull, 9},
+    {0x5ca6b625b84720a1ull, 9},
+    {0x5cbda5b82f80ca99ull, 10},
+    {0x5cc33fb48ad01be1ull, 11},
+    {0x5cc7815f18a43af9ull, 10},
+    {0x5ccbb59365cfd791ull, 9},
+    {0x5ccd1746cab602b5ull, 7},
+    {0x5cd66ae3326dde8aull, 6},
+    {0x5cdadf1cc1a66ea3ull, 9},
+    {0x5cdc46ff5d729940ull, 6},
+    {0x5cde56bd3847f03dull, 7},
+    {0x5cedc5162b1acf47ull, 8},
+    {0x5cf079ba10fdff01ull, 11},
+    {0x5cfdf74da5b20c22ull, 11},
+    {0x5d0006861e5f9c0aull, 8},
+    {0x5d028f3fe4c73cf0ull, 7},
+    {0x5d0b1f872fc8cfbeull, 7},
+    {0x5d0dd218c4d6c05bull, 8},
+    {0x5d16245fcee205b2ull, 10},
+    {0x5d25ba26886f9847ull, 8},
+    {0x5d2c8d2dd7bfe3b6ull, 8},
+    {0x5d3e7d8177da195full, 6},
+    {0x5d4142fcaa6d0ae8ull, 11},
+    {0x5d49b54ff2c628d8ull, 7},
+    {0x5d4b20bf92904267ull, 8},
+    {0x5d58d2307368c2eeull, 9},
+    {0x5d64bf34834cbe1full, 7},
+    {0x5d67c89c40a11675ull, 7},
+    {0x5d6e234f861642a0ull, 3},
+    {0x5d72655e0d965689ull, 8},
+    {0x5d7e8c3986beac6full, 8},
+    {0x5d7eca51fb2089afull, 10},
+    {0x5d7fe73a1d97bf9aull, 9},
+    {0x5d845856e9e33dd0ull, 3},
+    {0x5d88c8889319c522ull, 9},
+    {0x5d91308d0a4f756dull, 10},
+    {0x5d9a726ac8d14896ull, 6},
+    {0x5da4e1b1fab9c92dull, 9},
+    {0x5dba10a198c64727ull, 10},
+    {0x5dca098f71abc045ull, 0},
+    {0x5de167c616da1979ull, 0},
+    {0x5de1e417f105fd5eull, 6},
+    {0x5de9dd0fd711b30aull, 2},
+    {0x5e09b5c83a7b4af1ull, 0},
+    {0x5e1608620bbc70cdull, 7},
+    {0x5e1784183768626bull, 9},
+    {0x5e1c167ded87413eull, 8},
+    {0x5e1de0a1664b0d27ull, 6},
+    {0x5e23632ea10f9366ull, 6},
+    {0x5e2f5a0ecd4c9594ull, 6},
+    {0x5e33f5aa229dc43aull, 7},
+    {0x5e3d23425d048330ull, 8},
+    {0x5e3f3cbb26d35f8eull, 6},
+    {0x5e418667098e709aull, 7},
+    {0x5e44bce5feb13cbfull, 7},
+    {0x5e4b88e3bda67502ull, 9},
+    {0x5e5793d131f5abbdull, 6},
+    {0x5e69e2227c5b4083ull, 10},
+    {0x5e74908bb19d37e2ull, 8},
+    {0x5e74c920274cd7e6ull, 7},
+    {0x5e7de90d2aa88591ull, 9},
+    {0x5e7e6d994a85bba1ull, 11},
+    {0x5e92ab26eccc7786ull, 4},
+    {0x5e98320e92cae927ull, 6},
+    {0x5ea1804d750ce7f1ull, 6},
+    {0x5eb3daa938cda6baull, 10},
+    {0x5eb80c082ebfa0d0ull, 8},
+    {0x5eb88b5ef1e12f88ull, 10},
+    {0x5ebc0fc6a8de1612ull, 6},
+    {0x5ebdcce59707b20bull, 7},
+    {0x5ec103ea2b5320c1ull, 10},
+    {0x5ec6d09388ccb23dull, 11},
+    {0x5ece86ac3704eccfull, 8},
+    {0x5ee2920e1b3f4319ull, 6},
+    {0x5ee66222368a44c4ull, 7},
+    {0x5ef171aaaf5a2bdfull, 8},
+    {0x5ef3ab2f5b68b308ull, 6},
+    {0x5f0e4db5937996dcull, 7},
+    {0x5f20ddedc51b1207ull, 6},
+    {0x5f2389e71b191cb2ull, 9},
+    {0x5f362cdf5fe3f980ull, 6},
+    {0x5f46d074de4de211ull, 9},
+    {0x5f4a333611532b3full, 1},
+    {0x5f4ab46f41b6a0a5ull, 6},
+    {0x5f59ec9580e4b6c1ull, 9},
+    {0x5f5c92562e583e7full, 11},
+    {0x5f60062d255a1393ull, 9},
+    {0x5f6bc4d360ade810ull, 0},
+    {0x5f703848cb080500ull, 7},
+    {0x5f72373e52127711ull, 9},
+    {0x5f8384181f16dbc9ull, 0},
+    {0x5f8961400a70a7caull, 11},
+    {0x5f8bc69cb6bc623bull, 8},
+    {0x5f99531b84d864afull, 8},
+    {0x5fb0a85d9002bb45ull, 1},
+    {0x5fc43cdc6c207dc5ull, 2},
+    {0x5fc75434155fef1full, 9},
+    {0x5fdbbe8f495e8447ull, 6},
+    {0x5fe60010e3da16b8ull, 8},
+    {0x5ff7ac91a7264321ull, 6},
+    {0x5ffa5f9adddd1889ull, 6},
+    {0x600bf286a9f45666ull, 4},
+    {0x600cfdf8a0280728ull, 10},
+    {0x601e6604989dbcefull, 5},
+    {0x60247652374acf9bull, 10},
+    {0x60290cee9e149050ull, 9},
+    {0x602ed391a4401ddbull, 6},
+    {0x6039d84fc0dd56f5ull, 7},
+    {0x603b51a844a71f81ull, 11},
+    {0x6078aae073a4a775ull, 7},
+    {0x6080e666398cc6b2ull, 0},
+    {0x60914eba4080ce7bull, 6},
+    {0x60b28c5d1b415002ull, 5},
+    {0x60b67c3340ef0bf0ull, 11},
+    {0x60c484763805fcbcull, 6},
+    {0x60ce76bb7f0e559dull, 6},
+    {0x60d66447374b160full, 11},
+    {0x60dce48268912299ull, 6},
+    {0x60e661d4730888c7ull, 8},
+    {0x60f1bf5cf4278d47ull, 6},
+    {0x60f873d5a4444c09ull, 9},
+    {0x60fef8a9fa355a11ull, 6},
+    {0x61006cf79878d494ull, 9},
+    {0x61140caf74bd9c82ull, 7},
+    {0x611b9cc91cd565c2ull, 1},
+    {0x612985d2e26acea2ull, 6},
+    {0x612e1ba316c877cdull, 1},
+    {0x6133f7bece0a543eull, 9},
+    {0x61371faf8929d35dull, 10},
+    {0x613b10cf551dcc68ull, 7},
+    {0x614e57b94c26d38dull, 11},
+    {0x61530a0db039b7b5ull, 2},
+    {0x61839fb99a550500ull, 6},
+    {0x618db235dd5a614eull, 10},
+    {0x61955550ba1cc213ull, 6},
+    {0x6196e745cd3cefbdull, 6},
+    {0x619882de3647347eull, 6},
+    {0x61a26a85868fce37ull, 11},
+    {0x61a51c1b2f295ce1ull, 11},
+    {0x61a563a6ae28eb3full, 1},
+    {0x61b74c9645ba4dceull, 7},
+    {0x61cb13f67278deacull, 11},
+    {0x61cb927eeb39219bull, 8},
+    {0x61dceff92c983818ull, 6},
+    {0x61e419fae10a5d82ull, 7},
+    {0x61e65a33a887c88cull, 6},
+    {0x61e9dfebd07d1427ull, 7},
+    {0x62163eb57198a69cull, 1},
+    {0x62180f43a4ab3acdull, 7},
+    {0x622d4ed2697c94b2ull, 7},
+    {0x622d8f4c5ec404f4ull, 8},
+    {0x6230fcfb46e1270cull, 9},
+    {0x623f463011df9868ull, 1},
+    {0x626044328121eaeeull, 10},
+    {0x6276ab4051fb44a0ull, 2},
+    {0x6277a434d4c9ff84ull, 8},
+    {0x62780a1df3e92340ull, 10},
+    {0x6280bbbd32c7311eull, 7},
+    {0x628ebdc4c0fc36eeull, 11},
+    {0x6291a306312a98ceull, 1},
+    {0x629b89fc866c3db0ull, 7},
+    {0x629cd8e04ae85bbeull, 10},
+    {0x62a879f4835a93f0ull, 10},
+    {0x62b261d4c3d58d70ull, 10},
+    {0x62bce1c00db95397ull, 6},
+    {0x62bda01611b7a91cull, 10},
+    {0x62c2226d0c5bc452ull, 7},
+    {0x62c232035b1042fcull, 10},
+    {0x62c8f5b781661bd6ull, 1},
+    {0x62dbf8861e52bfbfull, 7},
+    {0x62eb34764eca0accull, 7},
+    {0x62ec82b5a4c2bfe2ull, 7},
+    {0x62f1918c050b44c3ull, 11},
+    {0x62f299b35729acacull, 8},
+    {0x62f59aaf4d945206ull, 7},
+    {0x631cabccdb22091eull, 6},
+    {0x6333de81d2adb3beull, 11},
+    {0x6337950c64c0295dull, 6},
+    {0x6342fd4b0ddc8e31ull, 2},
+    {0x63441d004058779bull, 3},
+    {0x63592f9519629a3cull, 7},
+    {0x636147b91fee2452ull, 11},
+    {0x63623c52e09c0807ull, 7},
+    {0x6362c80e299b06ebull, 9},
+    {0x6365e0c8e29228b5ull, 7},
+    {0x6371cdb405f6c9acull, 4},
+    {0x6375b7dc4971109eull, 0},
+    {0x63786bf50feaacc0ull, 11},
+    {0x637c4d46f856bb1dull, 7},
+    {0x6391da780882c5d4ull, 11},
+    {0x63a1123ab6f4c8f6ull, 9},
+    {0x63a601cb7c771272ull, 11},
+    {0x63ae0db4a9954abfull, 1},
+    {0x63ba1b2b2dfb992bull, 9},
+    {0x63c7573f6b526603ull, 6},
+    {0x63cf78ccc5892d95ull, 8},
+    {0x63db9d6a8a9fe089ull, 3},
+    {0x63f800358405ac8aull, 6},
+    {0x63fb857f3785c7c0ull, 7},
+    {0x64018992c758ba61ull, 8},
+    {0x641015c10e4f1ef4ull, 9},
+    {0x64123e3cef50ddd4ull, 6},
+    {0x641dd13432b1eef4ull, 7},
+    {0x642bb93185629137ull, 5},
+    {0x642d41ee40882eb1ull, 6},
+    {0x6438905148072f51ull, 3},
+    {0x64479fa03c7d04eeull, 7},
+    {0x644b898baf77a683ull, 4},
+    {0x644e3358b432ca6full, 8},
+    {0x64875413736e2d7bull, 8},
+    {0x648c24e41075097cull, 6},
+    {0x649f4c1bb7854488ull, 7},
+    {0x64a6850c1a7f8fdeull, 7},
+    {0x64ad3161ff92d285ull, 10},
+    {0x64bfd110c5f9608eull, 9},
+    {0x64c5f8b498e0bcd5ull, 10},
+    {0x64d9a8c5aae2ea23ull, 7},
+    {0x64df4a35a4b985e8ull, 11},
+    {0x64e42e3d504c8512ull, 9},
+    {0x64ff7755e58ccd64ull, 6},
+    {0x65009b4bd6cbd8d9ull, 9},
+    {0x650573263616721full, 6},
+    {0x6509fd48d29ff442ull, 8},
+    {0x6545f09d9f6394b0ull, 0},
+    {0x655824d01ce0a201ull, 11},
+    {0x65722facd6d0e871ull, 1},
+    {0x658104c437a0bba2ull, 8},
+    {0x65810e7030e1c919ull, 4},
+    {0x658d36f9979ac983ull, 8},
+    {0x65924e0d515df584ull, 7},
+    {0x6593897fbaa9bff3ull, 8},
+    {0x65a055a0d49c2ba6ull, 6},
+    {0x65a16c6c8dc608a8ull, 1},
+    {0x65a4b07c9a343850ull, 9},
+    {0x65b1d92616e05d07ull, 9},
+    {0x65b3363bed8c2cbaull, 6},
+    {0x65babd396675c9a1ull, 7},
+    {0x65cce239d382aca8ull, 6},
+    {0x65d4ac1960bdc5cdull, 6},
+    {0x65d52ca650a65b78ull, 10},
+    {0x65de94305dd13af0ull, 1},
+    {0x65e384be400410f9ull, 6},
+    {0x65e6f7fa2e628978ull, 9},
+    {0x65f6a35023bd3932ull, 3},
+    {0x660bffa63019006cull, 7},
+    {0x660f4d3570915ca6ull, 2},
+    {0x660f6e4ebd31d824ull, 11},
+    {0x66130aad03f4c95aull, 11},
+    {0x66181433b8f55decull, 8},
+    {0x661c5d6076e8ba90ull, 11},
+    {0x66268c7da0bd6b6bull, 8},
+    {0x662bd6c0bc4c1e6aull, 6},
+    {0x662fa865a33022d8ull, 8},
+    {0x6640208de8269371ull, 11},
+    {0x6646190a8397bc92ull, 7},
+    {0x6660956fc3a9b459ull, 4},
+    {0x666494d7f2833e11ull, 9},
+    {0x666c1f5e88e00ac9ull, 6},
+    {0x666ccfcc082ca289ull, 0},
+    {0x66739bf8c4f8663eull, 8},
+    {0x667b967e16e368eeull, 8},
+    {0x6681b28d9fbd4b65ull, 6},
+    {0x668a16ee6b46d109ull, 11},
+    {0x66919a63f425742aull, 11},
+    {0x66bd2253a151b049ull, 7},
+    {0x66d98f0fc2998e23ull, 6},
+    {0x66ddeede4cecf527ull, 6},
+    {0x66df9ed3ddec2485ull, 11},
+    {0x66e133651d650631ull, 7},
+    {0x66e47ca54c5d569full, 6},
+    {0x66e99dc0ef544da8ull, 11},
+    {0x66ea3d46e3b070b7ull, 9},
+    {0x66ed1f9fa1716919ull, 10},
+    {0x66f3fae23be54275ull, 9},
+    {0x66f44dc18413b467ull, 6},
+    {0x66f5987d9f2362f1ull, 4},
+    {0x67043232daad0565ull, 0},
+    {0x6705635ada50d49aull, 9},
+    {0x6707d5c076763581ull, 6},
+    {0x6713b082a5eff17aull, 9},
+    {0x6718e926f363bfeeull, 9},
+    {0x672703a5f98c62bdull, 6},
+    {0x672905b700989c41ull, 7},
+    {0x673472fc9a8ef0b3ull, 8},
+    {0x673f935be0cb3912ull, 8},
+    {0x6741a637635429eeull, 11},
+    {0x6755640388a0fbb3ull, 10},
+    {0x67770c612ecbb177ull, 0},
+    {0x677cd0ca4de3a671ull, 0},
+    {0x6781e193a3beddc3ull, 11},
+    {0x67848a14358e0728ull, 6},
+    {0x678d587b813f3fbaull, 7},
+    {0x679815c83747a79bull, 11},
+    {0x67a094ba9e70cff0ull, 6},
+    {0x67a0971962127493ull, 9},
+    {0x67a485417e7ef6a0ull, 6},
+    {0x67a492c201d7d930ull, 8},
+    {0x67a859cb820fbd3aull, 7},
+    {0x67b03fda6c878929ull, 11},
+    {0x67b5301e9f437b70ull, 9},
+    {0x67c460bbf04d3037ull, 6},
+    {0x67d0a484b2b96cf7ull, 9},
+    {0x67dcba3eb67d1014ull, 10},
+    {0x67f325ceaf84cfc4ull, 8},
+    {0x67f8b2e9bfb7a294ull, 6},
+    {0x67fe4b3df05cc502ull, 2},
+    {0x681d074b8020b87cull, 6},
+    {0x6821a84cdb409a6cull, 6},
+    {0x6829b0865620d888ull, 7},
+    {0x6835fdfca83b1373ull, 8},
+    {0x68460f7af02a9a96ull, 8},
+    {0x6856f8b08e8c2ff0ull, 6},
+    {0x6865ab6b0d3e2356ull, 0},
+    {0x6870b8cb2d856fb7ull, 8},
+    {0x6870fe2ef53a9a69ull, 6},
+    {0x6882ca929036dfd1ull, 6},
+    {0x68a3aa6c8320b6e6ull, 6},
+    {0x68a79ffb244afe48ull, 9},
+    {0x68aca7355c655751ull, 10},
+    {0x68b32b2f507fc05eull, 3},
+    {0x68b668a3f2a1b7b4ull, 6},
+    {0x68b8bea6993d8ed3ull, 8},
+    {0x68c6c82839398255ull, 0},
+    {0x68cf6056cfbc5ef5ull, 7},
+    {0x68d84b2017196bb5ull, 10},
+    {0x68e6abf4cb9f801aull, 6},
+    {0x68e85ef626d6b442ull, 7},
+    {0x69213675fb401dd2ull, 11},
+    {0x6921eabee3f76efcull, 11},
+    {0x69272159d526a958ull, 8},
+    {0x692c2df574be111full, 11},
+    {0x6936d29a27c50561ull, 11},
+    {0x693f20f61854ddd4ull, 6},
+    {0x6946054ce7ed37b0ull, 6},
+    {0x69563c05ea70f9f5ull, 7},
+    {0x697f0da3433106d1ull, 7},
+    {0x699195bf97ada4ffull, 1},
+    {0x6991ff8495d82c7bull, 11},
+    {0x699d6b7208937e51ull, 7},
+    {0x69a41d361e43e3e3ull, 8},
+    {0x69a6070956ccbf9cull, 10},
+    {0x69b21f86d9e42535ull, 7},
+    {0x69cb1086160ca459ull, 6},
+    {0x69d38eb2b1c3220eull, 1},
+    {0x69d6aeccbfe9097dull, 1},
+    {0x69dd157a75295715ull, 7},
+    {0x69e37ddf8e312e85ull, 6},
+    {0x69ebe211c8a90a16ull, 2},
+    {0x6a01769b4ba183d0ull, 6},
+    {0x6a08161541e46e94ull, 9},
+    {0x6a0d19ff5de41803ull, 6},
+    {0x6a189c185bfc836aull, 2},
+    {0x6a382f45519edc36ull, 7},
+    {0x6a3b9c4b0a09c928ull, 6},
+    {0x6a46ac28e0ec7e36ull, 10},
+    {0x6a47b90cd16077ceull, 11},
+    {0x6a5a323ec1477e67ull, 7},
+    {0x6a6895b21fbba9a4ull, 8},
+    {0x6a6f6a424160c11bull, 6},
+    {0x6a72e58eba4adc09ull, 10},
+    {0x6a742868032e16a6ull, 8},
+    {0x6a88aa3e61a81e8eull, 2},
+    {0x6a9b2c5b98f1a3cdull, 6},
+    {0x6a9c5a18b7ddde7cull, 7},
+    {0x6aa718bf1e0189e6ull, 4},
+    {0x6aab7b879a4e2b8aull, 6},
+    {0x6ab25a8ea0546244ull, 11},
+    {0x6ab88b9ebaac5727ull, 1},
+    {0x6ac04a23bbd7f45eull, 6},
+    {0x6aceb130136976dfull, 7},
+    {0x6adfa03fd02ffd24ull, 1},
+    {0x6ae569893a1a8793ull, 11},
+    {0x6ae9adf751ec690cull, 6},
+    {0x6af33a697e461b87ull, 6},
+    {0x6b0b12821126830cull, 11},
+    {0x6b102227eb2aa033ull, 8},
+    {0x6b17a42b99a3c205ull, 6},
+    {0x6b1ffaec0ff10e66ull, 1},
+    {0x6b268ca8192193d4ull, 4},
+    {0x6b29d1fc55080910ull, 10},
+    {0x6b3f12b513f6def8ull, 9},
+    {0x6b424df430adb454ull, 8},
+    {0x6b4261f56bc15f62ull, 11},
+    {0x6b45e45bc379f39dull, 6},
+    {0x6b48d7b8655f327full, 7},
+    {0x6b4924f2727f46d3ull, 7},
+    {0x6b4c98138fa9bf1bull, 9},
+    {0x6b5c3626b81e9e16ull, 7},
+    {0x6b70b66f144f640eull, 6},
+    {0x6b75588e8870e58dull, 6},
+    {0x6b7a905b347a4de4ull, 10},
+    {0x6b7bfe86db87d97aull, 11},
+    {0x6b95ef6d123f345eull, 0},
+    {0x6b98506c07929feaull, 6},
+    {0x6b99f2af08dc3069ull, 6},
+    {0x6b9ef783fc8c0718ull, 2},
+    {0x6ba679b59dcdbd15ull, 0},
+    {0x6bb80d9115994ef5ull, 3},
+    {0x6bc33f3bd7ee9c9eull, 6},
+    {0x6bc55ba28147dd5aull, 8},
+    {0x6bc8d60354da1233ull, 9},
+    {0x6bf357be738ae87bull, 8},
+    {0x6bff93e192674136ull, 7},
+    {0x6c0be11fe637f7fbull, 9},
+    {0x6c0c8ac1bbdc107dull, 10},
+    {0x6c11462153cca00bull, 7},
+    {0x6c18dc1117b26e27ull, 6},
+    {0x6c1ee4b3e9fddb3eull, 9},
+    {0x6c20df683c723292ull, 10},
+    {0x6c244c8a200d0d40ull, 3},
+    {0x6c2ca131c169de76ull, 5},
+    {0x6c2fd0851cdc97b4ull, 7},
+    {0x6c3373e11427b63full, 8},
+    {0x6c43612e197588f2ull, 6},
+    {0x6c45dd991f6aad09ull, 11},
+    {0x6c4c729123bab7cdull, 6},
+    {0x6c4ec5c7718546fbull, 9},
+    {0x6c706914017abfbfull, 6},
+    {0x6c82ebb450fc16a7ull, 9},
+    {0x6c84fdc5ac38542cull, 6},
+    {0x6c87f2768e6f1b88ull, 10},
+    {0x6ca4d66fdc9b9017ull, 7},
+    {0x6cb2720385a588d9ull, 8},
+    {0x6cb98dec9306ade7ull, 8},
+    {0x6cbbc7422cb9665bull, 8},
+    {0x6cc129a03fee9909ull, 6},
+    {0x6cc45757334002bbull, 0},
+    {0x6cc7660930fd5d96ull, 7},
+    {0x6cd4e77ba75c5b20ull, 7},
+    {0x6cd7e3808e4b5c3bull, 9},
+    {0x6cdbc15a5713b77dull, 6},
+    {0x6ce85fdc6eeb83dfull, 0},
+    {0x6cee7fafc00dc3c2ull, 2},
+    {0x6d154ee99f77d8bdull, 6},
+    {0x6d155531abfeed88ull, 7},
+    {0x6d2159d468c8c53eull, 11},
+    {0x6d300f21ea257f17ull, 7},
+    {0x6d30ba8c1fefa38dull, 1},
+    {0x6d3bebff75a891a2ull, 7},
+    {0x6d3def29f76b645cull, 6},
+    {0x6d49bea7e7224d0bull, 11},
+    {0x6d500a83578e46b6ull, 10},
+    {0x6d507aad6702c400ull, 9},
+    {0x6d50bf1e6329b417ull, 6},
+    {0x6d696bccbeb3755cull, 6},
+    {0x6d735aca0aa315efull, 8},
+    {0x6d73f7072a0e498eull, 0},
+    {0x6d774c6e243c7f9cull, 6},
+    {0x6d784ff63429a2d2ull, 8},
+    {0x6d8075cfd09470c1ull, 3},
+    {0x6d832938a1e8052dull, 7},
+    {0x6d94217fac805564ull, 2},
+    {0x6d965ff929351b53ull, 9},
+    {0x6da4e244f43a7331ull, 10},
+    {0x6db0e8c0e2d6f069ull, 7},
+    {0x6db4dffb7a58192bull, 7},
+    {0x6dbbe96678c12e54ull, 6},
+    {0x6dbbfa124c3482e4ull, 4},
+    {0x6dcfd4a04475c518ull, 6},
+    {0x6dd9bce9ebedb192ull, 8},
+    {0x6dd9be41fbf33944ull, 8},
+    {0x6deb1e5cde1f16fcull, 2},
+    {0x6df5c0e7414f65cfull, 8},
+    {0x6dfdd03255382081ull, 9},
+    {0x6e15927800f3d6b8ull, 7},
+    {0x6e17479159f8f587ull, 10},
+    {0x6e1e30b850ec8e78ull, 5},
+    {0x6e2b067c1a5e0b7cull, 6},
+    {0x6e3034d8f38e5874ull, 6},
+    {0x6e37066e7a47e1e1ull, 2},
+    {0x6e4380a03bd3e855ull, 7},
+    {0x6e5090a8dd3f5b29ull, 8},
+    {0x6e53ab39f2c90ed7ull, 10},
+    {0x6e5c65ff23e2ee9bull, 7},
+    {0x6e6a1f033c70f86dull, 6},
+    {0x6e7c8269a150211dull, 7},
+    {0x6e8156eaee8dce27ull, 8},
+    {0x6e85461e9862ac3eull, 1},
+    {0x6e894ccb03308b25ull, 8},
+    {0x6e89b115efcf75caull, 11},
+    {0x6e90fdd3d114daeeull, 10},
+    {0x6ead2ae4442f1a7aull, 6},
+    {0x6ed074495bf8d8d9ull, 10},
+    {0x6ed1b945fe0bbe65ull, 2},
+    {0x6ed7037b75e559b2ull, 7},
+    {0x6ee22cc1186cd3b8ull, 11},
+    {0x6eed00425e654ddaull, 9},
+    {0x6ef4e3c27f56db29ull, 3},
+    {0x6f05ccae590be1b2ull, 11},
+    {0x6f150716444d1679ull, 7},
+    {0x6f1b32f3b7e15bd7ull, 2},
+    {0x6f1ede0645d8efdaull, 6},
+    {0x6f41b141edf7e83bull, 6},
+    {0x6f44e1c6ebf2640dull, 6},
+    {0x6f4d56cab887a495ull, 7},
+    {0x6f4d72509de902bfull, 8},
+    {0x6f54496593b0997aull, 10},
+    {0x6f564b4a13692cf7ull, 7},
+    {0x6f569e036d6b41bcull, 0},
+    {0x6f5cab8147e68ddeull, 7},
+    {0x6f8228542112194full, 7},
+    {0x6f8cef77917190efull, 9},
+    {0x6f915b85eecdb8dcull, 9},
+    {0x6f9cc9d1c1292837ull, 2},
+    {0x6f9d1c6dda19fea1ull, 6},
+    {0x6fa07176089ef0c8ull, 8},
+    {0x6fa3d70a4acf57f7ull, 11},
+    {0x6fa957b37c5abe7aull, 7},
+    {0x6fb4bf7212e6bfe1ull, 6},
+    {0x6fb90dc540cb3653ull, 4},
+    {0x6fc3eadc21359c51ull, 6},
+    {0x6fc6e40e2a672331ull, 6},
+    {0x6fd3cd27a9583c37ull, 7},
+    {0x6fdbe2d4c5a5b31cull, 8},
+    {0x6fdfcc5239a21abaull, 11},
+    {0x6fe56cde75fdb7b4ull, 6},
+    {0x7000ab75c45b3b72ull, 7},
+    {0x7005bc7fafb8674dull, 7},
+    {0x7015fa7970712204ull, 9},
+    {0x701efdd0bf3d7a67ull, 7},
+    {0x702b6a34c6297185ull, 9},
+    {0x704647c231b38405ull, 1},
+    {0x7047dca8b1e4f727ull, 7},
+    {0x704c9432e66f73b9ull, 9},
+    {0x704e29e500bfebf5ull, 6},
+    {0x705ed2242c465f07ull, 1},
+    {0x7065443e951c7dafull, 6},
+    {0x7067d369f2b30796ull, 8},
+    {0x707c0d62f728c290ull, 6},
+    {0x708618a94d843a13ull, 9},
+    {0x70871e421babb03cull, 6},
+    {0x708fe9f74732e158ull, 11},
+    {0x7092590c7b73417eull, 11},
+    {0x70938e0d0f9d3b17ull, 7},
+    {0x70946f06fb60e084ull, 6},
+    {0x70961e2e23ded54dull, 10},
+    {0x709e45db4f6c96e0ull, 11},
+    {0x70a6d44dc43a1ec9ull, 10},
+    {0x70c5f6bf75a93ed1ull, 7},
+    {0x70ca3afe870f5dc9ull, 8},
+    {0x70d322ce00ee4474ull, 7},
+    {0x70d7875abc1de358ull, 6},
+    {0x70e56a6ad4317f12ull, 8},
+    {0x70f66a7689b12c0aull, 3},
+    {0x7102387e0a404ddcull, 10},
+    {0x7104030a993c3344ull, 10},
+    {0x710f930a15b83a1aull, 7},
+    {0x711292513fd07e2cull, 6},
+    {0x71257d502d971153ull, 11},
+    {0x713f8e4970ad893bull, 7},
+    {0x714311e883c53822ull, 6},
+    {0x7156b8492d7b236cull, 9},
+    {0x715fed4723e7e662ull, 10},
+    {0x716a09f361bfc48full, 7},
+    {0x716c8b4dc7b7be53ull, 11},
+    {0x7177cd26476b31beull, 7},
+    {0x717da9fea666e5c3ull, 7},
+    {0x718ccaf1fce1e433ull, 10},
+    {0x71935e1453b6c1d3ull, 8},
+    {0x71a0f44322ef1915ull, 4},
+    {0x71a2f65e88f93e30ull, 11},
+    {0x71a96c8bda98a010ull, 11},
+    {0x71aaf7dfc4cd6eaaull, 10},
+    {0x71af850a0354fa1full, 11},
+    {0x71b39efb248accbfull, 8},
+    {0x71b8452bce870c32ull, 1},
+    {0x71c9706ec73a958bull, 10},
+    {0x71ceee0ff1eb251cull, 8},
+    {0x71d486286f1656ffull, 2},
+    {0x71f033f10c60305aull, 10},
+    {0x7206c0b46e736813ull, 9},
+    {0x72181d40687515bbull, 11},
+    {0x72332d98ba9ba406ull, 0},
+    {0x72344bb7af1c1e7full, 10},
+    {0x7237b9b752296be9ull, 3},
+    {0x7251c0d53bd3262full, 8},
+    {0x7251eb5d8255babbull, 8},
+    {0x72595431a79894f9ull, 0},
+    {0x726f4b377398931bull, 6},
+    {0x7272258c38a9c5c1ull, 11},
+    {0x7272eab7348f9814ull, 7},
+    {0x728a5ceb3ed13e5cull, 11},
+    {0x72b35c59d9ef101aull, 11},
+    {0x72b5855364577355ull, 6},
+    {0x72ba78025e298ef4ull, 7},
+    {0x72d3cffb3c01a129ull, 8},
+    {0x72d68566b9a0f6dbull, 6},
+    {0x72d6e0cd448fdfa4ull, 3},
+    {0x72db6af327715900ull, 8},
+    {0x72ddfa86755a0bf8ull, 11},
+    {0x72e7c819fc746a3bull, 8},
+    {0x72f3924ba927783bull, 10},
+    {0x72f50ddd27529803ull, 0},
+    {0x7303e8b9b23ee953ull, 6},
+    {0x73070866c57622fdull, 7},
+    {0x730a3bd1e2cab3f5ull, 9},
+    {0x730bf8e17fe39e3bull, 6},
+    {0x730d70779c5d710aull, 7},
+    {0x7330ff030929a576ull, 8},
+    {0x733f50ed36c52fbeull, 10},
+    {0x7344e45abf7edc66ull, 6},
+    {0x7351d42338bd3d0eull, 10},
+    {0x735844bcc9d3c927ull, 6},
+    {0x735ffc3969ebda6dull, 11},
+    {0x7362cb6a4dd5b139ull, 9},
+    {0x736bf7a92f0c4351ull, 6},
+    {0x736deea9822d09b1ull, 7},
+    {0x73711ae0f320f6dcull, 9},
+    {0x7373f455f2b64adbull, 7},
+    {0x73785992a9ba89f0ull, 7},
+    {0x737a6790f544037aull, 11},
+    {0x737da77b7841abaaull, 9},
+    {0x73a269b78b002c16ull, 7},
+    {0x73b130fe50e2ba84ull, 0},
+    {0x73b6e81e2214eb55ull, 2},
+    {0x73c781e99f5f16fbull, 11},
+    {0x73d242406bf8b521ull, 10},
+    {0x73e46aad1b722b5dull, 10},
+    {0x73e6cf01d4b1ea96ull, 11},
+    {0x73e9bb2f841b1745ull, 7},
+    {0x73f7f6673a0d0d66ull, 3},
+    {0x73f8de9d098832aaull, 11},
+    {0x740a69473c3695b5ull, 7},
+    {0x7413d6b2215320d9ull, 7},
+    {0x74186370aff37a2dull, 2},
+    {0x74194a010fda74f7ull, 6},
+    {0x74196e2d1f2ef7b3ull, 11},
+    {0x7420bedf25844b14ull, 6},
+    {0x742766f4ee3e7bcaull, 7},
+    {0x745f82bf83277e65ull, 7},
+    {0x7464b67e18333a78ull, 1},
+    {0x746f338cfa3fcfb1ull, 0},
+    {0x747b674b87f0d4eaull, 11},
+    {0x747fc82a83633370ull, 9},
+    {0x7481e5278b2cf55cull, 9},
+    {0x7485813d11d230d2ull, 9},
+    {0x74945dbc843d0fbaull, 10},
+    {0x749c6e1a66547129ull, 8},
+    {0x74bd3e39dbcece90ull, 8},
+    {0x74bed6612f600f21ull, 11},
+    {0x74cf105d9fdb8146ull, 9},
+    {0x74e3ea15f9adefc3ull, 6},
+    {0x74e926e0d154ff0dull, 7},
+    {0x74ef00db71008196ull, 9},
+    {0x7509e53db0a9d81cull, 6},
+    {0x750a7813ff9fb7b4ull, 10},
+    {0x75173c994a5e2a41ull, 11},
+    {0x7517f4a16d900020ull, 11},
+    {0x751c68f6b1755e4cull, 5},
+    {0x752484b01b4e99a1ull, 9},
+    {0x7534c2aa82bdbcc1ull, 9},
+    {0x754344add5df5869ull, 6},
+    {0x7554ad3d4d48e857ull, 8},
+    {0x75564d6473784ec2ull, 8},
+    {0x756b97bacdc9da20ull, 11},
+    {0x756bddc034408b12ull, 6},
+    {0x756ca16300d9fbadull, 8},
+    {0x7584a51dfb44e1c2ull, 10},
+    {0x758b5c304c65e9ccull, 11},
+    {0x758e6baf83fc9b57ull, 7},
+    {0x759577d2759a3f3eull, 7},
+    {0x75c3cb4ea098507aull, 3},
+    {0x75c8560604692690ull, 11},
+    {0x75c9164789e7a197ull, 10},
+    {0x75ccf28abfc9ff96ull, 7},
+    {0x75cd2d8e5e82dc79ull, 10},
+    {0x75cf439e23cde669ull, 8},
+    {0x75d933b104dded52ull, 8},
+    {0x75e43c4880961505ull, 7},
+    {0x75e914ed6b152872ull, 7},
+    {0x75ec3aac12143564ull, 9},
+    {0x75ec7f431a56e495ull, 6},
+    {0x761780a95f5a1d9dull, 8},
+    {0x7618376eaf1b5045ull, 8},
+    {0x7618b96e9587d935ull, 7},
+    {0x761d2cc5195a1e84ull, 10},
+    {0x7637617d2bc5a421ull, 1},
+    {0x764f4fbd4d8fa919ull, 7},
+    {0x7653031b25a86d6bull, 10},
+    {0x7656df775a51ddb2ull, 11},
+    {0x765bd50d731731edull, 6},
+    {0x7662428f19fa9eefull, 10},
+    {0x766362acc252abc8ull, 11},
+    {0x7672e2dc3f0ad8dcull, 7},
+    {0x7673ce2eba9fe384ull, 9},
+    {0x767509776479c7f1ull, 11},
+    {0x7678d55e22e27bafull, 2},
+    {0x767eee1e505d1c5cull, 10},
+    {0x769a14eac5a94c52ull, 3},
+    {0x76a85183319270f4ull, 6},
+    {0x76c662ca2c760e81ull, 7},
+    {0x76c9bfa1954927b4ull, 1},
+    {0x76ca10f6af54f841ull, 10},
+    {0x76d02c3ab9a8f0bfull, 8},
+    {0x76d21d6c203bba75ull, 1},
+    {0x76f6d19ec3e81fd2ull, 7},
+    {0x770f3ffda2cc69dcull, 10},
+    {0x7710b3e7aed6fed3ull, 5},
+    {0x7725bd8d2f25e1afull, 6},
+    {0x773e2daf353031d3ull, 4},
+    {0x77403fd65d7b31b4ull, 8},
+    {0x77495d3bf64fbcceull, 8},
+    {0x774c8f30d2f5e6daull, 8},
+    {0x77569d88c701d4b3ull, 8},
+    {0x776a9cdbd0115731ull, 6},
+    {0x77713342f3146971ull, 3},
+    {0x777b9586592bea94ull, 6},
+    {0x778612b7a9ac6fddull, 0},
+    {0x7787f6bb7d90426bull, 6},
+    {0x7797cb0dada21079ull, 0},
+    {0x779db0ed7e9654e5ull, 6},
+    {0x77b172c5a933dfedull, 11},
+    {0x77d32003d32c513aull, 8},
+    {0x77d561fcd39e9361ull, 11},
+    {0x77de4c8b65a5b49eull, 0},
+    {0x77defa624b905005ull, 7},
+    {0x77e0cbb12bffa452ull, 10},
+    {0x77e0f1e29f3d7b48ull, 11},
+    {0x77e370f313b55b6eull, 6},
+    {0x77efb3205205132cull, 1},
+    {0x77f5732a24ee5eb4ull, 9},
+    {0x77f72daf6f40b258ull, 8},
+    {0x77faf807610258b4ull, 11},
+    {0x780343b416ed7d98ull, 11},
+    {0x780bc1037ca683b7ull, 6},
+    {0x78191b943e34f6f2ull, 11},
+    {0x78196a11430e7a0cull, 6},
+    {0x781a6095fcb5f15aull, 10},
+    {0x781be29d2781eff0ull, 11},
+    {0x7821d5cdb1044288ull, 7},
+    {0x783f3487f93fc3aaull, 7},
+    {0x784b72b98600a5b6ull, 9},
+    {0x7859b19600e5a51cull, 1},
+    {0x7865c1c6c30eca39ull, 10},
+    {0x786e62250e7bbd5aull, 6},
+    {0x78aab5fd7133d0cfull, 3},
+    {0x78b8e3589fdad1a1ull, 7},
+    {0x78bd681deee77368ull, 7},
+    {0x78bfb51ddae8c66aull, 6},
+    {0x78d43ad6a6e5fdb8ull, 6},
+    {0x78d9bf0b477e65a6ull, 7},
+    {0x78df4802b34a98fcull, 1},
+    {0x78e04d86f287991bull, 7},
+    {0x78e16f92c90e6e33ull, 0},
+    {0x78e5cbc86bc30c76ull, 7},
+    {0x78e84a62d1c60b9aull, 8},
+    {0x78eb745e4dbad5faull, 7},
+    {0x78f31392d7513b82ull, 7},
+    {0x78f80eb73abd7c1aull, 11},
+    {0x7901753c4a968a68ull, 7},
+    {0x7902263f7eba2017ull, 9},
+    {0x79057b7ffa4c88ebull, 11},
+    {0x790e8cb881aaad4eull, 3},
+    {0x790f895358f5c943ull, 9},
+    {0x791f67751b21cd6full, 11},
+    {0x79211cc41effdb91ull, 11},
+    {0x7929f6915acb08c2ull, 6},
+    {0x792bb1185ded0c94ull, 6},
+    {0x7939439201358f96ull, 9},
+    {0x7943bdcc1bea6615ull, 6},
+    {0x7971c7904256eeb2ull, 6},
+    {0x797880cc7b0666c6ull, 0},
+    {0x798e1cfd3c4692fdull, 6},
+    {0x7995c478ebfad259ull, 6},
+    {0x79aff8113fcdf37full, 7},
+    {0x79c935d558d3698aull, 0},
+    {0x79d274786002e8bbull, 9},
+    {0x79d43bd72556918dull, 6},
+    {0x79e1ac8e6f349aa2ull, 11},
+    {0x79e38d3d986b8bd0ull, 10},
+    {0x79fdf20dbf335145ull, 6},
+    {0x7a00dae227e7a40full, 8},
+    {0x7a1d0156ddcdb97full, 6},
+    {0x7a1ebfb46ae4b28aull, 7},
+    {0x7a1f52a330870cf3ull, 5},
+    {0x7a2c39e5230a181aull, 3},
+    {0x7a41d6f551ee097bull, 9},
+    {0x7a4fa996c84c5ad4ull, 8},
+    {0x7a556ca1df6b5a32ull, 7},
+    {0x7a6133a5824f7705ull, 3},
+    {0x7a62ae3d21acd97bull, 8},
+    {0x7a6bf178b4e36687ull, 9},
+    {0x7a6f7af12d2b9225ull, 7},
+    {0x7a8297a997d2ee04ull, 10},
+    {0x7a897536ec6e3963ull, 0},
+    {0x7a9357eb353b82d3ull, 10},
+    {0x7a953a83c0f6314aull, 8},
+    {0x7a9562dde4d2782bull, 8},
+    {0x7a99fefdab00dfd5ull, 6},
+    {0x7a9d6b29456d9c92ull, 7},
+    {0x7a9ea7cb640747a0ull, 4},
+    {0x7aa8628673e90c2dull, 6},
+    {0x7aab48b3bd6c7e0cull, 7},
+    {0x7ab82d41e31b2b00ull, 8},
+    {0x7abc50e7c9275c82ull, 11},
+    {0x7ac134a275e3880full, 6},
+    {0x7ad1993892e60557ull, 6},
+    {0x7ad34ced69b438a4ull, 1},
+    {0x7ad3a28a9f1610d2ull, 8},
+    {0x7ae472842f5769e8ull, 7},
+    {0x7ae4a0871f6e3305ull, 11},
+    {0x7af29c70d9fb3f1full, 7},
+    {0x7af3c1b3bad38712ull, 6},
+    {0x7b00d0846081c9efull, 8},
+    {0x7b344574062003f0ull, 7},
+    {0x7b3a3f73ccbe7d5full, 9},
+    {0x7b45633f49ab102aull, 4},
+    {0x7b4ca803865095d5ull, 11},
+    {0x7b503750a712923bull, 6},
+    {0x7b5d0baba224037cull, 8},
+    {0x7b6a4ca228732ec6ull, 0},
+    {0x7b6edbbe194e3f34ull, 0},
+    {0x7b77d5b9b92fd670ull, 8},
+    {0x7b7e46bab2c3dc33ull, 10},
+    {0x7b7f744eeed9d123ull, 7},
+    {0x7b91a1d89956c7e8ull, 6},
+    {0x7b9e1bb0bd6e0aecull, 7},
+    {0x7b9fcc93ea08d6d1ull, 7},
+    {0x7ba945bc07a61e20ull, 7},
+    {0x7bb36a87134cecc9ull, 9},
+    {0x7bc61714de51e8d6ull, 8},
+    {0x7bd3817d74b30ffbull, 11},
+    {0x7bd7019ad4850eaeull, 2},
+    {0x7bdc89a24fb3e286ull, 9},
+    {0x7bdeec8821307a78ull, 8},
+    {0x7bdf96842710a900ull, 9},
+    {0x7bfbabdebe3c2eadull, 1},
+    {0x7c21790f86e514a7ull, 8},
+    {0x7c26dcb39dcdaa18ull, 0},
+    {0x7c2c46f7c4e5db7full, 10},
+    {0x7c3464de5cfbcb49ull, 7},
+    {0x7c3aa0a28bccbf09ull, 8},
+    {0x7c3ac11debd263c4ull, 7},
+    {0x7c48bb93811fe4e1ull, 6},
+    {0x7c4ef2140938d8edull, 8},
+    {0x7c534f6c7a5a1286ull, 6},
+    {0x7c551ab5d0705578ull, 9},
+    {0x7c5a7313044d94baull, 11},
+    {0x7c5e43a2c47467e1ull, 11},
+    {0x7c6f6f9aab9bb569ull, 8},
+    {0x7c7aefc6a5d5d579ull, 8},
+    {0x7c8ee5d18a90ee2bull, 5},
+    {0x7c933e11e3823c9aull, 6},
+    {0x7c9d45d3b721667dull, 1},
+    {0x7ca22d9b82d2479full, 8},
+    {0x7caa9ae2fe921abcull, 3},
+    {0x7cb0ecf5f10e33d7ull, 9},
+    {0x7cb3ee71d329264dull, 9},
+    {0x7cca17282e0cf0c3ull, 6},
+    {0x7ccb96368307d88cull, 10},
+    {0x7cccfb82583de5deull, 11},
+    {0x7cf08f480c6ebbf2ull, 6},
+    {0x7d0b444231bd0b1eull, 7},
+    {0x7d1336be199314ecull, 3},
+    {0x7d1674c11bf03509ull, 8},
+    {0x7d19d23311c9e4c3ull, 10},
+    {0x7d1d91cd9146e268ull, 6},
+    {0x7d298a40537242b9ull, 8},
+    {0x7d34d2c4523082e9ull, 7},
+    {0x7d423c7eab1231e5ull, 10},
+    {0x7d42c934e1febc16ull, 2},
+    {0x7d49ef737b8e01d2ull, 7},
+    {0x7d52f328873dd05dull, 8},
+    {0x7d58d5dc343ed745ull, 6},
+    {0x7d6d55d3ce51e97cull, 8},
+    {0x7d6fcef5374ea5adull, 11},
+    {0x7d702664d674ca84ull, 9},
+    {0x7d7831f802de6f7bull, 9},
+    {0x7d7e671226dfa02bull, 6},
+    {0x7d98065b39229f7dull, 11},
+    {0x7d9a2b0c02d40653ull, 9},
+    {0x7d9cdef8ef76a6e5ull, 5},
+    {0x7d9fc9400926fcafull, 11},
+    {0x7da9ed4b011f8f9dull, 9},
+    {0x7db26358bf476371ull, 10},
+    {0x7db9302013d59f5cull, 7},
+    {0x7dbc0a1f54af384cull, 0},
+    {0x7dd74a18b1777c1full, 7},
+    {0x7de22c52d7824fa8ull, 7},
+    {0x7de40f10c82ca33full, 6},
+    {0x7de68a1890d6e5c9ull, 6},
+    {0x7df2bb4b534060f8ull, 7},
+    {0x7dfb2055df41f586ull, 0},
+    {0x7e093517839c96acull, 11},
+    {0x7e0e8d26dcb33e05ull, 11},
+    {0x7e0f3ee8ad77d3c6ull, 6},
+    {0x7e12c723e01a49adull, 6},
+    {0x7e15d9474f359437ull, 6},
+    {0x7e2ff18e9b180773ull, 10},
+    {0x7e4067d20962eeadull, 10},
+    {0x7e45b38df1e5787full, 8},
+    {0x7e49d8f826fb3b17ull, 7},
+    {0x7e4c2a0af84c40a6ull, 11},
+    {0x7e539af34ba0d9f1ull, 5},
+    {0x7e5a5a61feb2f57cull, 6},
+    {0x7e5b46568c40884aull, 0},
+    {0x7e5ccd5686690f9dull, 9},
+    {0x7e62e2ccb4329ee1ull, 8},
+    {0x7e7096da8291ae4cull, 1},
+    {0x7e7333d89901dbd5ull, 8},
+    {0x7e86e28c0c0f59eaull, 1},
+    {0x7e8d77a03292e25eull, 7},
+    {0x7e921c153f144e21ull, 6},
+    {0x7ea680ac38122504ull, 6},
+    {0x7ec6f5551085c899ull, 10},
+    {0x7ec869da987decb1ull, 11},
+    {0x7ece32919729d609ull, 7},
+    {0x7ef94596c0506a13ull, 5},
+    {0x7f01b45e25373cb6ull, 9},
+    {0x7f0e7cbb08378be6ull, 11},
+    {0x7f1044d59d07aeb6ull, 10},
+    {0x7f2b3e30c343095eull, 10},
+    {0x7f2d93a3fb578d1cull, 0},
+    {0x7f3284a12d1d7b2bull, 6},
+    {0x7f4bc17d90222b36ull, 0},
+    {0x7f4f91b56871f024ull, 6},
+    {0x7f58d0fa6b277097ull, 8},
+    {0x7f74e22336117263ull, 11},
+    {0x7f7a34e375844d54ull, 0},
+    {0x7f7bdd233c20c303ull, 6},
+    {0x7f8d4b595ae92356ull, 7},
+    {0x7f9206f3b73445f6ull, 8},
+    {0x7f97ac7e3f2e5fb1ull, 7},
+    {0x7f9c6d15c3da4338ull, 10},
+    {0x7f9de27299fd47a4ull, 9},
+    {0x7fa023bc8197ab79ull, 8},
+    {0x7faf9f58c34eac63ull, 7},
+    {0x7fbe22366aa0b799ull, 8},
+    {0x7fc2419d0c241f1cull, 1},
+    {0x7fd9f10f698eff05ull, 2},
+    {0x7fdc0b7d985e32a1ull, 6},
+    {0x7fe25b2f9e1f7a71ull, 3},
+    {0x7fe5188afa815008ull, 6},
+    {0x7fe5e23c84a0a911ull, 7},
+    {0x7fe9543ce553c006ull, 10},
+    {0x7ff3371f1719349cull, 6},
+    {0x7ff9fe33b41c93bbull, 9},
+    {0x8007f37f88d6e56full, 6},
+    {0x800d282ca63d634bull, 11},
+    {0x801b8556c5fe4bb6ull, 8},
+    {0x801c7e3abc8fb033ull, 10},
+    {0x801e2e019242803dull, 10},
+    {0x802a56e8fb2a495aull, 6},
+    {0x802e863ef8bdf9e1ull, 9},
+    {0x802ee49cfb4676d8ull, 2},
+    {0x80310c769ebf951bull, 6},
+    {0x8032522aa20d42f4ull, 7},
+    {0x80460d50246927c5ull, 10},
+    {0x8056ebbef2cc1e5cull, 7},
+    {0x805b8f49fcc1aee4ull, 2},
+    {0x805b956d5e3bc187ull, 10},
+    {0x8065cd093c821203ull, 10},
+    {0x8077c352677f1a04ull, 11},
+    {0x807f1190a5145329ull, 8},
+    {0x8084160204ae4739ull, 9},
+    {0x809d5bbe6b94cb34ull, 4},
+    {0x809de1eb1bb1a831ull, 7},
+    {0x80a881122293621aull, 10},
+    {0x80af3dc1a0ce31dcull, 8},
+    {0x80b37bc78139a7b8ull, 2},
+    {0x80d1a9170d74b279ull, 1},
+    {0x80d88063132cd5fdull, 7},
+    {0x80e6569d49f1d09aull, 9},
+    {0x8100ce0a91231f92ull, 9},
+    {0x810f822ebaa2cda2ull, 7},
+    {0x81101f44adfc9144ull, 1},
+    {0x8117536776e15f26ull, 3},
+    {0x811a2856666420cfull, 7},
+    {0x811e482e79ff5b3bull, 7},
+    {0x812269da0979e232ull, 1},
+    {0x814f350fe0ca34cbull, 6},
+    {0x8159211af6d554c4ull, 6},
+    {0x8163463bafef42d9ull, 6},
+    {0x816a01b0e678f1c5ull, 11},
+    {0x816c84eb4b278078ull, 6},
+    {0x8170f292c056ce2cull, 9},
+    {0x8185310e8c908636ull, 7},
+    {0x818afcd31e1b6f9dull, 7},
+    {0x81a149278194c542ull, 6},
+    {0x81bfc8d1d53a3a06ull, 6},
+    {0x81c7091316131555ull, 8},
+    {0x81c7221279637f9aull, 7},
+    {0x81cd0d0873761c1aull, 11},
+    {0x81dc38d2a64e3260ull, 2},
+    {0x81e3011e57c9e63eull, 7},
+    {0x81e34bc23cbb16c1ull, 6},
+    {0x81e600286557fb94ull, 6},
+    {0x81edbd30aa1f76b6ull, 5},
+    {0x81f41736bde09fecull, 7},
+    {0x81f63e4a294877f6ull, 11},
+    {0x82072d29c0d177adull, 8},
+    {0x8208bd46aac337b1ull, 11},
+    {0x821235ac62480fe1ull, 7},
+    {0x821d61ee8141ab59ull, 9},
+    {0x821f10de1603debfull, 9},
+    {0x8230204ceedfa074ull, 10},
+    {0x8234d66466789e25ull, 4},
+    {0x82392814024e5cc2ull, 6},
+    {0x823bf1de25c0fa8aull, 0},
+    {0x824d62c8c7b55aeaull, 7},
+    {0x82636a55d7683f72ull, 7},
+    {0x8263c56ad923f4ceull, 1},
+    {0x82666739a2415654ull, 10},
+    {0x827a4e6af450f305ull, 7},
+    {0x827a689f4b761349ull, 11},
+    {0x827a8ce04ab0b7c9ull, 10},
+    {0x827eeac0055337f8ull, 6},
+    {0x8282a847868adc1eull, 11},
+    {0x8289a2cec1f8ac3cull, 8},
+    {0x8290baa08a6a9dbaull, 9},
+    {0x82a11c065e5dd1ceull, 4},
+    {0x82a150d8221c0449ull, 10},
+    {0x82a3f02804269cf2ull, 6},
+    {0x82c2c82cc4c652ecull, 7},
+    {0x82c9335c1dea4c51ull, 10},
+    {0x82ca4c94dc97567dull, 7},
+    {0x82cd13d294cdc496ull, 11},
+    {0x82d93145e3e5bbbaull, 9},
+    {0x82ea434ac88d48a8ull, 1},
+    {0x82ebd503240aaa6bull, 8},
+    {0x83080a32b6ecfdc4ull, 11},
+    {0x830b879d0ad6f8c1ull, 9},
+    {0x83100cee77d905e0ull, 8},
+    {0x8311a058b140ecf4ull, 10},
+    {0x8320e1b8f64e32b9ull, 0},
+    {0x832988aabd3eeef9ull, 9},
+    {0x832c3d2c08df53e3ull, 6},
+    {0x8347bcb4d9a3b4a5ull, 7},
+    {0x834a093f37245665ull, 2},
+    {0x83554e0971543e78ull, 0},
+    {0x83587095158549b2ull, 7},
+    {0x83650f238308e073ull, 6},
+    {0x837f5be0c622e7f6ull, 6},
+    {0x839e350912c3481cull, 9},
+    {0x83a0b948b4b29c45ull, 7},
+    {0x83a73a560e7ae47dull, 9},
+    {0x83a77784cf12413bull, 8},
+    {0x83ad8d1047edfad2ull, 11},
+    {0x83aedf5e08c8744dull, 8},
+    {0x83b80f57be0180dcull, 6},
+    {0x83bb3cb516c56c18ull, 6},
+    {0x83c3ed05f7422cf8ull, 6},
+    {0x83c7fc2f29ba894full, 3},
+    {0x83cecc3de35241fcull, 6},
+    {0x83db08dfe4627686ull, 6},
+    {0x83e977e6b47303d9ull, 7},
+    {0x83eed76e9a98e4eeull, 3},
+    {0x83f0800fab6cecd1ull, 9},
+    {0x83f139dd31ab5c3aull, 2},
+    {0x83fa3e5b4a5ddb55ull, 9},
+    {0x83fc6a890cc95c96ull, 10},
+    {0x840ce13a827fd3baull, 8},
+    {0x84464157ae7315bcull, 7},
+    {0x844a088f3e85fee6ull, 6},
+    {0x8452cb88bd077644ull, 6},
+    {0x84566c06a7e09ebfull, 6},
+    {0x845727e53a5e17b2ull, 8},
+    {0x846a76fc0463685bull, 7},
+    {0x84716eff6f33ae48ull, 9},
+    {0x847393e73fab36a8ull, 11},
+    {0x847583a4aaca563aull, 8},
+    {0x848b9d45414ba917ull, 9},
+    {0x849166aaa3785177ull, 9},
+    {0x849a1237def4f92aull, 7},
+    {0x849bd135f8d96c20ull, 10},
+    {0x849c7d1edce306e4ull, 7},
+    {0x84b0ee32d764228aull, 6},
+    {0x84b32a2c36242e23ull, 11},
+    {0x84b34afbb7f72149ull, 11},
+    {0x84b401cb25063fd6ull, 6},
+    {0x84bf289151ea6afbull, 3},
+    {0x84c61e6d1eeb88ebull, 5},
+    {0x84ca16eed3d67f9cull, 11},
+    {0x84d34b5d557283d3ull, 10},
+    {0x84dd3f494d4cd6deull, 0},
+    {0x84e090a4adaecdebull, 1},
+    {0x84f549511d275021ull, 9},
+    {0x850019d0fb3f86bbull, 1},
+    {0x850482d201cfb963ull, 6},
+    {0x850a7a55a3565c2dull, 10},
+    {0x851f122b2574518cull, 3},
+    {0x85236a3f9e1a149full, 9},
+    {0x85261c5a2b7f3a4eull, 10},
+    {0x8534a69a96cb3f81ull, 6},
+    {0x85373f8fed619d80ull, 8},
+    {0x853c109ad998792bull, 2},
+    {0x855cb6b0fecc1064ull, 6},
+    {0x855e140dcb95ada5ull, 9},
+    {0x8561c63ff64d7142ull, 11},
+    {0x856ad1e9842c999dull, 8},
+    {0x8573b1caebc25f3eull, 8},
+    {0x8578a413d14cfe2cull, 10},
+    {0x85803e13d5beaf51ull, 7},
+    {0x858b4174e5be1d7full, 0},
+    {0x85986ac12600bf26ull, 1},
+    {0x859bd474a2493a47ull, 4},
+    {0x85a409a9d8d7f3c1ull, 11},
+    {0x85af0eed3be89ed4ull, 7},
+    {0x85b1e454395ff5e1ull, 0},
+    {0x85d7e9a3f647dfa4ull, 7},
+    {0x85dd9c8eaaaf7bc1ull, 8},
+    {0x85f931920fcd1772ull, 11},
+    {0x85fb44593fc1f874ull, 6},
+    {0x860eb1c2720c7461ull, 10},
+    {0x8610663ca2b4823full, 6},
+    {0x8619cac42afb4cbeull, 10},
+    {0x8619f4f88993dda8ull, 8},
+    {0x86478aad937c1c1eull, 8},
+    {0x8663f2f12a8bfc53ull, 6},
+    {0x86781581785e033full, 6},
+    {0x867ec33fd957983dull, 8},
+    {0x86a920a2cb85d5cfull, 2},
+    {0x86bc843a70805ac2ull, 11},
+    {0x86cf4f3e8ef49cb6ull, 7},
+    {0x86d33917c3dc326full, 10},
+    {0x86d51ed6d3a0de0full, 11},
+    {0x86e9ae388bfc6e12ull, 9},
+    {0x86f92f69b6bfc353ull, 0},
+    {0x8700d5e26a8d1ec7ull, 8},
+    {0x8705fbb27529b75bull, 7},
+    {0x870705ea90699d40ull, 11},
+    {0x87119f8687eabadcull, 10},
+    {0x8712d0c4ad8c821bull, 6},
+    {0x871c051162c9c6faull, 0},
+    {0x87286ef33db100f2ull, 2},
+    {0x87323de8816d58beull, 6},
+    {0x8734b4a4c93967deull, 8},
+    {0x87388443ba1fff5full, 6},
+    {0x87503bebd6cd79daull, 6},
+    {0x87577bf60f0b24d1ull, 7},
+    {0x875c59b47c90621dull, 10},
+    {0x875dcfe1dcd31d42ull, 8},
+    {0x875fbdb275da2e7full, 4},
+    {0x87606747223ed2d5ull, 1},
+    {0x8769cf93f59d415aull, 7},
+    {0x877cbbd42e6effb7ull, 8},
+    {0x878a31a038118d75ull, 9},
+    {0x87972c7ea8eddd21ull, 0},
+    {0x879a2b3984ba7e0dull, 10},
+    {0x879dfd699bf27195ull, 11},
+    {0x879e2ea910182dc2ull, 7},
+    {0x87aea614dd1a5fe4ull, 7},
+    {0x87dcab2461d4fd23ull, 8},
+    {0x87dfc8e48d503ebbull, 8},
+    {0x87e3469aa963f8dfull, 6},
+    {0x87e9053ef84ac9f1ull, 9},
+    {0x87f22a2fbfc50677ull, 8},
+    {0x87ff0b48ee8902ffull, 8},
+    {0x8803f8b2ad07ac8full, 6},
+    {0x881d052c00c705faull, 11},
+    {0x881e928c94ffbfa0ull, 6},
+    {0x882ccf57c6138b22ull, 8},
+    {0x8839e781faf4aab3ull, 10},
+    {0x8855e5827984f765ull, 1},
+    {0x886a7320253c1ae3ull, 6},
+    {0x886ad129adf2d7a4ull, 7},
+    {0x88a267cd2a161525ull, 9},
+    {0x88a5190e5628aab4ull, 8},
+    {0x88a6354ad29a54f8ull, 7},
+    {0x88aa8664365aa334ull, 8},
+    {0x88b6e75e4077e844ull, 7},
+    {0x88bbb9f84095e36cull, 11},
+    {0x88bbc893bbdfa21aull, 7},
+    {0x88bd8f834070d039ull, 11},
+    {0x88c8dc174e45a3abull, 3},
+    {0x88cd4e24cce3dc2full, 6},
+    {0x88d10c61770ef292ull, 10},
+    {0x88d96b66a2881d67ull, 10},
+    {0x88edd92841a00ccbull, 0},
+    {0x88fabdeb4f34bddcull, 8},
+    {0x89146a3294a46293ull, 11},
+    {0x8915cee351f9a8aaull, 0},
+    {0x8917566c153047c9ull, 6},
+    {0x892582a6ecf695c4ull, 7},
+    {0x8925f88881a1d3b1ull, 8},
+    {0x8939df4c324a4f7aull, 9},
+    {0x893b7b0e57f16058ull, 2},
+    {0x893c2e76d45ba08aull, 6},
+    {0x894e7743fdace863ull, 8},
+    {0x896c8428f6fb213eull, 6},
+    {0x8973ee692d5a6cd7ull, 9},
+    {0x8997460f25eaa130ull, 8},
+    {0x899e9178a1d6e2e5ull, 11},
+    {0x89a31dbbedbde572ull, 11},
+    {0x89bb675400e49604ull, 6},
+    {0x89c3331c8f28ba0full, 6},
+    {0x89cdbde450577695ull, 1},
+    {0x89d6f9b7640480c9ull, 7},
+    {0x89d9671cdba715e8ull, 6},
+    {0x89de8d95bf81380aull, 1},
+    {0x89e0e4f82ee5ee5bull, 10},
+    {0x89e14c082d2963f3ull, 11},
+    {0x89e959f1a014dc49ull, 7},
+    {0x89f0f3ddd18fe393ull, 6},
+    {0x89f40a12359e81f2ull, 2},
+    {0x8a05274193cef696ull, 7},
+    {0x8a1f37b993345d6bull, 8},
+    {0x8a28741f934df073ull, 2},
+    {0x8a2c3213f2267f25ull, 6},
+    {0x8a31fdb45393b7a9ull, 6},
+    {0x8a353a51e61bd80dull, 6},
+    {0x8a37c65cbed62387ull, 6},
+    {0x8a3803190911a17full, 11},
+    {0x8a49dca14328ceb3ull, 7},
+    {0x8a4cbcbbb2389804ull, 7},
+    {0x8a4f52378d60e9c0ull, 1},
+    {0x8a58a3ea01f31daaull, 8},
+    {0x8a5eb2dcffacbed3ull, 9},
+    {0x8a65a87b70cbb7b2ull, 10},
+    {0x8a6a18ce44a9ef30ull, 6},
+    {0x8a7847f7fdf4ef4bull, 0},
+    {0x8a7a1b61fbe7e3d9ull, 9},
+    {0x8a803f73774fdc25ull, 7},
+    {0x8a899245e921f43bull, 0},
+    {0x8a8ea8641fddb91full, 9},
+    {0x8a9f745849921d12ull, 7},
+    {0x8aa3a7dda9627c9cull, 8},
+    {0x8aa628dcfb5eefaeull, 6},
+    {0x8aaa1b98104393e2ull, 0},
+    {0x8abeeab2bc8babe8ull, 8},
+    {0x8ac2151f2018d439ull, 8},
+    {0x8add52961121b88bull, 9},
+    {0x8aea524a1b11f292ull, 0},
+    {0x8aef02ca69b5167aull, 6},
+    {0x8af457254c6c9f57ull, 7},
+    {0x8afb829ff547e849ull, 6},
+    {0x8b185028f16b7fe0ull, 8},
+    {0x8b3a9e66037ce333ull, 6},
+    {0x8b3cfa90ad0e01e7ull, 11},
+    {0x8b404d48fcb494d0ull, 6},
+    {0x8b4d1ad224a86fa4ull, 6},
+    {0x8b5f26bf3d5f3246ull, 9},
+    {0x8b6ead1f5b25d096ull, 6},
+    {0x8b6ff2112b621d09ull, 10},
+    {0x8b8ff40bf212de13ull, 7},
+    {0x8b9dc0d443269874ull, 7},
+    {0x8bbbb95ec11480a6ull, 3},
+    {0x8bbd28bb98b766d5ull, 8},
+    {0x8bec820d1a0ed83full, 6},
+    {0x8c0521d2f79d435cull, 11},
+    {0x8c06ba86e9c88de6ull, 10},
+    {0x8c09841e1e48871cull, 8},
+    {0x8c0f9e6593deae06ull, 10},
+    {0x8c0ff3f6f5dbd8dbull, 8},
+    {0x8c18d7275387c702ull, 6},
+    {0x8c22376502bdf02cull, 6},
+    {0x8c35b360e9afd9b2ull, 9},
+    {0x8c47b0174295bdacull, 10},
+    {0x8c487bee98685c73ull, 8},
+    {0x8c7b292b2d71f73bull, 2},
+    {0x8c994e6f68784a81ull, 10},
+    {0x8ca1119f466ff187ull, 9},
+    {0x8caf4fc58f41c5aaull, 11},
+    {0x8cb479eab24dd3a5ull, 1},
+    {0x8cc0c614eab25d1full, 11},
+    {0x8cc437b54f7e3795ull, 6},
+    {0x8ce37ece341c775cull, 10},
+    {0x8cebee2ea89c5a64ull, 3},
+    {0x8cf0245caacfafecull, 6},
+    {0x8cf13b6d780af5e0ull, 4},
+    {0x8cf75b797c85a480ull, 8},
+    {0x8d022938b38db958ull, 11},
+    {0x8d03d3d71ebb9dc6ull, 9},
+    {0x8d0a9914e93ffd85ull, 10},
+    {0x8d1439e2ff82b45dull, 10},
+    {0x8d1ab4a2fd742c5dull, 7},
+    {0x8d26a6409847edacull, 5},
+    {0x8d3ecc8bf0706f29ull, 11},
+    {0x8d4071f68ca116abull, 9},
+    {0x8d45d3a5f7c3b431ull, 3},
+    {0x8d57bd9260c422a0ull, 8},
+    {0x8d69bbe658acdd9dull, 7},
+    {0x8d7cce6e4d5fbcaaull, 6},
+    {0x8d870ac970bd9131ull, 0},
+    {0x8d8bf165614fc5dcull, 11},
+    {0x8d906b4e6cd01167ull, 9},
+    {0x8d924dcf4b63a61eull, 7},
+    {0x8da205b0761b69c1ull, 11},
+    {0x8da4aeaa2369255full, 8},
+    {0x8da9c1b471e7be78ull, 8},
+    {0x8dae6730f944010cull, 6},
+    {0x8daf4fc140e1c22dull, 4},
+    {0x8dd3aab113fc9dfeull, 6},
+    {0x8dd419d7cc3ae712ull, 5},
+    {0x8de779114398e690ull, 8},
+    {0x8df00d7431a16914ull, 2},
+    {0x8df724cb8108fd17ull, 6},
+    {0x8dfe7b9ad0b256a3ull, 11},
+    {0x8e052390bf52f190ull, 5},
+    {0x8e122176a74797c6ull, 6},
+    {0x8e1d2debf76e7675ull, 7},
+    {0x8e1d9261a17631d0ull, 6},
+    {0x8e1d9589185aefb8ull, 6},
+    {0x8e1e8cfddfd6bc5full, 7},
+    {0x8e268f166b5b8d2eull, 0},
+    {0x8e3145a858011fd9ull, 3},
+    {0x8e3924fc65f068f9ull, 10},
+    {0x8e3ed57453f8ae22ull, 6},
+    {0x8e4a8258f9b409daull, 11},
+    {0x8e52967ee5296efdull, 6},
+    {0x8e56b6f06c0ee63aull, 10},
+    {0x8e64336f2dd59284ull, 8},
+    {0x8e6d2d435e57c4afull, 7},
+    {0x8e6d553a44556734ull, 6},
+    {0x8e941a47e0727b36ull, 7},
+    {0x8e9fcbc0803b6bbdull, 6},
+    {0x8eafa5e09f3b0a1full, 9},
+    {0x8ebd64952ebbd717ull, 7},
+    {0x8edd57b9de251590ull, 9},
+    {0x8eded2fd82c803e0ull, 11},
+    {0x8ee723ac6db1fd89ull, 11},
+    {0x8eec3e8cb9e6ef4cull, 11},
+    {0x8ef794e0f65435ccull, 11},
+    {0x8f0f98b18143c727ull, 10},
+    {0x8f11b4820e35bd37ull, 7},
+    {0x8f166d4739be2dd8ull, 9},
+    {0x8f1badd835f84b2cull, 10},
+    {0x8f4052cfe059b900ull, 6},
+    {0x8f40d66322eb7202ull, 7},
+    {0x8f4735d79c591515ull, 10},
+    {0x8f4c1831572f34e1ull, 8},
+    {0x8f4fa0cf7a3d3821ull, 7},
+    {0x8f6133f7e2e8f868ull, 7},
+    {0x8f66a753cbe3f3c1ull, 1},
+    {0x8f6faad818f70853ull, 11},
+    {0x8f722c8b460a260eull, 10},
+    {0x8f7394ad069a1c54ull, 1},
+    {0x8f76ec472273fddaull, 7},
+    {0x8fa3855643be68d1ull, 7},
+    {0x8fa48f2abb11512aull, 0},
+    {0x8fca08136a1d2a1dull, 9},
+    {0x8fd8f15fe3a3b40eull, 6},
+    {0x8fd99eb89ee99072ull, 10},
+    {0x8fdfcfc058a28671ull, 10},
+    {0x8fe00938e625979full, 4},
+    {0x8feafbe4ffae9aa3ull, 8},
+    {0x8ff44651e082ac0aull, 0},
+    {0x900790589d93acddull, 11},
+    {0x902aaf42e987bcdaull, 6},
+    {0x9055546373641f28ull, 0},
+    {0x90640ec714904179ull, 11},
+    {0x90733854e211522eull, 7},
+    {0x90790a8cda59ebffull, 1},
+    {0x907f7fe64b401a1aull, 11},
+    {0x9091a270da6e8710ull, 7},
+    {0x9091b263e8a67d16ull, 1},
+    {0x9094fadfa88c9eb0ull, 11},
+    {0x909ef0035cda6145ull, 8},
+    {0x90a02935567a5ceeull, 6},
+    {0x90aa217b6f3b772bull, 8},
+    {0x90afa717c830d8eaull, 7},
+    {0x90b9186886fb0ec4ull, 9},
+    {0x90cb9399069ed060ull, 8},
+    {0x90d1fcdab11d455full, 7},
+    {0x90da077a4093f806ull, 3},
+    {0x90dce3641ef9363full, 7},
+    {0x90e1e9801cf5ab10ull, 6},
+    {0x90e41989974294cdull, 8},
+    {0x90e55f7b00d1031cull, 7},
+    {0x90e6773b6b0f4c83ull, 6},
+    {0x90edd8fb1b0566ddull, 7},
+    {0x9102b357205182c7ull, 0},
+    {0x9106756c1ed201eaull, 7},
+    {0x910c1b3fa1c78a42ull, 10},
+    {0x9114008939d982d1ull, 6},
+    {0x911c90f58edd71bfull, 8},
+    {0x912bbf2fa36af8c4ull, 10},
+    {0x9130523c373e678bull, 9},
+    {0x91319f21c4164a28ull, 6},
+    {0x9147a1ffad7fbf10ull, 8},
+    {0x914ffae244f52d93ull, 9},
+    {0x9152e5fc21815e35ull, 7},
+    {0x9154342313b6d84bull, 9},
+    {0x915da82f0c6d4467ull, 11},
+    {0x918a5a807eeda45eull, 6},
+    {0x9195c23d71e2e491ull, 11},
+    {0x9195fa5b26750960ull, 10},
+    {0x919d4dbcad5190afull, 7},
+    {0x919e6529c0b072d4ull, 6},
+    {0x91a1ac782237e5e0ull, 5},
+    {0x91a5d2cf673183ffull, 1},
+    {0x91bd1d8e2525b1fcull, 8},
+    {0x91c443dc585623b6ull, 6},
+    {0x91c484139fbe033eull, 7},
+    {0x91c64c9c693a3b38ull, 7},
+    {0x91d040c41dae78d8ull, 11},
+    {0x91d15b728d090551ull, 6},
+    {0x91d55439f8e830f4ull, 11},
+    {0x91dd81e2604401b1ull, 11},
+    {0x91de79806de35701ull, 1},
+    {0x91f04202d3601778ull, 8},
+    {0x9209f5d73462f40full, 6},
+    {0x920c3c2f259b1384ull, 7},
+    {0x9220a22ebc7473a3ull, 10},
+    {0x923f8021cc7cdaa0ull, 9},
+    {0x9242c65064a1c34eull, 10},
+    {0x92471ade365f8b65ull, 6},
+    {0x9248de8be961620eull, 7},
+    {0x924bbc9f7547d35full, 8},
+    {0x924e4c8736c5f293ull, 8},
+    {0x9251d1e5417d632dull, 9},
+    {0x925f29220ca8532cull, 10},
+    {0x92686ca26c65ab76ull, 8},
+    {0x9273ed3ea5d532c7ull, 6},
+    {0x9278901b621e637cull, 6},
+    {0x927e28f9a311a78dull, 0},
+    {0x92853e8866eed321ull, 1},
+    {0x9289d23eaa9bab08ull, 9},
+    {0x9297534c3b65af58ull, 10},
+    {0x92989fa9ae862cd0ull, 9},
+    {0x9298cf90b24ab320ull, 11},
+    {0x92aaa34fda61ed4eull, 7},
+    {0x92b5fd9917dd290full, 7},
+    {0x92bc9df3c7f86251ull, 7},
+    {0x92c01655ef6bb493ull, 1},
+    {0x92d29750dbf64b96ull, 8},
+    {0x92d951c4a834edcbull, 7},
+    {0x92e39eb1006abf6bull, 6},
+    {0x92e45fbdd024ba36ull, 8},
+    {0x92eb1d38d02e6609ull, 6},
+    {0x92f1edcccb71559bull, 6},
+    {0x92f68f8237e090d6ull, 9},
+    {0x930f9751b163f0a1ull, 8},
+    {0x931d1c7060b231ecull, 11},
+    {0x932472ca43c0280bull, 8},
+    {0x93283578ea91603full, 11},
+    {0x932e67f361abc849ull, 9},
+    {0x93471c71d1093d0dull, 10},
+    {0x934ccda2c893f290ull, 6},
+    {0x934e361187525333ull, 11},
+    {0x935826f5c62a6426ull, 1},
+    {0x936122ecf5c4521cull, 10},
+    {0x937efe86994fbbe2ull, 0},
+    {0x93842643913e512eull, 6},
+    {0x9384ed2adfebda1dull, 11},
+    {0x9395979e60c00cbaull, 8},
+    {0x939c43e134a8366aull, 1},
+    {0x93b10a0207ace7f9ull, 7},
+    {0x93b49ee9e1e5e911ull, 7},
+    {0x93c2f4234cfa3ef2ull, 10},
+    {0x93c6525a11751b21ull, 6},
+    {0x93cb8c9c04e774b7ull, 0},
+    {0x93cd8e652939a52cull, 9},
+    {0x93d623434b7c7d98ull, 5},
+    {0x93f3c2445dd6f308ull, 8},
+    {0x941c5314e00b7bcaull, 11},
+    {0x9424e2d1d848fa78ull, 10},
+    {0x942f818e3a52107aull, 11},
+    {0x94405d8e227064baull, 9},
+    {0x944166ab357b2f0cull, 4},
+    {0x94555352926186c8ull, 10},
+    {0x9483de366a1340bdull, 8},
+    {0x948a1f96cfe78551ull, 7},
+    {0x948fe87436e2815dull, 2},
+    {0x949610d86bc8fcd9ull, 9},
+    {0x949a9fc30ac0e62dull, 11},
+    {0x94b58bfdbd03f720ull, 7},
+    {0x94c9630d6fdbb3c1ull, 10},
+    {0x94ce0ffcb3454141ull, 8},
+    {0x94d90a9015f68469ull, 9},
+    {0x94e3d580021daa5dull, 10},
+    {0x94ed2c64d83bb6e2ull, 11},
+    {0x94efeb668ac7f5a3ull, 6},
+    {0x94f0c3903f66cb13ull, 9},
+    {0x9516dc99de06685eull, 2},
+    {0x951a720974f8c484ull, 7},
+    {0x951c1a6fe1dd71a8ull, 6},
+    {0x95223322ba03f5a7ull, 8},
+    {0x952930b29bf05a73ull, 7},
+    {0x952e87cbbd333c9dull, 6},
+    {0x954c9a02971c28f7ull, 7},
+    {0x955687f679121a2dull, 7},
+    {0x956176131fb8c1f0ull, 9},
+    {0x956ce88c62b392adull, 6},
+    {0x956d84960bb90079ull, 1},
+    {0x9577448c13351aa7ull, 2},
+    {0x9578771ffe7b2b14ull, 11},
+    {0x957f60692552de43ull, 10},
+    {0x959af75d80c414caull, 8},
+    {0x95b54a1baf62b297ull, 8},
+    {0x95ba91d214e1d42full, 6},
+    {0x95bf0db13e73b985ull, 11},
+    {0x95cd5d1a634c7e20ull, 11},
+    {0x95ce726914ce787bull, 11},
+    {0x95cf7f7f1b648aa1ull, 9},
+    {0x95dfaec7d907f09aull, 7},
+    {0x95edd44433fc25bdull, 9},
+    {0x95fe912479b09571ull, 6},
+    {0x9601a7b6369cb169ull, 9},
+    {0x960b2d363ecc63b6ull, 3},
+    {0x960c1b22a58b5b47ull, 8},
+    {0x961dfbc9d7470c54ull, 1},
+    {0x9622ecd8e69b5d0eull, 8},
+    {0x9626800bedabd083ull, 6},
+    {0x9638956a8231c88eull, 7},
+    {0x96395274d30c515eull, 1},
+    {0x963cdee7345c526dull, 10},
+    {0x9653ad950ed31febull, 7},
+    {0x96561d2e887650deull, 7},
+    {0x965a11c612f19775ull, 7},
+    {0x9675059a878a504bull, 9},
+    {0x9677abbf275711c9ull, 8},
+    {0x967ba191c7648dd0ull, 2},
+    {0x969252033688a0c2ull, 6},
+    {0x9697e8cab4b3148bull, 0},
+    {0x969d7a774a3b47cbull, 0},
+    {0x96b02902c529b716ull, 6},
+    {0x96b39dc58f1d30a0ull, 9},
+    {0x96b4037c6ba60595ull, 6},
+    {0x96bbe972b4a62149ull, 9},
+    {0x96bc031df8554771ull, 9},
+    {0x96c1dc1600a0197full, 7},
+    {0x96c7ab223cd38e2full, 1},
+    {0x96d072a6db6d68d1ull, 11},
+    {0x96d37535e948fdc9ull, 8},
+    {0x96dc46f4fcfd4befull, 9},
+    {0x96ed3c1d881d2941ull, 0},
+    {0x96fa35a263193187ull, 6},
+    {0x96fafde602c78c53ull, 2},
+    {0x97091eacc8f39db9ull, 7},
+    {0x97157f96beded6c9ull, 6},
+    {0x971caaf35bb831b4ull, 10},
+    {0x971d11c9c3591039ull, 8},
+    {0x971dee00e63cbaf5ull, 11},
+    {0x971fdc44a011d459ull, 11},
+    {0x97256ac1d866a4b8ull, 8},
+    {0x972d4eba3f90a19dull, 9},
+    {0x972d9ceb263fab9bull, 7},
+    {0x972df6d8d0a43850ull, 6},
+    {0x9735af2cf58d80abull, 6},
+    {0x97365c5679dfa89dull, 10},
+    {0x973bb0bf80a0e254ull, 8},
+    {0x97490558788454c0ull, 0},
+    {0x9753fdebb6c70163ull, 8},
+    {0x975557ed7cfe2ab2ull, 7},
+    {0x976bed69880efe54ull, 0},
+    {0x9770a1bfe1cae5b1ull, 11},
+    {0x9785c028031a853full, 10},
+    {0x9789bdc4aa273da1ull, 8},
+    {0x978ed2738e1abcc6ull, 9},
+    {0x97937650f0558856ull, 7},
+    {0x9796637fe8b0d4f1ull, 9},
+    {0x97ddda4c8ac381edull, 7},
+    {0x97e2290877ff72d8ull, 6},
+    {0x97ee09cea5024dc5ull, 11},
+    {0x97eeb443e88699b9ull, 9},
+    {0x97f2f81ec087bfdcull, 11},
+    {0x97f4e18203af62cfull, 1},
+    {0x97f6076b3726665dull, 10},
+    {0x97f8f04be9ff3221ull, 6},
+    {0x97faec7c95b08ff9ull, 7},
+    {0x9809419a166e4c61ull, 0},
+    {0x980c4cbff7a7cd9dull, 7},
+    {0x980c6b6136386832ull, 7},
+    {0x981d4e5dcfd5b1e4ull, 10},
+    {0x9829a968c6b8b3f8ull, 9},
+    {0x9832151b329f91b4ull, 7},
+    {0x9838d89686486f70ull, 7},
+    {0x983be847a3371accull, 7},
+    {0x983e03547c5816c8ull, 9},
+    {0x984422a940a8b8abull, 7},
+    {0x984f40a4e2e36218ull, 0},
+    {0x986de5f049caa00bull, 7},
+    {0x98766a2e3b66448aull, 7},
+    {0x987c502c73f90036ull, 7},
+    {0x988a68698f235a63ull, 8},
+    {0x989634a28d3747a4ull, 7},
+    {0x98a0f845fdf00c4dull, 10},
+    {0x98b512e7cf789b3bull, 6},
+    {0x98c2aa2b0abc1e48ull, 10},
+    {0x98dd9d0a3c87b5dcull, 0},
+    {0x98e67825f59d6350ull, 8},
+    {0x98f1b35170953f26ull, 7},
+    {0x98f844b2380aa837ull, 8},
+    {0x98fa7cba26b011dbull, 1},
+    {0x98fcfb62b157e125ull, 7},
+    {0x98fe12824bda6592ull, 7},
+    {0x991085795d9d7e7bull, 8},
+    {0x992069bd3d70ea30ull, 10},
+    {0x993bed06f9a74cabull, 4},
+    {0x993ee5aa88a9f13full, 8},
+    {0x99488c9b74e57dc2ull, 9},
+    {0x994de0d79ffc7b0dull, 6},
+    {0x995ee3b563bc4da0ull, 7},
+    {0x995fa50a484050cfull, 10},
+    {0x99728b5af8e72cf6ull, 7},
+    {0x9979a44fcc1ec85dull, 4},
+    {0x997a459dbb05a1c9ull, 0},
+    {0x998bf6c3f3a03b2eull, 1},
+    {0x998f9ddabdaa5d6cull, 11},
+    {0x9990e3431d47b0b1ull, 10},
+    {0x999692c29f7baca4ull, 0},
+    {0x999aa9a7dae75825ull, 0},
+    {0x99b06ffe0f8cf876ull, 3},
+    {0x99bd1b58458337eaull, 8},
+    {0x99cae89bdfc2ef71ull, 10},
+    {0x99d89d618aa288c0ull, 10},
+    {0x99e3308d31ebf10bull, 7},
+    {0x99e34c6671682206ull, 9},
+    {0x99e3ae0eb033cdcfull, 9},
+    {0x99ea78e259a53c1full, 8},
+    {0x9a07b66ae41735d7ull, 6},
+    {0x9a080ef3a667daf2ull, 4},
+    {0x9a1527dd9086ede6ull, 6},
+    {0x9a17cc3e8d1657a5ull, 8},
+    {0x9a2873a3ae0caf90ull, 4},
+    {0x9a3c1a96db27d62aull, 8},
+    {0x9a3d273d13aa3e0bull, 3},
+    {0x9a45695b1cf76ed4ull, 6},
+    {0x9a63ede6e826525aull, 9},
+    {0x9a65b00e12fd9becull, 11},
+    {0x9a6ac3fe9c415917ull, 6},
+    {0x9a722b6ba7d900d2ull, 6},
+    {0x9a7b9e97fb383428ull, 8},
+    {0x9a8244cb9a058942ull, 3},
+    {0x9a84d538e9a44eb0ull, 9},
+    {0x9a90319fa7d369faull, 6},
+    {0x9a92ccc82adf3cf8ull, 11},
+    {0x9a9ba7034d460357ull, 9},
+    {0x9aa57b1ceabd832eull, 9},
+    {0x9aac08494aef68baull, 8},
+    {0x9ab71aea7474c7beull, 11},
+    {0x9ab7b4a997c0968eull, 8},
+    {0x9aba667c9e5471d4ull, 8},
+    {0x9abc8aa2b38c8ce3ull, 4},
+    {0x9abc8ae3dbdd6f01ull, 3},
+    {0x9acf8bc797bfbcb5ull, 0},
+    {0x9ad6d6f550100610ull, 8},
+    {0x9aea69b7e36e6748ull, 7},
+    {0x9aff669116288becull, 6},
+    {0x9b1def7ae6bc54f1ull, 6},
+    {0x9b35cd46b31ca03dull, 1},
+    {0x9b4a9559d39abd20ull, 11},
+    {0x9b50f1c84354b761ull, 6},
+    {0x9b529ed143b69327ull, 7},
+    {0x9b52d693af01085bull, 0},
+    {0x9b594a1494ac246cull, 7},
+    {0x9b5f4c044a22747dull, 11},
+    {0x9b655f85934eeb91ull, 10},
+    {0x9b7654539a3af7f8ull, 7},
+    {0x9b76881f7e280624ull, 11},
+    {0x9b832f3b33f33fa5ull, 7},
+    {0x9b85089852d07504ull, 6},
+    {0x9b89f19a82d8d2e7ull, 8},
+    {0x9b8c2db4aea8c705ull, 8},
+    {0x9ba6ecb9eb1a8564ull, 6},
+    {0x9baa4a6fd120614full, 10},
+    {0x9bac52e8c2336758ull, 6},
+    {0x9bb006174528bc26ull, 10},
+    {0x9bd49ba144317486ull, 0},
+    {0x9bf15c7c1a2912b5ull, 6},
+    {0x9bff7aade9a412a9ull, 8},
+    {0x9c10dafda3ed510eull, 0},
+    {0x9c14acb19dd79563ull, 10},
+    {0x9c15a2abda27acdbull, 0},
+    {0x9c27ed55e931eca6ull, 6},
+    {0x9c39589246004fd9ull, 2},
+    {0x9c55ad6c99b7cb42ull, 10},
+    {0x9c66c33657659db2ull, 9},
+    {0x9c70a2a0019ddb54ull, 9},
+    {0x9c7323a52af28e42ull, 7},
+    {0x9c765f30710f583aull, 8},
+    {0x9c82e464e1b19e5bull, 8},
+    {0x9c916960beaae6d1ull, 8},
+    {0x9c948baeabdc715aull, 11},
+    {0x9c9fbae7e30fb772ull, 6},
+    {0x9cb060173f8f037aull, 7},
+    {0x9cb1464407de9967ull, 10},
+    {0x9cd3c07e4aeb9ee9ull, 6},
+    {0x9ce063d7242771cdull, 7},
+    {0x9ce98b74eb7d37faull, 7},
+    {0x9cf2996e28ad9dd1ull, 6},
+    {0x9cf8d5c82e946d54ull, 9},
+    {0x9cfde007a046f265ull, 7},
+    {0x9d02c810dcb53ac4ull, 7},
+    {0x9d123d4196cbbee5ull, 7},
+    {0x9d2b6de265c83408ull, 7},
+    {0x9d49db8236247625ull, 4},
+    {0x9d576428cc1e8edbull, 6},
+    {0x9d585f4b2fe96032ull, 8},
+    {0x9d651e7495a2067cull, 6},
+    {0x9d677f62723617b1ull, 8},
+    {0x9d728efce53e672bull, 11},
+    {0x9d855a2a7abc5a4aull, 8},
+    {0x9d8992d3376c4088ull, 5},
+    {0x9d8a960b4c02bbf5ull, 8},
+    {0x9d8fbd322c290044ull, 8},
+    {0x9d92a312873167bdull, 11},
+    {0x9d9c316e6c20594bull, 10},
+    {0x9da3a00815b0186cull, 9},
+    {0x9daac1e63466ba6dull, 10},
+    {0x9dbc8816e8aae032ull, 9},
+    {0x9e0770843bf0353full, 8},
+    {0x9e0786bcea2e6472ull, 8},
+    {0x9e0a96b0a542fe91ull, 8},
+    {0x9e0e46532e90d603ull, 8},
+    {0x9e144fc22295ffdeull, 9},
+    {0x9e16ba84f8ada3a6ull, 7},
+    {0x9e19fb856640b94cull, 6},
+    {0x9e23dcfbbf26d292ull, 7},
+    {0x9e25c46244ef1d0eull, 11},
+    {0x9e2985dc612650e0ull, 8},
+    {0x9e3a7e9fe714dfccull, 6},
+    {0x9e3ad3872c79cc2dull, 10},
+    {0x9e485330c32be940ull, 7},
+    {0x9e527399895fdb8aull, 6},
+    {0x9e68cc00201c23beull, 10},
+    {0x9e690a2e46043abdull, 11},
+    {0x9e7c277cc4194e2dull, 6},
+    {0x9ea745a6fb73939bull, 9},
+    {0x9eaca136ce7e6dd9ull, 8},
+    {0x9eb141b445ff3e04ull, 8},
+    {0x9ec65e4bf9af20b8ull, 10},
+    {0x9ed73605ba72b384ull, 9},
+    {0x9edb0048eb792424ull, 6},
+    {0x9edbdedba8c8e9d2ull, 11},
+    {0x9ee2551376b66349ull, 10},
+    {0x9ee292dcb15e43c1ull, 7},
+    {0x9ee357844cc3c01full, 0},
+    {0x9ee9755bef9b8ce9ull, 6},
+    {0x9f12553bf8a7365aull, 9},
+    {0x9f12732b346af203ull, 11},
+    {0x9f127abb535fd969ull, 6},
+    {0x9f3a74a9b2515003ull, 7},
+    {0x9f3c79c7fb2118eaull, 9},
+    {0x9f424046a4c9c05aull, 5},
+    {0x9f59d7f66091b14aull, 7},
+    {0x9f5fe2b2eaf82dcfull, 8},
+    {0x9f8967ef08c5dc92ull, 8},
+    {0x9fa46bb7767fdbe2ull, 8},
+    {0x9fac7124d3fffafaull, 2},
+    {0x9faed93f724d3d4eull, 6},
+    {0x9fb696864dbd2b3eull, 6},
+    {0x9fba146479a2ab40ull, 9},
+    {0x9fc0770e72aed848ull, 2},
+    {0x9fe60cdaa60fe342ull, 10},
+    {0x9fe9ec44ee6d14e6ull, 2},
+    {0x9feb2cea4ccd1c9aull, 8},
+    {0x9feb67a2210788e5ull, 6},
+    {0x9fefe75e305bdc54ull, 8},
+    {0x9ff14121fa617cf9ull, 9},
+    {0xa00bb892c0fb88c3ull, 11},
+    {0xa0121f0c2d9d85ceull, 2},
+    {0xa0181e9a44159f18ull, 7},
+    {0xa01846322a2ae53bull, 3},
+    {0xa018d789ec3e158eull, 0},
+    {0xa01bab430dd528b7ull, 6},
+    {0xa0247167918f7d2aull, 10},
+    {0xa02a89fe1e3189cfull, 10},
+    {0xa03027b73de10370ull, 7},
+    {0xa03737c3cf5c384full, 10},
+    {0xa03a126944983404ull, 0},
+    {0xa049fa76c85e780cull, 6},
+    {0xa0521d4bcd6e5748ull, 8},
+    {0xa05eb532cb7887f0ull, 6},
+    {0xa05fa1f6ad811c1bull, 2},
+    {0xa073fefcaac67c98ull, 11},
+    {0xa0770984f0b19848ull, 10},
+    {0xa07ed81f28e7d4f2ull, 9},
+    {0xa08573f61a97b133ull, 11},
+    {0xa08c2dc9f6c8fd40ull, 11},
+    {0xa08eaf8a2b09803cull, 6},
+    {0xa091764ab955c0b0ull, 8},
+    {0xa0af2ab598223a06ull, 2},
+    {0xa0b1b10150a7329bull, 7},
+    {0xa0b299bbc053faf1ull, 9},
+    {0xa0b48f2212ffceeeull, 6},
+    {0xa0b5460563ae6f38ull, 4},
+    {0xa0e5f816dfc3cb94ull, 7},
+    {0xa0e7f35ecc1497cbull, 7},
+    {0xa0ec319ad89ec6e9ull, 0},
+    {0xa0f3122326551d25ull, 7},
+    {0xa0f97abdeb998d71ull, 11},
+    {0xa0fbffb5b363cb87ull, 6},
+    {0xa106322678eaf364ull, 6},
+    {0xa128e7f59a83943cull, 8},
+    {0xa137f62992a1a465ull, 0},
+    {0xa140b2f08bb5f502ull, 9},
+    {0xa155678067ebccaaull, 6},
+    {0xa167f8ca48ca34ddull, 9},
+    {0xa1684cf7ccca3ac4ull, 4},
+    {0xa1700ba670777a0cull, 7},
+    {0xa1705abaea0cef73ull, 9},
+    {0xa1769245eca38defull, 6},
+    {0xa177a9820524850dull, 7},
+    {0xa1787e084bf0a6bfull, 4},
+    {0xa17c355e6dd65107ull, 6},
+    {0xa1ac4200fb2ad5d8ull, 0},
+    {0xa1bb7aac36c164faull, 5},
+    {0xa1be7a79d5fa30adull, 7},
+    {0xa1c24512195f25a7ull, 9},
+    {0xa1d07a4100375c84ull, 5},
+    {0xa1fde2bc5deee25dull, 7},
+    {0xa202044843612607ull, 6},
+    {0xa2136ec7e7089f35ull, 9},
+    {0xa2252c1927754486ull, 11},
+    {0xa22f6276bdb49f1aull, 10},
+    {0xa2304978fcd69f1dull, 11},
+    {0xa2409c3b7bd4db38ull, 9},
+    {0xa252bf2130f5084eull, 10},
+    {0xa252f5f5748ad071ull, 8},
+    {0xa257bf932ce8ccffull, 6},
+    {0xa279e8ddb4ce3d58ull, 2},
+    {0xa282515edc3dc576ull, 7},
+    {0xa284d13711e9a242ull, 9},
+    {0xa288e5490fe5fce5ull, 9},
+    {0xa28e338b39005cdaull, 6},
+    {0xa295d2d60a94b862ull, 6},
+    {0xa29eabc6fc8d7eb7ull, 6},
+    {0xa2a145dd451a1899ull, 7},
+    {0xa2afb10fa0601b69ull, 6},
+    {0xa2c86cbb4a3af517ull, 11},
+    {0xa2d70b927fd924d5ull, 6},
+    {0xa2e266026351acc2ull, 7},
+    {0xa2f42191c6e6ee48ull, 9},
+    {0xa30e917b5d346cf4ull, 11},
+    {0xa31148f13900195dull, 7},
+    {0xa319651714335bddull, 7},
+    {0xa32617a73fbe662aull, 6},
+    {0xa32731e3ad8fb075ull, 10},
+    {0xa32a5cc7fd6996a8ull, 9},
+    {0xa335d176006973bbull, 6},
+    {0xa348e409896d1b0bull, 11},
+    {0xa354842d076a2475ull, 5},
+    {0xa358076c3297c0e6ull, 11},
+    {0xa35de6663f45474cull, 11},
+    {0xa3607d5d6e8d426aull, 9},
+    {0xa36344148e4bc654ull, 6},
+    {0xa373eba877e40553ull, 0},
+    {0xa37d5894dda5286bull, 7},
+    {0xa386bdf514d94cffull, 6},
+    {0xa38f69b81ca1606full, 6},
+    {0xa3aca5d9c47fddd3ull, 6},
+    {0xa3adedebf8f35b32ull, 7},
+    {0xa3bea43151799449ull, 11},
+    {0xa3c5846012766f4cull, 5},
+    {0xa3cce06cf9cdad19ull, 8},
+    {0xa3cf1726e3da989bull, 8},
+    {0xa3e84849838a3b0eull, 9},
+    {0xa3fb3681830b5160ull, 7},
+    {0xa3fe26c2370e3651ull, 11},
+    {0xa4049ea21596bd0bull, 7},
+    {0xa407d3388671add9ull, 6},
+    {0xa408f9e12ba4a697ull, 8},
+    {0xa412cdb892a6cc31ull, 1},
+    {0xa423672045b74481ull, 6},
+    {0xa424a826b96e3362ull, 8},
+    {0xa429ed40cf10735full, 10},
+    {0xa42e20a102870420ull, 0},
+    {0xa4350bf0bd1bd678ull, 7},
+    {0xa443877d2879ad60ull, 6},
+    {0xa4478b4a2d9634cdull, 7},
+    {0xa44a7df3a7316e6aull, 6},
+    {0xa455767444e8f709ull, 6},
+    {0xa4613c2fcd310e0cull, 10},
+    {0xa46305a2aa8e9871ull, 6},
+    {0xa477060e52f648a9ull, 7},
+    {0xa48075c5d98b5c1aull, 0},
+    {0xa4820ee1d09e50aeull, 7},
+    {0xa48b2bf6e4ef1e7bull, 9},
+    {0xa48fdfa078e8e5efull, 0},
+    {0xa4915cf1728ea6b8ull, 6},
+    {0xa49ab5dfc10746c4ull, 2},
+    {0xa49bd981d91cd7dbull, 8},
+    {0xa4a043475747b085ull, 9},
+    {0xa4c6fc156cb52f45ull, 9},
+    {0xa4ce682d777b9b68ull, 6},
+    {0xa4d32e0dcbc15e3cull, 8},
+    {0xa4f1eb3c33ef2dcbull, 7},
+    {0xa4f5913209cc5f1dull, 6},
+    {0xa506667d5b7d27d6ull, 6},
+    {0xa50697300434c1beull, 11},
+    {0xa51c2f0ac88c8f5aull, 7},
+    {0xa51eb4193a183cfcull, 3},
+    {0xa5297e0ffc198c1bull, 7},
+    {0xa5330a88460277c2ull, 6},
+    {0xa53398a8455a978eull, 6},
+    {0xa54c36df07877809ull, 6},
+    {0xa5521b28114a4ab4ull, 8},
+    {0xa554d8fa7669d57dull, 7},
+    {0xa5587aae6f31ab43ull, 8},
+    {0xa56621ddb3126bfcull, 11},
+    {0xa5749904652656dbull, 8},
+    {0xa579b54bf76c4316ull, 10},
+    {0xa57db539656f5917ull, 0},
+    {0xa5a2475024997852ull, 9},
+    {0xa5b119c03bfaf00dull, 10},
+    {0xa5c775868fe3dd89ull, 7},
+    {0xa5ff97dfbfd332fcull, 7},
+    {0xa6089d76c4147558ull, 7},
+    {0xa612ddbb3d45c867ull, 3},
+    {0xa614e79bf098a6fcull, 2},
+    {0xa61951b44f7976c6ull, 6},
+    {0xa61f677d3a8ab194ull, 6},
+    {0xa623edfdf055fe25ull, 9},
+    {0xa627f5ddf49760a3ull, 7},
+    {0xa62c599e8ffd25b1ull, 7},
+    {0xa62f78feb0d6f041ull, 8},
+    {0xa6316b4312c311d9ull, 11},
+    {0xa651ddaea5e5bb9bull, 11},
+    {0xa65816926a1e3e64ull, 1},
+    {0xa65a1e289019b15eull, 8},
+    {0xa65b7c5068993306ull, 7},
+    {0xa65e46b351d2e10dull, 9},
+    {0xa67bf5530a82a898ull, 9},
+    {0xa6a272f66395671cull, 8},
+    {0xa6ad7a70f033c9c6ull, 0},
+    {0xa6b63dde9b738748ull, 10},
+    {0xa6bb37339add9e85ull, 7},
+    {0xa6c304819a68a0b8ull, 7},
+    {0xa6dbf91c952173b2ull, 10},
+    {0xa6dd497221c66654ull, 7},
+    {0xa6e64a96393a1b88ull, 6},
+    {0xa6f52a13bc41089eull, 9},
+    {0xa6f752d9dadcdee4ull, 6},
+    {0xa711ca99249e5329ull, 11},
+    {0xa720029094d8951eull, 8},
+    {0xa728fd57db016837ull, 8},
+    {0xa74495e465cab778ull, 8},
+    {0xa752b230c2a92effull, 8},
+    {0xa75d7b4d60d2d8b7ull, 10},
+    {0xa7602c1e4f0c5f28ull, 8},
+    {0xa76c1f4a16e15571ull, 6},
+    {0xa779a7ba9c3ec467ull, 11},
+    {0xa77b895101fe86beull, 10},
+    {0xa78ee1e8de11dc3full, 8},
+    {0xa7999703e22ed3f5ull, 6},
+    {0xa7a070f3314ec2c0ull, 6},
+    {0xa7c557b43214c3bcull, 7},
+    {0xa7d4a327013e0d3dull, 1},
+    {0xa7f00a9a05755037ull, 1},
+    {0xa7ff0dac9ba0a010ull, 2},
+    {0xa8011d5b92c07002ull, 0},
+    {0xa809e2eb8355de8eull, 4},
+    {0xa80d8c486e474663ull, 10},
+    {0xa80ffb38a70404c8ull, 1},
+    {0xa811b1851e23bb6aull, 7},
+    {0xa824fc6e4ab27f75ull, 8},
+    {0xa83472e6f8e4e2c6ull, 8},
+    {0xa8458130cabbc5a1ull, 0},
+    {0xa84f73a536bf44a7ull, 8},
+    {0xa868108b9280183eull, 6},
+    {0xa87b6d824e329848ull, 6},
+    {0xa8858d88c0aba01bull, 6},
+    {0xa887a9a5043ad86dull, 9},
+    {0xa89729bab15b49abull, 7},
+    {0xa8985694f79507b2ull, 6},
+    {0xa8aec7324c7cb413ull, 6},
+    {0xa8b0f88b8265e4f4ull, 11},
+    {0xa8b3252331b75734ull, 8},
+    {0xa8b82267d2883a21ull, 7},
+    {0xa8bb80faa158ebf3ull, 0},
+    {0xa8bed8c0e4469de9ull, 7},
+    {0xa8bf0c71a97afecbull, 10},
+    {0xa8c7dfe01e18d58dull, 11},
+    {0xa8d61c552b9510c8ull, 4},
+    {0xa8dcfd24ff8f40f2ull, 11},
+    {0xa8f2509b88f8d018ull, 6},
+    {0xa8fbb7044901bf76ull, 8},
+    {0xa904d03b99bafcceull, 5},
+    {0xa932cf93921459b8ull, 8},
+    {0xa94ed592e1ca0948ull, 6},
+    {0xa98d8f088c3cbb1full, 9},
+    {0xa98fe2ca33428fa2ull, 6},
+    {0xa9902b11b593c7b7ull, 6},
+    {0xa991c56dff4bc843ull, 6},
+    {0xa994ada4c356aa59ull, 8},
+    {0xa995b0a0fc21ea65ull, 7},
+    {0xa9a180cdd5ec7e86ull, 9},
+    {0xa9a9a28a11544affull, 10},
+    {0xa9abebc8cef8b535ull, 8},
+    {0xa9ac29b85ea93e4eull, 10},
+    {0xa9b2c5e766f5bec3ull, 1},
+    {0xa9ca1acb29821963ull, 10},
+    {0xa9d25d52727f1cc6ull, 6},
+    {0xa9d4d2bb5cf63eb4ull, 8},
+    {0xa9d99efcb0661ea3ull, 7},
+    {0xa9e4b0c9c45c1002ull, 1},
+    {0xaa006e2ed4bd2fbeull, 6},
+    {0xaa08dd0ba9a9b550ull, 0},
+    {0xaa09e99652849f74ull, 8},
+    {0xaa0a1454e45fd6c4ull, 5},
+    {0xaa113ca22167a771ull, 11},
+    {0xaa18e1b185a9a6cbull, 9},
+    {0xaa1ea6b80fa19a54ull, 7},
+    {0xaa26550df1e7d5bdull, 9},
+    {0xaa2a2f512b0b45f8ull, 6},
+    {0xaa2e1481bde87a96ull, 6},
+    {0xaa3bf10b29a7a40dull, 7},
+    {0xaa41adbad99407e7ull, 7},
+    {0xaa42ccde5022cc3full, 7},
+    {0xaa46702668c2aaf3ull, 7},
+    {0xaa4879e6f563ae0aull, 11},
+    {0xaa56e5d6cf20a0dfull, 8},
+    {0xaa68db2bc275fe26ull, 6},
+    {0xaa7a4e1b21287814ull, 10},
+    {0xaa88cb86261044c6ull, 7},
+    {0xaa98a44e301f90e4ull, 7},
+    {0xaa996dc14d6b03dcull, 10},
+    {0xaaab5192fcc36c61ull, 6},
+    {0xaaac07688a86f1a3ull, 11},
+    {0xaaae6715da3a5e85ull, 8},
+    {0xaab0df41ea1e80f4ull, 11},
+    {0xaac3e73a6287d07cull, 10},
+    {0xaac52f8a98bac5b8ull, 11},
+    {0xaac81451f02bbd2full, 8},
+    {0xaad3cca88470a7cfull, 1},
+    {0xaad3cce9ec21442dull, 2},
+    {0xaad3df5d8a83f69aull, 8},
+    {0xaae18c464c063fb8ull, 6},
+    {0xaae4629e27fbe1d6ull, 6},
+    {0xaae55360508963abull, 6},
+    {0xaaf2c68d71b03d62ull, 1},
+    {0xaafd364edd1a1d0eull, 6},
+    {0xaafe055e30007520ull, 11},
+    {0xab062d37bb77c401ull, 4},
+    {0xab0ffb8fe1f033a0ull, 8},
+    {0xab1bf659dd99865dull, 3},
+    {0xab1ed96fa517f8d0ull, 9},
+    {0xab2ae05b3c26b8e6ull, 0},
+    {0xab30a7fcb41b9a27ull, 8},
+    {0xab407210627292c7ull, 7},
+    {0xab409d1fdcc141d9ull, 11},
+    {0xab5a45fa45f2caedull, 6},
+    {0xab75cf2742ef14fdull, 9},
+    {0xab785594d89360f7ull, 1},
+    {0xab7f8379270a656bull, 11},
+    {0xab839a19326faaf6ull, 6},
+    {0xab8b8c4e0ebdf820ull, 7},
+    {0xab91527479310c61ull, 7},
+    {0xab92751763368cecull, 8},
+    {0xabb497cc6cec9521ull, 6},
+    {0xabb84e73bbecba79ull, 11},
+    {0xabbb83dd77cf7240ull, 11},
+    {0xabcdb084d88955a8ull, 11},
+    {0xabfc837a549ef2a4ull, 6},
+    {0xac01272c836ff08aull, 7},
+    {0xac0192e834fdf4d2ull, 0},
+    {0xac097e556536d521ull, 11},
+    {0xac122ad62d179772ull, 8},
+    {0xac188c1d3926da7eull, 6},
+    {0xac19bbf595dcc81dull, 6},
+    {0xac2090173bdbecfaull, 1},
+    {0xac22e959e1d48c41ull, 9},
+    {0xac3f3fb055e49adfull, 8},
+    {0xac44ec03bf2a1803ull, 9},
+    {0xac4c827161e6efc4ull, 8},
+    {0xac5d0235a58b3c32ull, 9},
+    {0xac6133fae54f9b48ull, 9},
+    {0xac6917b944e8ac17ull, 7},
+    {0xac868066d3f7eec1ull, 9},
+    {0xaca93a7a0e026b24ull, 7},
+    {0xacb41926f92d8e5eull, 11},
+    {0xacb942464c4244bcull, 10},
+    {0xacd14c99dc40e72eull, 9},
+    {0xace4e7cf0f90b723ull, 6},
+    {0xaceb1f3c6474b98dull, 11},
+    {0xacf7a17b4a1262f3ull, 7},
+    {0xad09028b7b2224c8ull, 7},
+    {0xad0e2c9d00d0e022ull, 11},
+    {0xad0fd3a4f46a1f94ull, 9},
+    {0xad2011f4a0025462ull, 8},
+    {0xad2b8acf4d20e4e6ull, 5},
+    {0xad2db10c04d920e6ull, 6},
+    {0xad3440b7ffd8c31cull, 6},
+    {0xad34b78622bc7576ull, 10},
+    {0xad35dee3345b3a9aull, 1},
+    {0xad379479fb5b32b6ull, 7},
+    {0xad3bbc98140948f4ull, 8},
+    {0xad445c5262f2a12bull, 6},
+    {0xad501a77242a4032ull, 6},
+    {0xad50335368047326ull, 7},
+    {0xad50b137147c8051ull, 11},
+    {0xad50b76fef4753d3ull, 10},
+    {0xad68928e14c39a3eull, 7},
+    {0xad709c4b25aca38full, 8},
+    {0xad75dc489bde63c9ull, 10},
+    {0xad805cda019f983cull, 9},
+    {0xad85520a514efc2full, 8},
+    {0xad8e397c2d98c211ull, 9},
+    {0xada8ff7ce000a371ull, 9},
+    {0xada9a0ea81256381ull, 0},
+    {0xadae20bb2bae0cd4ull, 6},
+    {0xadaf27c382ee8a72ull, 8},
+    {0xadb1948ed9ee131cull, 2},
+    {0xadb3d6a033760495ull, 10},
+    {0xadd575e436e523d4ull, 0},
+    {0xade917e99d472784ull, 9},
+    {0xadecf22175faaa11ull, 9},
+    {0xadef8e0a0193d067ull, 10},
+    {0xadefdf169be84518ull, 9},
+    {0xadf853f80815f0b8ull, 1},
+    {0xae01092d14062522ull, 8},
+    {0xae05b574432ff9e5ull, 6},
+    {0xae0aa331de656ca9ull, 10},
+    {0xae1cc8f5c4d07379ull, 10},
+    {0xae2ae22b91f9d1b1ull, 6},
+    {0xae41807701cda699ull, 0},
+    {0xae4957522bae7d99ull, 6},
+    {0xae4fb1953a1aed70ull, 8},
+    {0xae52262c045b7556ull, 6},
+    {0xae5e68c76510e640ull, 0},
+    {0xae5f3a3e58e5fa60ull, 6},
+    {0xae6112e90b1cbbf0ull, 6},
+    {0xae65dc579abe535full, 0},
+    {0xae6aa4c04df3a91cull, 8},
+    {0xae6d4df659b19b87ull, 7},
+    {0xae73a0434c71846dull, 10},
+    {0xae7b45a95ba8b47cull, 10},
+    {0xae98642cda3801f9ull, 9},
+    {0xae9d81e432858c6cull, 9},
+    {0xaeadf3f278f9966bull, 8},
+    {0xaec62854dcad03d6ull, 3},
+    {0xaecea3958ea07b82ull, 10},
+    {0xaed38e4756426615ull, 7},
+    {0xaed96a2a2f582994ull, 8},
+    {0xaedbfbd95bbd3ad5ull, 4},
+    {0xaee1cd59a0506ac7ull, 1},
+    {0xaf083c54ff637a4aull, 7},
+    {0xaf13a69d1efb6226ull, 10},
+    {0xaf2afad6e53a4420ull, 6},
+    {0xaf31473e341474a2ull, 0},
+    {0xaf35f69dc6eda955ull, 6},
+    {0xaf38147cce24442cull, 8},
+    {0xaf40f256a296a475ull, 6},
+    {0xaf4f7389e9029214ull, 2},
+    {0xaf52674b15e1a6bfull, 8},
+    {0xaf5a803a8ef63ee9ull, 8},
+    {0xaf6ac699e44ab9e3ull, 7},
+    {0xaf73f77a2edb7223ull, 6},
+    {0xaf768be31a517218ull, 9},
+    {0xaf77000274ac96f3ull, 8},
+    {0xaf7f5c92684835deull, 8},
+    {0xaf87a564979c9b02ull, 6},
+    {0xafa01c4e88cdb998ull, 10},
+    {0xafa680032c5cb996ull, 8},
+    {0xafa8f0fe47e25d1bull, 11},
+    {0xafaac7542ec79eddull, 9},
+    {0xafb3ad51ae41cd06ull, 6},
+    {0xafbfa5ee673e26d4ull, 7},
+    {0xafc08f2b56ef25b6ull, 11},
+    {0xafc1b6fb0b573f4cull, 1},
+    {0xafcb88a0c3089af7ull, 0},
+    {0xafecc71c91b064e1ull, 6},
+    {0xafee38ad17901027ull, 7},
+    {0xafefc0e7560156cbull, 11},
+    {0xaff6fe1c4fd97312ull, 6},
+    {0xb010b94053cbaabcull, 7},
+    {0xb011444c8f8b4f2full, 8},
+    {0xb015a5f05f153e59ull, 6},
+    {0xb0278c796597f9caull, 1},
+    {0xb029cc4888d8fd0dull, 6},
+    {0xb02ecf3c59ced7b4ull, 8},
+    {0xb0332de5be4e9fabull, 6},
+    {0xb034b68e3d644234ull, 10},
+    {0xb03fad8ad2c8c20bull, 3},
+    {0xb042dbfd1c164655ull, 6},
+    {0xb04800aac1943220ull, 4},
+    {0xb049caa86befb20aull, 10},
+    {0xb04b64a4db0e606bull, 6},
+    {0xb04d0f0044b7ea4eull, 6},
+    {0xb05318f899b53f4aull, 2},
+    {0xb0532f9bd15143d3ull, 8},
+    {0xb0582ec5d6202353ull, 7},
+    {0xb05ab981626acca6ull, 6},
+    {0xb09719e1791b62baull, 6},
+    {0xb0974d646a7db45eull, 8},
+    {0xb09e5c95825d2b63ull, 7},
+    {0xb0a11e5ed8818666ull, 7},
+    {0xb0a5b245d8c70a64ull, 10},
+    {0xb0a74515d7d5bcdeull, 7},
+    {0xb0b22f721bc538e9ull, 5},
+    {0xb0c324bb71263c0full, 10},
+    {0xb0c4c6570185a30eull, 6},
+    {0xb0c7487aa22997fcull, 7},
+    {0xb0c95e511ae3876eull, 6},
+    {0xb0cebcabc3c852b9ull, 11},
+    {0xb0e40024726e8889ull, 7},
+    {0xb0fd645dccfe20a0ull, 8},
+    {0xb104e3abc045f223ull, 10},
+    {0xb109708442650ff2ull, 1},
+    {0xb10dbc1a8ff9fa63ull, 7},
+    {0xb11a2d2c52ad4d6eull, 11},
+    {0xb11c4fabac1f53bdull, 6},
+    {0xb121c8769b895678ull, 7},
+    {0xb1398cc84ad80a11ull, 7},
+    {0xb13d244dd2ff8191ull, 6},
+    {0xb143909c346e6b0full, 8},
+    {0xb159c72d49be2d06ull, 8},
+    {0xb15f92f4e3946af8ull, 6},
+    {0xb16358e188e9e6e5ull, 0},
+    {0xb1668aa3ae7cad9eull, 7},
+    {0xb1670b3f48cbe131ull, 10},
+    {0xb168c3da65cb5661ull, 9},
+    {0xb16ce459914266e0ull, 6},
+    {0xb18023b8a5afaad1ull, 6},
+    {0xb185955a64a2f3b0ull, 8},
+    {0xb18a84063c170438ull, 0},
+    {0xb19a409b57e55e4bull, 11},
+    {0xb1a55129df743f81ull, 9},
+    {0xb1a93bf920cc5224ull, 10},
+    {0xb1babcd443f9927eull, 7},
+    {0xb1c315cf29742abbull, 2},
+    {0xb1c994bdc6b42812ull, 4},
+    {0xb1d0899ec5a2c03dull, 10},
+    {0xb1e16de77e531d09ull, 10},
+    {0xb1e3089ff7dd67a4ull, 0},
+    {0xb1f52a714d5ead91ull, 5},
+    {0xb1f90ec26abe9a72ull, 6},
+    {0xb1fedbfa7fd23566ull, 10},
+    {0xb202c9622926141eull, 7},
+    {0xb2153b7bc1122fa9ull, 8},
+    {0xb2163b76eef316e3ull, 0},
+    {0xb226a0048ded0076ull, 1},
+    {0xb22da1b4d331fc9cull, 9},
+    {0xb23498caaa0fbab0ull, 6},
+    {0xb244f8e7d0ce067cull, 11},
+    {0xb24c16b3199c1240ull, 6},
+    {0xb24dbb57e5c73a72ull, 8},
+    {0xb250e98e7244a138ull, 10},
+    {0xb25970b62d340c72ull, 6},
+    {0xb25a0fa4146d3ed4ull, 11},
+    {0xb25d64f820fdcf2full, 6},
+    {0xb263c6da0936d8a6ull, 10},
+    {0xb264e6316f4c762cull, 7},
+    {0xb275ae55a887ea76ull, 11},
+    {0xb27bc2ab00534c39ull, 4},
+    {0xb281bc7ce29c0679ull, 4},
+    {0xb28f09637b86a1adull, 7},
+    {0xb2a2844c88bbd840ull, 8},
+    {0xb2a58c0618c18f09ull, 10},
+    {0xb2aa9a43858b1a45ull, 10},
+    {0xb2ac74a4dfe957fcull, 1},
+    {0xb2c58895c1db11a7ull, 8},
+    {0xb2cbf2c80158ff65ull, 5},
+    {0xb2d1c72470b69469ull, 9},
+    {0xb2e79255ca6c84fcull, 1},
+    {0xb3020c88d9c02d5dull, 7},
+    {0xb30345157359a036ull, 5},
+    {0xb3044416c354f0deull, 6},
+    {0xb306b97177b2cf7aull, 8},
+    {0xb31902b4d9889c40ull, 7},
+    {0xb32251fabc8f9595ull, 8},
+    {0xb32dc65a086a437bull, 6},
+    {0xb33c96a76e5699c8ull, 4},
+    {0xb34b0523c1d65825ull, 7},
+    {0xb361d067318d07f5ull, 11},
+    {0xb36233c6714161c9ull, 6},
+    {0xb3676a1342229d73ull, 7},
+    {0xb379ff054a4c3f8dull, 11},
+    {0xb3801083205acc43ull, 7},
+    {0xb389f250633c8b48ull, 8},
+    {0xb3b89c23208d497cull, 7},
+    {0xb3ba964c87e19033ull, 8},
+    {0xb3c17efedc19f49aull, 6},
+    {0xb3c335e0ab2baad9ull, 11},
+    {0xb3cbb16f2b158794ull, 6},
+    {0xb3da372d10aa3503ull, 9},
+    {0xb3f894ee499f40c7ull, 8},
+    {0xb405d6338b377eb5ull, 7},
+    {0xb40ac7a60c56ae1aull, 10},
+    {0xb4181b1589664ccdull, 11},
+    {0xb41c87236b9a13ebull, 6},
+    {0xb41e4196f2df1990ull, 8},
+    {0xb422555b3be1f39aull, 6},
+    {0xb4417614f8e2a680ull, 7},
+    {0xb451a0d41990ca65ull, 9},
+    {0xb4683b317d2951cbull, 7},
+    {0xb475b00c9051d5beull, 11},
+    {0xb4762527707b6624ull, 4},
+    {0xb494ec740d1f399aull, 8},
+    {0xb4aff077561d5f3full, 7},
+    {0xb4b2c103fa373b22ull, 11},
+    {0xb4b5c34769efeccaull, 11},
+    {0xb4c30e4a8e33a98bull, 7},
+    {0xb4c4e0b02cd16aeaull, 0},
+    {0xb4cecd001524115eull, 9},
+    {0xb4cf224a5dd3fd79ull, 6},
+    {0xb4cf7b8bc1f3da6eull, 8},
+    {0xb4f5543de908d206ull, 7},
+    {0xb4fbba0364fd28eaull, 11},
+    {0xb502930bd794b594ull, 8},
+    {0xb504a946edf715b5ull, 7},
+    {0xb5192cd33c4a486full, 8},
+    {0xb51f0b885a8be14full, 9},
+    {0xb51f790a96600f91ull, 6},
+    {0xb52c308c1c5feb8bull, 8},
+    {0xb531fc1fa4a5beafull, 6},
+    {0xb54fae3df5c797bbull, 7},
+    {0xb5630034eba776fdull, 6},
+    {0xb56376b163271610ull, 10},
+    {0xb566b7426613fb35ull, 7},
+    {0xb56e27e820db70f8ull, 11},
+    {0xb570542112887aa0ull, 1},
+    {0xb575d19331863b79ull, 8},
+    {0xb57ce3812339fcb0ull, 6},
+    {0xb588cece60be50a7ull, 11},
+    {0xb590ebc788aced43ull, 10},
+    {0xb592f6e1c9fa2f54ull, 10},
+    {0xb5a0d4b2091a26aeull, 9},
+    {0xb5a3144f8ccfbf90ull, 11},
+    {0xb5a4b801b76e0c5eull, 11},
+    {0xb5a8e40e10b33cacull, 6},
+    {0xb5b9e76daae18079ull, 9},
+    {0xb5bedfc1a09598a8ull, 11},
+    {0xb5d42bb030fed724ull, 10},
+    {0xb5d794b8c789a4d5ull, 2},
+    {0xb5e4260f7c340384ull, 6},
+    {0xb5ec8614179ca07aull, 2},
+    {0xb5f144b35edf40a6ull, 6},
+    {0xb5ffd8fb6c844d9full, 7},
+    {0xb5ffe1a0e28379b2ull, 11},
+    {0xb60e352ef22339e5ull, 7},
+    {0xb6140242af28fbf5ull, 11},
+    {0xb617e0bccce5bdf8ull, 10},
+    {0xb61ceae62d2f1631ull, 8},
+    {0xb63f870b7ae9b80full, 10},
+    {0xb6456a120b671547ull, 6},
+    {0xb6495d41ccb46443ull, 11},
+    {0xb64a559b0bffb42cull, 11},
+    {0xb6651c18d90c673aull, 1},
+    {0xb6682d23abc5cbc3ull, 11},
+    {0xb66be5d073adefeaull, 6},
+    {0xb672150c0281b430ull, 8},
+    {0xb69287cde2eaf14eull, 8},
+    {0xb6987f5e2a8b9e24ull, 6},
+    {0xb6a1d0b73b2987fdull, 6},
+    {0xb6af9829c3672a79ull, 6},
+    {0xb6ba976fda0134b0ull, 11},
+    {0xb6bb545f4728197eull, 6},
+    {0xb6bc1ff228d4dccaull, 4},
+    {0xb6c281a88099ad16ull, 7},
+    {0xb6c6c80fedc3a7d2ull, 10},
+    {0xb6dc6bf4cbb20df9ull, 11},
+    {0xb6de30955b0e58e1ull, 6},
+    {0xb6e790f6620ec22aull, 10},
+    {0xb708af99210122b2ull, 6},
+    {0xb70d5ffab2d58a9eull, 7},
+    {0xb70ee9d0430dc71aull, 0},
+    {0xb714de3a648d9f30ull, 1},
+    {0xb71a628fbed73fdaull, 7},
+    {0xb71bbaaf2c2104acull, 11},
+    {0xb723a36b6981dc1aull, 6},
+    {0xb72a62420621bbe8ull, 9},
+    {0xb73426eb056c4280ull, 6},
+    {0xb742998d19081867ull, 8},
+    {0xb744a78176d92c33ull, 11},
+    {0xb744d1f119b789acull, 0},
+    {0xb751c8537651ee95ull, 7},
+    {0xb765df3d7fac76b3ull, 6},
+    {0xb7770e53bbc98ff5ull, 9},
+    {0xb78fc27c33cd5fa2ull, 11},
+    {0xb7ad5ad7154fc249ull, 9},
+    {0xb7b73735c05bbb86ull, 11},
+    {0xb7c25747b117212eull, 8},
+    {0xb7dd421237eee72bull, 6},
+    {0xb7f60acc87337adfull, 9},
+    {0xb7fa9f57ed0e2e2dull, 8},
+    {0xb7fb5a6531cd067bull, 0},
+    {0xb7fbbe38c2957b63ull, 1},
+    {0xb800879bc767a9a4ull, 10},
+    {0xb81a177dac3b3cafull, 9},
+    {0xb81ab9aafa638953ull, 6},
+    {0xb8204cb782652af6ull, 5},
+    {0xb824bd7d97fa18b2ull, 10},
+    {0xb8324a8b63e43befull, 0},
+    {0xb83b08e4b636dcaaull, 7},
+    {0xb847f2942988be2aull, 7},
+    {0xb8511006b40bbea1ull, 9},
+    {0xb851c2a462c9705eull, 9},
+    {0xb85abd74ae750a7aull, 5},
+    {0xb85caa97aa4565e0ull, 8},
+    {0xb870439e647d0451ull, 9},
+    {0xb875e8790d831a3full, 10},
+    {0xb87ca918c3d8b416ull, 9},
+    {0xb87de69061933d0cull, 6},
+    {0xb88495429309ed9bull, 6},
+    {0xb89e13611621bc14ull, 3},
+    {0xb89e1c99292fee4cull, 2},
+    {0xb89fa61a83147505ull, 7},
+    {0xb8a7a611147ae074ull, 10},
+    {0xb8acac8b35557349ull, 9},
+    {0xb8c33cd0f160ee9dull, 7},
+    {0xb8d42e1fe0781319ull, 11},
+    {0xb8d9bcece9840d40ull, 11},
+    {0xb8d9fccae9ecf443ull, 11},
+    {0xb8dd064dd6d47e4aull, 6},
+    {0xb9035be5b96f48e5ull, 1},
+    {0xb904df72dbdf2ec8ull, 8},
+    {0xb90f7fca2f6cca8eull, 1},
+    {0xb9181418f345fc5aull, 11},
+    {0xb918de39f9927936ull, 6},
+    {0xb91fc68059209deaull, 8},
+    {0xb93a4954c7bf758cull, 1},
+    {0xb94f10d82e4e10dcull, 6},
+    {0xb95346f59787e421ull, 8},
+    {0xb956fc268cc288cdull, 5},
+    {0xb95a39513ec290f0ull, 11},
+    {0xb9637cdd258755b8ull, 10},
+    {0xb97d9148677d221full, 0},
+    {0xb98dd01bf60ebd2dull, 9},
+    {0xb9938f8321fe3263ull, 10},
+    {0xb9a2fadbcd18b7f4ull, 6},
+    {0xb9a69009a9aff600ull, 6},
+    {0xb9afca10e3f4f248ull, 11},
+    {0xb9b63780c6f721faull, 7},
+    {0xb9bc9e20c1f8de17ull, 10},
+    {0xb9d2d873cba69f2aull, 8},
+    {0xb9db7ede45cf722full, 0},
+    {0xb9e65a2eeed2c7f2ull, 7},
+    {0xb9e90ef20db3b6daull, 7},
+    {0xba128108c553ce80ull, 10},
+    {0xba162c6b92eb8714ull, 8},
+    {0xba17ead08a45fe50ull, 10},
+    {0xba1c10557d4b191full, 6},
+    {0xba2c92ac15233aa1ull, 8},
+    {0xba2d311d40388c8dull, 11},
+    {0xba2eaf5c91003b18ull, 10},
+    {0xba5a7c5bd1e7f321ull, 6},
+    {0xba616fa8db8b11a8ull, 11},
+    {0xba66476eeba60ce3ull, 7},
+    {0xba703d854f261e20ull, 6},
+    {0xba822bddf8e09361ull, 7},
+    {0xba8ef2c13e537c53ull, 6},
+    {0xbab3284d5aad7b3eull, 0},
+    {0xbad2e7bacb0e0af8ull, 6},
+    {0xbad449bd9b32a447ull, 11},
+    {0xbaed75ed1785bcd7ull, 6},
+    {0xbaf031030f4726acull, 10},
+    {0xbb02e03e8d35b0f7ull, 6},
+    {0xbb04d593cbbfafb9ull, 9},
+    {0xbb0ac7e39e1430e3ull, 7},
+    {0xbb14233b5b954122ull, 6},
+    {0xbb1879ddb5f0f980ull, 11},
+    {0xbb204a7c065cbbd9ull, 4},
+    {0xbb2186ef111bb50aull, 6},
+    {0xbb23b5f4c0c2d110ull, 9},
+    {0xbb28b33e1a4620f6ull, 9},
+    {0xbb2fe44cf22a885aull, 7},
+    {0xbb319d0ba4e5cab4ull, 8},
+    {0xbb3ddab90db48280ull, 6},
+    {0xbb4cf5a413386cb4ull, 2},
+    {0xbb4df3345bb2f376ull, 7},
+    {0xbb59ef4042ad0218ull, 9},
+    {0xbb5cb592a83cc137ull, 2},
+    {0xbb6df0e589d2a5e5ull, 7},
+    {0xbb7e11e4b628bba2ull, 8},
+    {0xbb833696d8601b2full, 10},
+    {0xbb8730ee47c70defull, 7},
+    {0xbb8cefced7905a64ull, 11},
+    {0xbb90128ad375d3f1ull, 9},
+    {0xbb977403f9f47fc4ull, 7},
+    {0xbb996ec08630f940ull, 9},
+    {0xbb9cbdab739e58b3ull, 6},
+    {0xbb9eabdaa5c9f7edull, 10},
+    {0xbba2a3645f52b5a3ull, 3},
+    {0xbba3dd35e199d35dull, 2},
+    {0xbbac62e2254a70d6ull, 7},
+    {0xbbae45af37ac1161ull, 10},
+    {0xbbc4faa2e12ca06dull, 11},
+    {0xbbd3f7963b29def2ull, 8},
+    {0xbbe099d8c7d25d0dull, 9},
+    {0xbbe0b201c5eef53full, 7},
+    {0xbbedd299bbb88b15ull, 11},
+    {0xbbf06d264a186711ull, 10},
+    {0xbc045bdba654927aull, 8},
+    {0xbc18199e1db9bcc7ull, 10},
+    {0xbc1d3cf9afd0aac4ull, 11},
+    {0xbc1dfc27e3933577ull, 0},
+    {0xbc2d513f5f678aebull, 10},
+    {0xbc3023b5e764fe2eull, 0},
+    {0xbc3d820b4d30c5e3ull, 8},
+    {0xbc44e3df2fd3ee8bull, 7},
+    {0xbc495ff9f15b793cull, 9},
+    {0xbc51561905763749ull, 6},
+    {0xbc52f6731add8b1aull, 6},
+    {0xbc57ceb1abd1959full, 8},
+    {0xbc5ca11700c29664ull, 7},
+    {0xbc5d3c33efe074a8ull, 7},
+    {0xbc78ce01dbbcb020ull, 6},
+    {0xbc8a205c2ef19432ull, 11},
+    {0xbc8ebf9dbc8800ecull, 8},
+    {0xbc943a3d7ddb2d22ull, 0},
+    {0xbc99a2507c0eee60ull, 1},
+    {0xbc9c7a5967aef2d4ull, 5},
+    {0xbcbd7a1c6ef49de2ull, 11},
+    {0xbcc0dcdc70e2f8d9ull, 7},
+    {0xbcc6676a844ca177ull, 6},
+    {0xbcd49ed5a7a39c92ull, 7},
+    {0xbcdcf2d724ab1982ull, 6},
+    {0xbcdf94fc2821d1aeull, 11},
+    {0xbce79a82e57f7151ull, 6},
+    {0xbcee51bf8432de1dull, 8},
+    {0xbcf34575a97d0156ull, 7},
+    {0xbcfe7eaec1ec79c1ull, 11},
+    {0xbd0b7202c744ad9cull, 9},
+    {0xbd120eea39081643ull, 6},
+    {0xbd23eea07d00b8b2ull, 10},
+    {0xbd393242245bd0d0ull, 0},
+    {0xbd4dbf1b0cec5697ull, 8},
+    {0xbd5f27cfb31232efull, 11},
+    {0xbd673824d75c32cdull, 11},
+    {0xbd6ab9b4bd7d3ad5ull, 8},
+    {0xbd9f4b7e065d4238ull, 3},
+    {0xbda8e1354c67bac1ull, 11},
+    {0xbdb859d0e2de5a70ull, 6},
+    {0xbdd8477a101ed053ull, 4},
+    {0xbdd9af58d3c2b285ull, 9},
+    {0xbdfaf471f265c228ull, 9},
+    {0xbe11bce05c6162f6ull, 2},
+    {0xbe2eab2cf1189df0ull, 7},
+    {0xbe335da9694a9cfbull, 0},
+    {0xbe36dd6c3711fa1aull, 8},
+    {0xbe3cefc1fd43bc8full, 8},
+    {0xbe5b56ab93b374f3ull, 8},
+    {0xbe5e7a74a347dcd0ull, 6},
+    {0xbe6663b0e6e70466ull, 6},
+    {0xbe683d6a0a1679b4ull, 8},
+    {0xbeb59fc7d9c7e41dull, 7},
+    {0xbebb74665fc23c3cull, 11},
+    {0xbec51e50d93d275bull, 4},
+    {0xbec58a08658994bfull, 7},
+    {0xbecf6c2203a00b53ull, 10},
+    {0xbed23efb94239019ull, 8},
+    {0xbeec989f6bbf3850ull, 0},
+    {0xbf0920e958cb9584ull, 11},
+    {0xbf0c9cab9f91ab3full, 6},
+    {0xbf19bb45fc2882f4ull, 4},
+    {0xbf41c33320a9f1b7ull, 8},
+    {0xbf446b9632bda946ull, 10},
+    {0xbf479cef89202f86ull, 6},
+    {0xbf48713bd8644de2ull, 8},
+    {0xbf5388cc9a636b53ull, 9},
+    {0xbf5b0ff3d8e5278cull, 7},
+    {0xbf6755e191e93717ull, 8},
+    {0xbf6bdeed724e6aeeull, 5},
+    {0xbf6d29dad6da8262ull, 6},
+    {0xbf79ba566b0d5128ull, 8},
+    {0xbf8a9211a1534141ull, 8},
+    {0xbf8f4f32d1d9bcb3ull, 0},
+    {0xbfa522894f56261cull, 7},
+    {0xbfab02f187e37a46ull, 11},
+    {0xbfb243f6798ee910ull, 7},
+    {0xbfba54e6478fc5d5ull, 9},
+    {0xbfc25ba1e987055full, 0},
+    {0xbfe67aa93ba895e6ull, 7},
+    {0xbfe6c7df6e715fa0ull, 2},
+    {0xbffa2990134aab04ull, 8},
+    {0xbffc393e53282296ull, 1},
+    {0xbffe976b9f4a2a1full, 1},
+    {0xc016c7388abb4019ull, 10},
+    {0xc02017da17ecef8full, 9},
+    {0xc0259f50e3e3ed9bull, 10},
+    {0xc0264203bdc6a871ull, 6},
+    {0xc02c744b0fcdbda1ull, 10},
+    {0xc045eb97d96f3158ull, 9},
+    {0xc04d35e67da4f740ull, 10},
+    {0xc052c40cbe485db5ull, 6},
+    {0xc07b3a7a75e44833ull, 0},
+    {0xc0855c827baf5091ull, 7},
+    {0xc091b269f00c1160ull, 8},
+    {0xc09acb790615d7b5ull, 7},
+    {0xc0a9be68c94f9ed5ull, 11},
+    {0xc0b8fe063b52cccdull, 7},
+    {0xc0c27fe1f8dcc7d7ull, 8},
+    {0xc0d3a30c6ab051fcull, 1},
+    {0xc0d883bbc996a467ull, 9},
+    {0xc0ead113be2dd85dull, 10},
+    {0xc0f44b2659145c12ull, 10},
+    {0xc0f5856fe487931cull, 11},
+    {0xc0f9f34ffbfd6858ull, 6},
+    {0xc1001ce5d60eb769ull, 10},
+    {0xc1026833353b0bd5ull, 6},
+    {0xc108d9d0117d16f7ull, 1},
+    {0xc1124b0b47be0396ull, 11},
+    {0xc1154194aba1a297ull, 0},
+    {0xc12480fd6bee4041ull, 10},
+    {0xc129092762ed70deull, 9},
+    {0xc12c3c7ac2cfbe9bull, 10},
+    {0xc12feef6c53cf36cull, 8},
+    {0xc14efbb761e79207ull, 9},
+    {0xc15114558f7e26b3ull, 0},
+    {0xc15ee62915c74b0full, 9},
+    {0xc16dbdbe20833ea9ull, 10},
+    {0xc17632d8984533c2ull, 6},
+    {0xc18485d0cc740896ull, 7},
+    {0xc195c5693a9f0c4cull, 8},
+    {0xc19a6218d88f917aull, 1},
+    {0xc1a9ac3caf8c6600ull, 1},
+    {0xc1c464ef18607f6dull, 7},
+    {0xc1d8cea986d344efull, 7},
+    {0xc1e3213dff132dafull, 6},
+    {0xc1e53d0308179c53ull, 6},
+    {0xc1e574e455396a51ull, 9},
+    {0xc1ea0c3052b7ff86ull, 6},
+    {0xc1f4c6e673c0f3e6ull, 6},
+    {0xc1fcb86bc9db3c41ull, 8},
+    {0xc20a835c36116289ull, 0},
+    {0xc21075ca7b0055e5ull, 6},
+    {0xc21837f369cd2b81ull, 7},
+    {0xc21bfe84fc0216d6ull, 6},
+    {0xc22268a2327d7adfull, 8},
+    {0xc22dd822b245075aull, 8},
+    {0xc231ae267fb159e3ull, 7},
+    {0xc2384a5170b6bdeaull, 7},
+    {0xc2398961ed9f9024ull, 7},
+    {0xc23a6dbace2539efull, 11},
+    {0xc23b54f4d842ba75ull, 6},
+    {0xc2609d25ceca77a4ull, 4},
+    {0xc26fe2a186c0718eull, 8},
+    {0xc270afda49f0ebdfull, 5},
+    {0xc27726b746487e2bull, 7},
+    {0xc289aaafaf5c748bull, 8},
+    {0xc294c2309213b64aull, 6},
+    {0xc29c23998e5f005bull, 6},
+    {0xc2a5d8c5bccf0d84ull, 6},
+    {0xc2a7c66b20c5fa25ull, 8},
+    {0xc2bbfba95b985e01ull, 6},
+    {0xc2bc0270dee8e9acull, 6},
+    {0xc2ca1df060ce463dull, 6},
+    {0xc2dc9109522d56b4ull, 5},
+    {0xc2e1aa658c69101bull, 6},
+    {0xc2e1ca0528d2b636ull, 8},
+    {0xc2e6c151ecd42f12ull, 6},
+    {0xc2f0fa9e5cf28b16ull, 6},
+    {0xc30a19fb879fb3dbull, 10},
+    {0xc30d2eaa6d2f031full, 11},
+    {0xc31347bf7de25093ull, 8},
+    {0xc32422004f626e25ull, 10},
+    {0xc32bd74109b016e3ull, 3},
+    {0xc332f66647a3c9e7ull, 8},
+    {0xc333969668390d67ull, 0},
+    {0xc348c355c9be1cf3ull, 6},
+    {0xc35dec2ff7f6111bull, 11},
+    {0xc379875b9b7a8f21ull, 2},
+    {0xc37a0e0c093062dbull, 2},
+    {0xc38b658654e300bfull, 2},
+    {0xc3ad026cb97f18d7ull, 7},
+    {0xc3ad0d9486714a8full, 7},
+    {0xc3b579631e79f25bull, 8},
+    {0xc3c09f3441000737ull, 6},
+    {0xc3cc7300a61b72a0ull, 7},
+    {0xc3dc8f7f2af2d1f8ull, 9},
+    {0xc3e22580eadeb1c4ull, 5},
+    {0xc3e763acf5b2220dull, 2},
+    {0xc3ef700472b243a4ull, 10},
+    {0xc3f3677251a48bf5ull, 7},
+    {0xc3f8c0fe2b538d4aull, 11},
+    {0xc40521789c7a43e4ull, 2},
+    {0xc40d84950eeff8ebull, 7},
+    {0xc41b3f39f7a0f575ull, 6},
+    {0xc41f67b5384139bcull, 7},
+    {0xc4226b640f0adc7aull, 9},
+    {0xc42b18414a4e5943ull, 11},
+    {0xc42bd4926422aa7bull, 6},
+    {0xc43f74830e632ac9ull, 8},
+    {0xc4482ce8faf77c26ull, 6},
+    {0xc4558781d9bc3d27ull, 8},
+    {0xc464ce9814e11811ull, 6},
+    {0xc476642d82b4bf54ull, 6},
+    {0xc4797b0a49632138ull, 6},
+    {0xc4915fc71038208dull, 6},
+    {0xc49410a0f3aede7dull, 1},
+    {0xc49ce151bfb3ada1ull, 10},
+    {0xc4a48760db0cbd73ull, 9},
+    {0xc4a815d263a57fc5ull, 8},
+    {0xc4ab1176226f7457ull, 7},
+    {0xc4c7fcf35c4fb9ebull, 7},
+    {0xc4cd866630148edcull, 7},
+    {0xc4cf9d2d6158f484ull, 11},
+    {0xc4d5d6d2c12ffb63ull, 9},
+    {0xc4ec188ff65f76a5ull, 8},
+    {0xc4f14aac46d9a19cull, 6},
+    {0xc4fdc6150bf177caull, 9},
+    {0xc5004ca4c6143838ull, 10},
+    {0xc50556f503cdb84cull, 6},
+    {0xc50ffecc521d184cull, 2},
+    {0xc514082355dda5faull, 6},
+    {0xc523dd57afaf29aeull, 6},
+    {0xc5271073fa11f006ull, 9},
+    {0xc5326933a3db62a7ull, 9},
+    {0xc54c68dfe2433370ull, 9},
+    {0xc554fdc794b8463aull, 7},
+    {0xc55b2c67a548dd77ull, 1},
+    {0xc567f7b01f5272feull, 4},
+    {0xc57b63097c29091aull, 10},
+    {0xc57c06c4d565bc3cull, 7},
+    {0xc57fc10d2f5390b6ull, 7},
+    {0xc5863e0f72b4cdddull, 7},
+    {0xc58ffc6284b6fc22ull, 11},
+    {0xc593ebb0b8d6b5ceull, 8},
+    {0xc59aff02030b0ba5ull, 6},
+    {0xc5b4a4f06a47e327ull, 9},
+    {0xc5bb51f6e06f834bull, 7},
+    {0xc5bfdecd23accc7aull, 6},
+    {0xc5c458c4f674d843ull, 8},
+    {0xc5e6e7bfb0e22deaull, 7},
+    {0xc5f46a25ffedf935ull, 0},
+    {0xc5f644a2c2c0ecc1ull, 6},
+    {0xc5fc150ad40ee9a9ull, 11},
+    {0xc609116687ce9505ull, 2},
+    {0xc60ef4dde3de20a1ull, 9},
+    {0xc610a6f513a055baull, 6},
+    {0xc6128b31e4912761ull, 6},
+    {0xc619e1827d52d3c5ull, 8},
+    {0xc61d717b9ffba3d7ull, 7},
+    {0xc629e57a3fdfcd4eull, 4},
+    {0xc630ba9224767a7eull, 9},
+    {0xc644789e713e8ee3ull, 11},
+    {0xc6566faab9c8e5aaull, 10},
+    {0xc659c6b9a538f1bcull, 8},
+    {0xc665922151523762ull, 9},
+    {0xc67042473d70b514ull, 8},
+    {0xc67a943560903a0dull, 6},
+    {0xc67d1ad3942fd0b6ull, 11},
+    {0xc68126a2c1ceb0b3ull, 7},
+    {0xc685854a095f2bf1ull, 7},
+    {0xc686686ed56e6bb0ull, 4},
+    {0xc689d09867fe5727ull, 7},
+    {0xc697017910eb9d01ull, 2},
+    {0xc6a06b22031b1b47ull, 10},
+    {0xc6a1c984aa32eb21ull, 2},
+    {0xc6a63eb82ec31424ull, 7},
+    {0xc6a9f6485439d2ebull, 8},
+    {0xc6b43dac17d89322ull, 10},
+    {0xc6bcb99603d4433full, 1},
+    {0xc6bd7d209843630aull, 1},
+    {0xc6cf5b56a301eb12ull, 10},
+    {0xc6cfa4548de390e9ull, 7},
+    {0xc6d87233913471a9ull, 9},
+    {0xc6de31d907685220ull, 9},
+    {0xc6f36ab345e7f13full, 10},
+    {0xc70ab6f1222b26a5ull, 7},
+    {0xc7119eaf4f02db7eull, 6},
+    {0xc72d4dbbd611d28bull, 8},
+    {0xc731122e51cd1e63ull, 7},
+    {0xc73a11a9108b56eaull, 7},
+    {0xc73cbae55535d7ceull, 11},
+    {0xc74b101366c9d1e1ull, 10},
+    {0xc74b601fd3304c93ull, 5},
+    {0xc775259cf1401135ull, 0},
+    {0xc78281e1f36b3cfcull, 11},
+    {0xc784085375187fcdull, 8},
+    {0xc7862c323ae1150full, 9},
+    {0xc79872c3d5450315ull, 10},
+    {0xc79cbbcb12bd07f5ull, 7},
+    {0xc79f56eaee682046ull, 7},
+    {0xc79fde8deee4b0dbull, 11},
+    {0xc7b165fb981e4c9cull, 9},
+    {0xc7b40529907da2f1ull, 8},
+    {0xc7cfae62d8a61f26ull, 6},
+    {0xc7d648de9d35e8f0ull, 6},
+    {0xc7d6ffe48b546158ull, 8},
+    {0xc7da4b7184a57ba8ull, 7},
+    {0xc7dc83dfcc67d42dull, 8},
+    {0xc7eb0647a2e18931ull, 8},
+    {0xc7ecabf7fd20ea4bull, 7},
+    {0xc7f156c9e4a3288bull, 6},
+    {0xc803116394a49036ull, 7},
+    {0xc81140f713d13156ull, 2},
+    {0xc815ce273007ad7aull, 9},
+    {0xc816c709532adcaeull, 6},
+    {0xc817515cf369a3f1ull, 8},
+    {0xc821b91e2b3a2b4full, 11},
+    {0xc82cd708e2174bbdull, 7},
+    {0xc82f07cca57592d9ull, 8},
+    {0xc838c54610204f2dull, 8},
+    {0xc854823bd3d01c85ull, 6},
+    {0xc8696ed92d136a9cull, 10},
+    {0xc86a2703ea89946eull, 9},
+    {0xc86b69b42a8c8d10ull, 11},
+    {0xc874fc034e64e41aull, 9},
+    {0xc87c57de82da7fe1ull, 7},
+    {0xc881ccd0bc100760ull, 7},
+    {0xc8835d9c0cbdb540ull, 7},
+    {0xc888fbdbe3c07c91ull, 10},
+    {0xc8bf5f35e7874cb9ull, 11},
+    {0xc8c37bde47c694c4ull, 10},
+    {0xc8d0b584ab00c0beull, 11},
+    {0xc8d28c81ed12f6fbull, 6},
+    {0xc8e8dffef05148e1ull, 6},
+    {0xc8f0b29a86808351ull, 8},
+    {0xc8f5654b759b6999ull, 10},
+    {0xc903483bdff2c349ull, 7},
+    {0xc90846465419f6d5ull, 9},
+    {0xc9126bd62bee02f5ull, 5},
+    {0xc91f146d2f029b5full, 5},
+    {0xc93070928b5259ddull, 7},
+    {0xc9325c78c41d239dull, 6},
+    {0xc93e348576ac35e0ull, 6},
+    {0xc93e4364392c108aull, 8},
+    {0xc93f25a49a68d0c9ull, 10},
+    {0xc95354790541f20dull, 10},
+    {0xc95d38477b521bd7ull, 11},
+    {0xc963695da4314bdaull, 6},
+    {0xc966b230f4dcde9dull, 10},
+    {0xc969c10eb32446aaull, 6},
+    {0xc96c99bd338e69dfull, 11},
+    {0xc96e021cae6e9a40ull, 6},
+    {0xc993a8a813f65655ull, 10},
+    {0xc9a02414fbd7d045ull, 8},
+    {0xc9d57c7c6b07b1c0ull, 8},
+    {0xc9d59559dff36a22ull, 7},
+    {0xc9d6b415e2323790ull, 8},
+    {0xc9f8e3c5ae065ba6ull, 8},
+    {0xc9f93f8399069e60ull, 8},
+    {0xca15a18b40ade12dull, 8},
+    {0xca1c81637e90e3b7ull, 6},
+    {0xca1d5eb554f97f4bull, 7},
+    {0xca1e46d65410ab1bull, 0},
+    {0xca1fe749492a6223ull, 9},
+    {0xca3423c305e031ffull, 7},
+    {0xca47cf949a520893ull, 11},
+    {0xca47e434d55e64c9ull, 7},
+    {0xca4a82fca195bc5dull, 7},
+    {0xca50defad2e54179ull, 9},
+    {0xca55d62de98c6d54ull, 9},
+    {0xca59fe1227260d17ull, 3},
+    {0xca5d9e1213126b0dull, 6},
+    {0xca6cf1f75dfc2563ull, 0},
+    {0xca760dc86076b550ull, 8},
+    {0xca7768e3986ec3edull, 6},
+    {0xca9489670801cae5ull, 7},
+    {0xca98fac3b7938ad7ull, 7},
+    {0xca999eb643d77c26ull, 8},
+    {0xcaa4c096da9ec980ull, 6},
+    {0xcaaf3f3e5592d015ull, 8},
+    {0xcab55e9e640a256bull, 6},
+    {0xcaba6ed5cd27bd8eull, 0},
+    {0xcac2c7e7cf7684faull, 0},
+    {0xcac8e465ba68e1b7ull, 10},
+    {0xcac93304f5c03ff4ull, 6},
+    {0xcad17e12b7eb885bull, 7},
+    {0xcad27cead10db9caull, 1},
+    {0xcad7955869fed3e8ull, 11},
+    {0xcadbd6514b9adcc0ull, 6},
+    {0xcadf3bd57af3e405ull, 7},
+    {0xcaee9714f76d4d72ull, 10},
+    {0xcb0d99ec69f64872ull, 9},
+    {0xcb0dd035b68fe8a3ull, 11},
+    {0xcb11d49697ed8389ull, 7},
+    {0xcb18553592bdc8f7ull, 6},
+    {0xcb195d85014d459eull, 6},
+    {0xcb1fc1c729ca1f1eull, 6},
+    {0xcb1fffb9854e26f8ull, 11},
+    {0xcb238beb67de1b39ull, 6},
+    {0xcb2b890de72dc705ull, 0},
+    {0xcb2e099e94f6a462ull, 6},
+    {0xcb301f329f0f5c6full, 8},
+    {0xcb5b75cc449bd976ull, 6},
+    {0xcb605f9d970688b3ull, 7},
+    {0xcb732e5b8cc44020ull, 7},
+    {0xcb744e0c55c724ccull, 6},
+    {0xcb89e1f45115e425ull, 11},
+    {0xcb952d527348246dull, 7},
+    {0xcb97d513e2175e8bull, 6},
+    {0xcba2d48a84067f7aull, 9},
+    {0xcbaa45b7a52f9b5bull, 6},
+    {0xcbac4db2cb38e6cdull, 6},
+    {0xcbb157808628a5e8ull, 11},
+    {0xcbc181eadeb30a55ull, 11},
+    {0xcbd3f52084b3988aull, 1},
+    {0xcbe8fcf66546f2e5ull, 10},
+    {0xcbf55add13d2ac88ull, 8},
+    {0xcbf962aea0bf2a8aull, 10},
+    {0xcc0ec2464f2cf45cull, 10},
+    {0xcc155a03dd1fdf99ull, 8},
+    {0xcc1667eb50b13fedull, 1},
+    {0xcc1d7b2429a3fc5full, 9},
+    {0xcc47a25beb02df74ull, 0},
+    {0xcc481f6f30ac8089ull, 10},
+    {0xcc4c3dab17d4f698ull, 6},
+    {0xcc51846c618fe359ull, 8},
+    {0xcc61bce86026fa5dull, 0},
+    {0xcc645964300a5abcull, 9},
+    {0xcc6d96b3024ef5eaull, 8},
+    {0xcc6df46eeac4c8f0ull, 11},
+    {0xcc6f27a0bf76d420ull, 8},
+    {0xcc77c0fcb6e92d6full, 10},
+    {0xcc821ec9df4ce7d1ull, 10},
+    {0xcc8298d1db100e32ull, 7},
+    {0xcc8f1469df062b09ull, 6},
+    {0xcca0a02d8a587662ull, 11},
+    {0xcca7c62ac9b85486ull, 8},
+    {0xccb19c71741e9ae4ull, 11},
+    {0xccbef6a7cbd4b3c6ull, 0},
+    {0xcccf6a93b5b5c87eull, 7},
+    {0xccd5d53d3fdb8e79ull, 6},
+    {0xcd03fd523a5c8549ull, 11},
+    {0xcd10b4eaf8917b48ull, 9},
+    {0xcd140ab55232f1ddull, 11},
+    {0xcd15b42ebda53059ull, 6},
+    {0xcd1a08d8dc18a7d6ull, 11},
+    {0xcd1b6b4743b54a8eull, 2},
+    {0xcd1d32fdeb5f9597ull, 7},
+    {0xcd27f55ca7a81312ull, 11},
+    {0xcd30125d650a097aull, 9},
+    {0xcd30ba4a6792e0e3ull, 11},
+    {0xcd32fe8d8dc7afe1ull, 10},
+    {0xcd34747d2ae9894bull, 11},
+    {0xcd4397e4c0300ac7ull, 6},
+    {0xcd440ec5310aaea5ull, 6},
+    {0xcd4d20889f8d2265ull, 11},
+    {0xcd4e32fbdeaa30aeull, 8},
+    {0xcd57502a4a124340ull, 2},
+    {0xcd5b55ac98a31842ull, 9},
+    {0xcd6275124ff3e47cull, 6},
+    {0xcd70575c47ec7911ull, 6},
+    {0xcd748c3c59628d1bull, 8},
+    {0xcd7abef1c1651ec7ull, 7},
+    {0xcd868958432dbbf6ull, 7},
+    {0xcd8a9582f72fc3dfull, 7},
+    {0xcd8e907c674d551full, 7},
+    {0xcd97e6b241d108b1ull, 8},
+    {0xcd9d1bbef39714b0ull, 8},
+    {0xcda179ff12339c7full, 7},
+    {0xcda196c04db4558dull, 1},
+    {0xcda522207af9db0bull, 6},
+    {0xcda76fab4003fca9ull, 7},
+    {0xcdaa6fdebe635318ull, 9},
+    {0xcdc14f1c4ac01781ull, 8},
+    {0xcdd32a0b59bd77b5ull, 4},
+    {0xcdd6ec517212cbe9ull, 7},
+    {0xcdda354db4a124dbull, 7},
+    {0xcddd87634aac926full, 7},
+    {0xcde42acff77327edull, 8},
+    {0xcde9a11d6866a486ull, 3},
+    {0xcdebce650da6bafaull, 6},
+    {0xcdeea5bd42b08a2aull, 10},
+    {0xcdf64fd00a15ff14ull, 6},
+    {0xcdf8d2953a002643ull, 11},
+    {0xce0028da4efe35c1ull, 6},
+    {0xce18e1fcdee1c5feull, 8},
+    {0xce1d6d5e6292f824ull, 11},
+    {0xce2231b38d3a0655ull, 0},
+    {0xce2ba90f604ba881ull, 1},
+    {0xce43402bf3e38bf8ull, 11},
+    {0xce46eb86a486ac89ull, 6},
+    {0xce593c5b240d5dc8ull, 0},
+    {0xce686e9396431db7ull, 6},
+    {0xce6d58feb07d80a9ull, 5},
+    {0xce6fca296e7d984bull, 7},
+    {0xce987d9b64d787a4ull, 8},
+    {0xce9a33b0ed7221c2ull, 10},
+    {0xce9d3710c7a40f6eull, 3},
+    {0xcea34cd0cbbe9259ull, 6},
+    {0xceb478e13311ee2aull, 9},
+    {0xceb5d911e502bc69ull, 8},
+    {0xcebd30f888f9edb3ull, 8},
+    {0xcebece4510d14426ull, 7},
+    {0xced2cb98ecfd2be0ull, 6},
+    {0xced3f9a6efc15741ull, 7},
+    {0xceda3a6c5798c753ull, 6},
+    {0xcee16c75265b5a4aull, 10},
+    {0xcee36102d4ce7420ull, 10},
+    {0xcef082e2cf029b11ull, 11},
+    {0xcef2e0bbe591977aull, 6},
+    {0xcf0fe5868c634bc4ull, 9},
+    {0xcf151e5ffe7946b6ull, 2},
+    {0xcf1a9d8481bcb411ull, 7},
+    {0xcf1fec0465c90990ull, 7},
+    {0xcf577bdbaf4a5f79ull, 7},
+    {0xcf6745525ab72721ull, 7},
+    {0xcf6ea47b9ba33460ull, 6},
+    {0xcf6f0fa7110f024full, 11},
+    {0xcf7813e85c6a211dull, 11},
+    {0xcf7eb2f49de4f737ull, 8},
+    {0xcf827b4218e5d123ull, 7},
+    {0xcfa88dc9aa3c0424ull, 8},
+    {0xcfb326dca70973faull, 11},
+    {0xcfbc78d742e061a3ull, 6},
+    {0xcfc2a4910190feb5ull, 6},
+    {0xcfd473969204183bull, 7},
+    {0xcfdf2566f6d1ac32ull, 6},
+    {0xcfec983e83fb8ef2ull, 0},
+    {0xcff688c4708e4c39ull, 10},
+    {0xcffc3347f28d59baull, 2},
+    {0xcffd429799f2de82ull, 6},
+    {0xd000d3df7a29d9f4ull, 6},
+    {0xd00642c15355d46aull, 5},
+    {0xd021d3a58647cb0dull, 9},
+    {0xd028e75472c7229eull, 8},
+    {0xd02ab2db6a37f00full, 7},
+    {0xd02d7763b54828c9ull, 0},
+    {0xd04b449977cdc434ull, 8},
+    {0xd0545fe1ff8d2170ull, 6},
+    {0xd05c627fd9ad255cull, 7},
+    {0xd06982d6bc521cc8ull, 11},
+    {0xd0789a2ba95666b7ull, 9},
+    {0xd08b1ad358f262a0ull, 7},
+    {0xd0947f549da9ac3cull, 5},
+    {0xd0a7383433208320ull, 7},
+    {0xd0a8e9bfaa44e249ull, 1},
+    {0xd0ac926789b55df1ull, 6},
+    {0xd0b9054c7f158a9cull, 8},
+    {0xd0bb95e5470de72eull, 7},
+    {0xd0c556748721bd97ull, 7},
+    {0xd0ca2b728787a7a7ull, 7},
+    {0xd0cf9277fbc05667ull, 0},
+    {0xd0f07e124ef31553ull, 0},
+    {0xd11aaff0aa6d94dcull, 6},
+    {0xd11febf863ccf761ull, 4},
+    {0xd12cdb076be6b0fcull, 3},
+    {0xd14e480583b08e7cull, 3},
+    {0xd15242bd61e2a7a7ull, 6},
+    {0xd159140267e6d2ccull, 9},
+    {0xd15b1bd13707feefull, 9},
+    {0xd16c37e36d4c3b4cull, 6},
+    {0xd1704d3a03c3729eull, 10},
+    {0xd170a930e7d8d8e5ull, 8},
+    {0xd173137902530159ull, 0},
+    {0xd17adccb97d825e9ull, 10},
+    {0xd17ceb5d7fa3f695ull, 9},
+    {0xd18a56bc2d787accull, 6},
+    {0xd1c1d780deee99a1ull, 11},
+    {0xd1c9a1e85d8435f9ull, 8},
+    {0xd1d42dc906e60f83ull, 7},
+    {0xd1d7987c247cda93ull, 8},
+    {0xd1df74ac86934b02ull, 7},
+    {0xd1fca30144c573baull, 6},
+    {0xd2050823c033dd82ull, 7},
+    {0xd20c514f96d684caull, 9},
+    {0xd24327cdaac968c1ull, 11},
+    {0xd24856adf30f8477ull, 10},
+    {0xd251f38fa7fe3467ull, 9},
+    {0xd2665156fad5c0e5ull, 6},
+    {0xd267f8e95e882c5bull, 7},
+    {0xd268e01a48a01a06ull, 6},
+    {0xd291f96f7685a6c2ull, 6},
+    {0xd2a528e35e20e9f9ull, 6},
+    {0xd2b4859ab44f1ee0ull, 7},
+    {0xd2c857e1cdad6b5bull, 6},
+    {0xd2cb1ed16e3a8d43ull, 3},
+    {0xd2d208736537866dull, 10},
+    {0xd2d828587645268dull, 11},
+    {0xd2db348e4c3c3523ull, 0},
+    {0xd2e14c5fdd21b805ull, 1},
+    {0xd2f1df1068bed712ull, 6},
+    {0xd2fa0c8687d48104ull, 6},
+    {0xd2fbc3eea9503793ull, 1},
+    {0xd30b28e1787c5f79ull, 7},
+    {0xd30c084b0ad7de4full, 0},
+    {0xd313a5c30dd0f360ull, 6},
+    {0xd31aade557fb6649ull, 7},
+    {0xd32efb5c4e98fafaull, 9},
+    {0xd334bc2e2a6b52ccull, 6},
+    {0xd3379176f6fb1d17ull, 3},
+    {0xd33ec8481d8366edull, 11},
+    {0xd34d2b3b777df510ull, 10},
+    {0xd35504aaacd63382ull, 0},
+    {0xd35bc92a9bb5722aull, 0},
+    {0xd35c0a495b906c2cull, 9},
+    {0xd35c636025c02e93ull, 6},
+    {0xd3764df5c172b0f4ull, 7},
+    {0xd3839b883c0dab6full, 0},
+    {0xd38a4120e2f18a99ull, 0},
+    {0xd39027a36e51e55dull, 6},
+    {0xd39f169016d98423ull, 0},
+    {0xd39fc8337b1b2fdaull, 6},
+    {0xd3d352f3679e564full, 2},
+    {0xd3daa5dafbd83b00ull, 7},
+    {0xd3e50d5884cbb40bull, 10},
+    {0xd3fbd8f9286427d4ull, 10},
+    {0xd409fc61934ff93dull, 11},
+    {0xd40edb8e626db8bdull, 9},
+    {0xd4158f540a0d8697ull, 7},
+    {0xd4183e19fb430c91ull, 10},
+    {0xd41925af6be47118ull, 9},
+    {0xd4233ccaa5871939ull, 7},
+    {0xd4254dd04b24a3c6ull, 0},
+    {0xd42b6156c8013478ull, 11},
+    {0xd44a485f1b085507ull, 6},
+    {0xd465fffd96de4dd3ull, 7},
+    {0xd46d2672c610d676ull, 10},
+    {0xd48659eb108500bbull, 3},
+    {0xd490c8fff353600dull, 10},
+    {0xd495d6f2ea80302eull, 6},
+    {0xd4a2a8cfa3d472a4ull, 7},
+    {0xd4a32811cf4ae6daull, 6},
+    {0xd4a35a2364a83944ull, 9},
+    {0xd4adcb40cf9f500full, 2},
+    {0xd4b24c5e6944bd04ull, 6},
+    {0xd4b29b753175e57eull, 8},
+    {0xd4b62c5e5d70db1eull, 4},
+    {0xd4bb388e830f455eull, 10},
+    {0xd4c0361605ee5970ull, 6},
+    {0xd4cacd8ac6bcf68eull, 0},
+    {0xd4dd172c8a53cc32ull, 6},
+    {0xd4de7e8e657ac40full, 10},
+    {0xd4ec972d5bad0b45ull, 8},
+    {0xd4f4bb49883e6a69ull, 6},
+    {0xd4f8a7adda0ac776ull, 8},
+    {0xd4fbce72f7c61c73ull, 10},
+    {0xd5001d66a039a6a9ull, 7},
+    {0xd5027576be88e031ull, 0},
+    {0xd50a5863310051d5ull, 7},
+    {0xd519f3263ea77572ull, 0},
+    {0xd53123d682cf816dull, 11},
+    {0xd533fc6e90c8e369ull, 8},
+    {0xd540b14ee32f20aeull, 1},
+    {0xd55ff1259a4d0365ull, 6},
+    {0xd5777ce6f1f528a0ull, 6},
+    {0xd57995e684f65ebcull, 4},
+    {0xd57ac35891575c43ull, 8},
+    {0xd57bfc9106811144ull, 6},
+    {0xd58c3fac7172b9e6ull, 6},
+    {0xd5a3ded0f9473c7eull, 8},
+    {0xd5b252a470007419ull, 1},
+    {0xd5c1aedb305ea814ull, 7},
+    {0xd5d62d1b7541eb60ull, 6},
+    {0xd5da740fe5eb3283ull, 1},
+    {0xd5dc0d0678dda899ull, 7},
+    {0xd5efe5a1c5073d9dull, 9},
+    {0xd5fe06daedbb5580ull, 7},
+    {0xd5ffaf687e5a4afbull, 11},
+    {0xd60338c3189cecc6ull, 2},
+    {0xd60cabe94ad4f9bdull, 10},
+    {0xd610e06a729f8ef4ull, 8},
+    {0xd6169f38c167dfd3ull, 3},
+    {0xd618ac60c7f442b8ull, 6},
+    {0xd61ab7070fcdbf90ull, 9},
+    {0xd61d497bb965f0ceull, 7},
+    {0xd6378082d5f826b4ull, 3},
+    {0xd64eec3a52fe5b12ull, 8},
+    {0xd65d0fc37cfb199cull, 9},
+    {0xd66d113d79145f2full, 7},
+    {0xd66e2974b2b515c3ull, 10},
+    {0xd67245988ae3cf26ull, 4},
+    {0xd68b37cd0e061aadull, 9},
+    {0xd691c4b03ab41d10ull, 6},
+    {0xd69237079f003adcull, 0},
+    {0xd6926ba210a6109aull, 8},
+    {0xd6b2e52aa3ebd5ffull, 6},
+    {0xd6badf134988c618ull, 8},
+    {0xd6caadbfefbcb85cull, 9},
+    {0xd6cb42f5a74b547bull, 8},
+    {0xd6d562ad865f45a5ull, 7},
+    {0xd6e664e999bb8717ull, 7},
+    {0xd6e82ce888e3748cull, 0},
+    {0xd6fe101e01b33fc3ull, 8},
+    {0xd70216740e56e37aull, 6},
+    {0xd71ae98d3d1b3fdfull, 8},
+    {0xd7277b4d66701eb8ull, 9},
+    {0xd73c93d98e30d94dull, 11},
+    {0xd73fd0438625ea5eull, 11},
+    {0xd753a6028cba3f79ull, 11},
+    {0xd768392771a0b4caull, 7},
+    {0xd76a1b3dbf89ab57ull, 8},
+    {0xd76bf57997dc0092ull, 10},
+    {0xd77630b5834ce2acull, 6},
+    {0xd77cd2a1d939eaffull, 9},
+    {0xd783c493bf5ca902ull, 8},
+    {0xd7abb5e34dad4062ull, 4},
+    {0xd7b4a01baa2cf298ull, 11},
+    {0xd7b656efceae93f7ull, 9},
+    {0xd7c18b0ad28f8046ull, 6},
+    {0xd7c7826152821a28ull, 11},
+    {0xd7c8214473559119ull, 10},
+    {0xd7c968daf514770aull, 6},
+    {0xd7e7ff25c4523d02ull, 8},
+    {0xd7eb9450134c7e6aull, 6},
+    {0xd7f2072103637628ull, 6},
+    {0xd7ff85aa7712a131ull, 7},
+    {0xd805664f3346718aull, 6},
+    {0xd811be06a49983f1ull, 9},
+    {0xd829573d131bf86aull, 7},
+    {0xd82f1e9238ed2149ull, 6},
+    {0xd839307eb71d0396ull, 11},
+    {0xd83a35623c514510ull, 6},
+    {0xd84522e659b2be16ull, 7},
+    {0xd8458aab35ecfa3aull, 5},
+    {0xd848942f259648d1ull, 7},
+    {0xd84cbefce78f1f5full, 9},
+    {0xd85fb3ba740af31bull, 6},
+    {0xd867025609851528ull, 7},
+    {0xd87acb36801ebb62ull, 9},
+    {0xd87f49d4d5f3a810ull, 6},
+    {0xd8837ab0dd16ee05ull, 5},
+    {0xd88bb9cdb3943c71ull, 7},
+    {0xd896ee1e55665ff7ull, 7},
+    {0xd8a165abd84433a4ull, 7},
+    {0xd8b18c567436c503ull, 7},
+    {0xd8b5e684108184f7ull, 7},
+    {0xd8bc99d6189cd8eeull, 6},
+    {0xd8c44ccea1a00275ull, 6},
+    {0xd8ccdfbaad3f7b72ull, 11},
+    {0xd8d0727d4f068876ull, 6},
+    {0xd8d3cc56924a6810ull, 8},
+    {0xd8e8159aa1190acaull, 11},
+    {0xd8f2a3deb7f47c1dull, 6},
+    {0xd8f45fffd26e7996ull, 9},
+    {0xd900539064488f92ull, 7},
+    {0xd90287ae35ad7340ull, 7},
+    {0xd902bd7510605ac1ull, 9},
+    {0xd9082a9743175ef4ull, 9},
+    {0xd90b54466fd534a9ull, 9},
+    {0xd90e7f4ee93d190aull, 6},
+    {0xd917af05765b5acaull, 9},
+    {0xd91aed117e452ec1ull, 6},
+    {0xd9202547e7ad5deeull, 7},
+    {0xd925f0a62bc7553dull, 4},
+    {0xd93800dbb24845a8ull, 7},
+    {0xd942668b0d25cc56ull, 10},
+    {0xd949cbf9175b788dull, 2},
+    {0xd94a34ee8a8e6331ull, 6},
+    {0xd94a922a97e2384aull, 11},
+    {0xd94bf3bd05f8c809ull, 0},
+    {0xd970600db4e397f6ull, 9},
+    {0xd9810e8e0cc21ba9ull, 8},
+    {0xd981e67e81c2f842ull, 9},
+    {0xd9821d00ac3f3d9full, 7},
+    {0xd985f9e74ce2f5dfull, 9},
+    {0xd98c360676d82892ull, 10},
+    {0xd998e7d0514929a1ull, 3},
+    {0xd99c147144f0f2feull, 9},
+    {0xd9a6c3dba5ca1ca1ull, 0},
+    {0xd9b52d40b60051d9ull, 7},
+    {0xd9bde4182564105eull, 9},
+    {0xd9c9287cdc37267dull, 11},
+    {0xd9c9f1acc4dac3aaull, 7},
+    {0xd9e992cbd032064dull, 7},
+    {0xd9ff9f5fc0e26e5full, 10},
+    {0xda03cb9bcb582f8aull, 9},
+    {0xda04e7243dff00a6ull, 10},
+    {0xda14b2617fe2b0c6ull, 10},
+    {0xda1bf6f835dd30ffull, 1},
+    {0xda359362167a4825ull, 8},
+    {0xda5896b3a2e16526ull, 9},
+    {0xda5f8329aa161e43ull, 2},
+    {0xda6ca9166efdc2ccull, 6},
+    {0xda762b78bfa2f129ull, 10},
+    {0xda7a9c63c800b3a7ull, 1},
+    {0xda7e4967549670c7ull, 8},
+    {0xda8d6b747aa4946eull, 2},
+    {0xda9ec5e06a4c52d1ull, 7},
+    {0xdaada0682a378958ull, 7},
+    {0xdab47e2d70073139ull, 6},
+    {0xdac50d949ee693b2ull, 6},
+    {0xdad42dfed084485bull, 7},
+    {0xdada0df6d287864aull, 7},
+    {0xdae76d8875468736ull, 2},
+    {0xdaeef0e222644e9aull, 2},
+    {0xdaf5df4c204b9816ull, 0},
+    {0xdb126878f863c433ull, 7},
+    {0xdb13a0064e259d9bull, 8},
+    {0xdb163bd5a57db808ull, 6},
+    {0xdb1c413fceb80369ull, 8},
+    {0xdb2125569ea12179ull, 9},
+    {0xdb2b25b7dbc858f3ull, 7},
+    {0xdb3f7999411a932cull, 6},
+    {0xdb455cf1c4461cc4ull, 6},
+    {0xdb4b3f35f90fffddull, 10},
+    {0xdb4d2ec009c90b25ull, 9},
+    {0xdb63187a31d53aa5ull, 6},
+    {0xdb65280b0b5b2819ull, 9},
+    {0xdb76e4a92c222b76ull, 11},
+    {0xdb8d061070508382ull, 9},
+    {0xdb8d14e0a78e868eull, 6},
+    {0xdb9c83970edba122ull, 10},
+    {0xdbbcff7dc6e80731ull, 6},
+    {0xdbcdba241c772f12ull, 11},
+    {0xdbd5d79fd4d4332aull, 10},
+    {0xdc0174d51f3a9489ull, 6},
+    {0xdc098dc0d113a3e6ull, 7},
+    {0xdc2274570b51f32cull, 6},
+    {0xdc2a44cf9d75a227ull, 0},
+    {0xdc2abbe86ad27127ull, 7},
+    {0xdc34410963842389ull, 8},
+    {0xdc395dc40bef62a9ull, 2},
+    {0xdc4287ff08753143ull, 10},
+    {0xdc432f3b4bd33b4dull, 9},
+    {0xdc4478aa83ed719cull, 6},
+    {0xdc4bd86c5e4f56adull, 7},
+    {0xdc5a16c39280c625ull, 0},
+    {0xdc5a746552960775ull, 7},
+    {0xdc645cb2016f46e5ull, 9},
+    {0xdc9e8d35ae421c1dull, 9},
+    {0xdcabc4f0f4276d4full, 9},
+    {0xdcb52f499b247857ull, 7},
+    {0xdcd7f04c75fcce5dull, 6},
+    {0xdcdb03082e0a3edfull, 0},
+    {0xdce589c1c6c35a70ull, 11},
+    {0xdce774d9965bc290ull, 8},
+    {0xdcf646b99d4a677full, 1},
+    {0xdd0372f097aef8a9ull, 8},
+    {0xdd125d40a7959434ull, 11},
+    {0xdd14e7b2ca5cf99eull, 1},
+    {0xdd186361a531608cull, 6},
+    {0xdd2000c935464088ull, 6},
+    {0xdd28968c3dbe37e7ull, 8},
+    {0xdd33c958f48401d3ull, 0},
+    {0xdd375af86cba88c7ull, 7},
+    {0xdd3a1d08a6ead789ull, 6},
+    {0xdd3ae00588761515ull, 8},
+    {0xdd3c3677b562995aull, 8},
+    {0xdd402fa2b52d9c5full, 11},
+    {0xdd4230fa960b7ebeull, 9},
+    {0xdd45047153f9eabfull, 6},
+    {0xdd5008fbb6ec561eull, 8},
+    {0xdd57c510135a7c4dull, 9},
+    {0xdd5870be98fc9804ull, 6},
+    {0xdd608a4d279bd8bfull, 8},
+    {0xdd617c7eee6f391aull, 1},
+    {0xdd63ef9b65e613b7ull, 7},
+    {0xdd66c978950702bcull, 7},
+    {0xdd6821ad67d6ce8eull, 6},
+    {0xdd78f7dbdd3d3203ull, 7},
+    {0xdd852a5cdb893eb7ull, 8},
+    {0xdd8592810feb72fcull, 7},
+    {0xdd8812a3580c595cull, 11},
+    {0xdd8aff2f391f2ab0ull, 0},
+    {0xdd8b2f8d2b4115b1ull, 0},
+    {0xdd98bf5bef4a1519ull, 6},
+    {0xddac0498fa1cb92bull, 7},
+    {0xddc63b1e131fac5dull, 2},
+    {0xddddcdf114df11ebull, 10},
+    {0xdde5238c26a6f398ull, 8},
+    {0xddf0faa185a85759ull, 7},
+    {0xde1e3cb68552a687ull, 7},
+    {0xde2350cdd0a4fc60ull, 7},
+    {0xde3922a1fcc466fcull, 6},
+    {0xde4685828e7d34f1ull, 11},
+    {0xde49ca491efad00eull, 7},
+    {0xde5496c49a84eb60ull, 7},
+    {0xde5505b62cb341a6ull, 0},
+    {0xde57c31d23e8fc03ull, 11},
+    {0xde6425d7bb84f9eaull, 1},
+    {0xde6e91379aaeb5ddull, 0},
+    {0xde6f346955a91ee4ull, 8},
+    {0xde77e4fd386c5341ull, 8},
+    {0xde8bbe27a65cadedull, 10},
+    {0xde9134c972415025ull, 7},
+    {0xde91ea90f90eac43ull, 9},
+    {0xde935816a847fd4bull, 1},
+    {0xdea2878a12f795fcull, 7},
+    {0xdea2ab0b30b9e43bull, 10},
+    {0xdea3a0e38a5c9fadull, 1},
+    {0xdeaf31a5ad1645c6ull, 1},
+    {0xdeb65404f67854ebull, 10},
+    {0xdebde6ea8a7d5244ull, 6},
+    {0xdec0236d570c4ba2ull, 9},
+    {0xdecc88ebcb9ad4edull, 8},
+    {0xded096a8121e9d33ull, 0},
+    {0xded1a9b4ea65b8c7ull, 8},
+    {0xdedbb3504042b4d5ull, 1},
+    {0xdee352628dd1e303ull, 1},
+    {0xdf0a26a037e6a058ull, 11},
+    {0xdf294ea0d5ed852dull, 2},
+    {0xdf323f64724678eeull, 6},
+    {0xdf49aa6f8e35b467ull, 7},
+    {0xdf4bff1a3ed7c82bull, 6},
+    {0xdf561da71a2ead91ull, 8},
+    {0xdf57d3eea7bd629full, 8},
+    {0xdf621d8831500034ull, 7},
+    {0xdf93e2d439996978ull, 9},
+    {0xdfacbe40cba1e419ull, 11},
+    {0xdfb55ff074127e94ull, 7},
+    {0xdfb5abce6cf4d082ull, 11},
+    {0xdfbcceadd7b6412cull, 6},
+    {0xdfc41c34364dada2ull, 7},
+    {0xdfc85a184ec48db3ull, 4},
+    {0xdfce26046723b773ull, 11},
+    {0xdfeb0085a0d2e99bull, 9},
+    {0xe00dd771689f6e0eull, 7},
+    {0xe00f2e86b76dbb69ull, 6},
+    {0xe0111bc834c5e37aull, 0},
+    {0xe01cde0f32017630ull, 7},
+    {0xe02bb2e146c40dd8ull, 6},
+    {0xe0323358ca07a341ull, 9},
+    {0xe03d5358ddd42fd6ull, 8},
+    {0xe0450f598f18a783ull, 6},
+    {0xe0484fd69a4488a1ull, 6},
+    {0xe04e11c734193335ull, 11},
+    {0xe0582fb40c7d5e7eull, 11},
+    {0xe05d9fdb73547318ull, 1},
+    {0xe076cdaa8ba1e405ull, 8},
+    {0xe08e468aafb147a5ull, 7},
+    {0xe0c855b94b713cf3ull, 0},
+    {0xe0d451d72e61fb13ull, 7},
+    {0xe0e5c941d3bc7c77ull, 7},
+    {0xe0e7c87ef7fe029cull, 7},
+    {0xe0e87a359fd6e083ull, 5},
+    {0xe0f226f71f9be822ull, 9},
+    {0xe0f38a7720bf66d7ull, 6},
+    {0xe0fa7309f7608944ull, 6},
+    {0xe100fdcbb0e1b3e7ull, 0},
+    {0xe11b62ae01520b53ull, 11},
+    {0xe1280ac30585609eull, 10},
+    {0xe12c268ad255a6b2ull, 7},
+    {0xe143ebbf27a3b78aull, 6},
+    {0xe145b31ac5b5178aull, 8},
+    {0xe155fa19fcbbaf03ull, 9},
+    {0xe1587830edbd2ef5ull, 9},
+    {0xe160b94efdc22373ull, 10},
+    {0xe1676e6996271bb1ull, 9},
+    {0xe16c671d1c3a21deull, 7},
+    {0xe171685ad0f16647ull, 8},
+    {0xe17dd3229657954aull, 6},
+    {0xe183080a0449c70aull, 10},
+    {0xe1845864b0bcfc55ull, 9},
+    {0xe18e3091bd7ccad0ull, 6},
+    {0xe1a97a6a95f7a50aull, 7},
+    {0xe1b5228dc45c9efbull, 0},
+    {0xe1cc032d8f6ced60ull, 11},
+    {0xe1fb1ee15fcb14caull, 6},
+    {0xe1fd752d5bf6a231ull, 11},
+    {0xe2121f436e7bde45ull, 7},
+    {0xe212f98464646dafull, 8},
+    {0xe213283283df3000ull, 7},
+    {0xe217de7717618b80ull, 8},
+    {0xe218f110b3f88a36ull, 7},
+    {0xe22b6f968a00be94ull, 1},
+    {0xe234f61c2ef22517ull, 6},
+    {0xe241771261fbfe23ull, 6},
+    {0xe250d0ba6b570661ull, 11},
+    {0xe2566e4166932991ull, 8},
+    {0xe2597fb28e0a2492ull, 2},
+    {0xe266314cf46677abull, 7},
+    {0xe26f5c30a0a47a1dull, 8},
+    {0xe2796ed6245b2695ull, 11},
+    {0xe281f0f6732d9288ull, 6},
+    {0xe287b05795464720ull, 7},
+    {0xe28e0a55eadd9329ull, 2},
+    {0xe29a2c814a67f590ull, 7},
+    {0xe29eeaff058648f2ull, 7},
+    {0xe2a1704357d18387ull, 6},
+    {0xe2a65ba444f39272ull, 10},
+    {0xe2ce59d27e764404ull, 9},
+    {0xe2e24f5088852ecdull, 5},
+    {0xe2ebd0cc55c9ab5eull, 8},
+    {0xe2febf6541798deeull, 6},
+    {0xe302a72f82ebd10aull, 11},
+    {0xe30cbd0c0f13e466ull, 0},
+    {0xe3179c888a318281ull, 6},
+    {0xe317a2751c1da5a6ull, 6},
+    {0xe319eafecc3de8c3ull, 6},
+    {0xe322c8dcdbf057d9ull, 11},
+    {0xe3260965f3e14b30ull, 0},
+    {0xe32887539cee887dull, 3},
+    {0xe32e344bdfd76fc1ull, 7},
+    {0xe32ffeb310faa314ull, 6},
+    {0xe336c5dd9e0e6940ull, 1},
+    {0xe346a55565c508a9ull, 9},
+    {0xe35d2cb9e30a61a6ull, 7},
+    {0xe3634e413d2bf563ull, 1},
+    {0xe36c1095b0aeb668ull, 7},
+    {0xe37025206a303686ull, 11},
+    {0xe37f4310a419dda2ull, 9},
+    {0xe38a94eda6f7fadfull, 11},
+    {0xe39d017a0aa65d03ull, 11},
+    {0xe3a2e086fd6b4ec7ull, 10},
+    {0xe3a3776b73dc4ce2ull, 0},
+    {0xe3ab47a785a4891full, 8},
+    {0xe3b772125f3a09f1ull, 6},
+    {0xe3bb081649873464ull, 7},
+    {0xe3c898fce1b486e9ull, 9},
+    {0xe3c96db789eeb518ull, 11},
+    {0xe3e9305722b9770eull, 0},
+    {0xe3e95bc5bcc69ef4ull, 7},
+    {0xe3f6ba435bf35c4bull, 8},
+    {0xe3fff85bb9b555c8ull, 11},
+    {0xe41edf064f252869ull, 10},
+    {0xe42abf5ee32405ebull, 8},
+    {0xe43ac13a6f160decull, 6},
+    {0xe453e75082af67ecull, 10},
+    {0xe457573ce361fe14ull, 7},
+    {0xe468413fbf9df779ull, 10},
+    {0xe46a9114947ffa5eull, 6},
+    {0xe49f39073bb63e3dull, 7},
+    {0xe4bed1cd17984fb3ull, 11},
+    {0xe4bfbad832a5fc98ull, 9},
+    {0xe4c5ef7c83df1581ull, 9},
+    {0xe4c9948f958210daull, 11},
+    {0xe4cd890e2c81bb00ull, 8},
+    {0xe4e28f91dbb7a3e4ull, 0},
+    {0xe4e832d486ef8a83ull, 11},
+    {0xe4ef5a594bc016b8ull, 0},
+    {0xe4f40275ec952911ull, 0},
+    {0xe4fb376eaa8245c4ull, 4},
+    {0xe4fcd979bd92c0e7ull, 10},
+    {0xe50650286a6d5152ull, 9},
+    {0xe5244f473e73b2a0ull, 1},
+    {0xe526909622d358a5ull, 6},
+    {0xe52706233323538full, 7},
+    {0xe52b602fd84e0512ull, 7},
+    {0xe53278209179213cull, 7},
+    {0xe533c48da25ac2fdull, 11},
+    {0xe543d687460ab90full, 9},
+    {0xe54c4b7a048b3c6dull, 8},
+    {0xe5578907525fb9aeull, 11},
+    {0xe55bdd0d8f42877dull, 4},
+    {0xe55ca4bec754de5bull, 0},
+    {0xe563489c363891c0ull, 5},
+    {0xe57902d2e80b995bull, 7},
+    {0xe57b00ee0b2f1ad5ull, 7},
+    {0xe5ba855cb59cb912ull, 0},
+    {0xe5cd44f218d9a8a0ull, 8},
+    {0xe5d3f37c62d1bd6full, 8},
+    {0xe5d45555559503e0ull, 6},
+    {0xe5dd8b859a771bb3ull, 9},
+    {0xe5ddcf04d1a0936full, 11},
+    {0xe5e928f3cd44ea48ull, 7},
+    {0xe5f7df65fcb8ffc0ull, 3},
+    {0xe605ddff64c9ff72ull, 6},
+    {0xe6149c19e7dbc32aull, 8},
+    {0xe618785aa4cf0518ull, 8},
+    {0xe61e3ee1c3ec1b9full, 2},
+    {0xe62bce710628d3ebull, 6},
+    {0xe634c148db98344bull, 1},
+    {0xe63e40cd6d4feb0bull, 7},
+    {0xe64e420825a2c35bull, 6},
+    {0xe66402d165a4e4d5ull, 9},
+    {0xe6683dca279c02daull, 9},
+    {0xe66c85517e708114ull, 7},
+    {0xe66f2a651227e796ull, 9},
+    {0xe684c82c0b6d4142ull, 6},
+    {0xe688359febd7fde5ull, 8},
+    {0xe6885e5451efcf62ull, 10},
+    {0xe68fba49d23c698cull, 6},
+    {0xe69079b1d47ab4afull, 6},
+    {0xe693e830725a4930ull, 10},
+    {0xe69dbefe628641a0ull, 7},
+    {0xe69e520c257b8c82ull, 7},
+    {0xe6a0c358fa57a808ull, 6},
+    {0xe6a568bf93a9b666ull, 9},
+    {0xe6a91414b55cb4c8ull, 11},
+    {0xe6c5c7e09ce8023full, 6},
+    {0xe6c967da30b44576ull, 6},
+    {0xe6cc2a161edb4d21ull, 3},
+    {0xe6d8c9002ad7a978ull, 9},
+    {0xe6d9362cdfed6d14ull, 11},
+    {0xe6e6f2f7017852e7ull, 10},
+    {0xe6f4e62efad82d64ull, 0},
+    {0xe6f9c3c427d9d2caull, 5},
+    {0xe70430e8807f9edaull, 9},
+    {0xe70e6c47fded0aa2ull, 8},
+    {0xe723c1314ca355fcull, 9},
+    {0xe7276af5e4377ae3ull, 7},
+    {0xe72777a77c24b3e7ull, 8},
+    {0xe7339adb8fa307beull, 2},
+    {0xe74712f541fdf8d0ull, 9},
+    {0xe74cafeaf704d60bull, 11},
+    {0xe752c5cdaa92c1b5ull, 9},
+    {0xe75ff637385e5ad2ull, 11},
+    {0xe768ec1197dc01d1ull, 6},
+    {0xe7693b00a3f76cd0ull, 11},
+    {0xe76db5b26079eacaull, 11},
+    {0xe76dc5bed58077b8ull, 5},
+    {0xe76f8fb6fc0ba80eull, 9},
+    {0xe77ba1302f203b72ull, 3},
+    {0xe78b7640a2568a93ull, 7},
+    {0xe78d82115b851accull, 11},
+    {0xe7920de62aed1549ull, 6},
+    {0xe79fc14eca05b8b6ull, 11},
+    {0xe7c84e3a8df1387cull, 6},
+    {0xe7e299fa658e7792ull, 11},
+    {0xe7f9bb9e1e0de987ull, 7},
+    {0xe7fd67f2102fc75bull, 11},
+    {0xe80eb053c524f4b8ull, 10},
+    {0xe80f0eb576e6c2aeull, 10},
+    {0xe8114ebaddc7729eull, 7},
+    {0xe826edef8a11c3f3ull, 11},
+    {0xe83921b79f171174ull, 11},
+    {0xe846cdde5a4accd0ull, 11},
+    {0xe84824059d54db61ull, 11},
+    {0xe849373c139390b4ull, 11},
+    {0xe84ac4f0eea4de33ull, 6},
+    {0xe859b94a632228b9ull, 7},
+    {0xe85fd1cb82baefb6ull, 6},
+    {0xe86dae91307981edull, 1},
+    {0xe87045a75b10335aull, 8},
+    {0xe872dd34ab040685ull, 6},
+    {0xe879e00f8fc471a2ull, 9},
+    {0xe882cd9334f818f8ull, 7},
+    {0xe88ac8dbe545101dull, 6},
+    {0xe88cf876c7545556ull, 0},
+    {0xe88d732b7ac1eb98ull, 8},
+    {0xe89a9b013e16bf8cull, 10},
+    {0xe8a1468aa8c4f6a8ull, 7},
+    {0xe8a70289cba0e6a2ull, 1},
+    {0xe8b0d030fae906beull, 7},
+    {0xe8b7f9ce7c1a6beeull, 11},
+    {0xe8cd0840f7296098ull, 6},
+    {0xe8cf6163ee720293ull, 7},
+    {0xe8d61988e8cd4de9ull, 7},
+    {0xe8e3f412abcd90afull, 2},
+    {0xe90b4fed9ddbc9d2ull, 0},
+    {0xe914d80e7e685fbeull, 11},
+    {0xe9321de20fd4813cull, 7},
+    {0xe934ce772d5e39deull, 5},
+    {0xe939ef5eef1f190cull, 7},
+    {0xe941a3e0e10f0170ull, 7},
+    {0xe9420e29eb93b1d8ull, 7},
+    {0xe94c51526ed44864ull, 9},
+    {0xe962c91c46a9a250ull, 6},
+    {0xe9649eaa9187736dull, 7},
+    {0xe9789b0b84c0fef1ull, 7},
+    {0xe98b0bec5bd8d435ull, 7},
+    {0xe9914693da445afbull, 4},
+    {0xe9ada46fd03d33d8ull, 9},
+    {0xe9aef90ef95ea2ceull, 7},
+    {0xe9af697c5dd80c4cull, 6},
+    {0xe9d2f0e1d4386d9bull, 0},
+    {0xe9d966fc1fe27948ull, 10},
+    {0xe9e92e084011092eull, 10},
+    {0xea0166d24452b89full, 7},
+    {0xea31db9a3554581bull, 6},
+    {0xea332bf6d8d6fda5ull, 10},
+    {0xea3e194ad19c9abaull, 7},
+    {0xea45c77b205f9448ull, 6},
+    {0xea4cf172f4b115afull, 6},
+    {0xea6bf49050b1b7bdull, 6},
+    {0xea74b0f202211bd3ull, 1},
+    {0xea927986ff0f008aull, 7},
+    {0xea9a7d630710a7f9ull, 7},
+    {0xea9e51d7207acae3ull, 0},
+    {0xeaa2c398243422dcull, 6},
+    {0xeabc23bf10717dbfull, 6},
+    {0xeac965dfd4c0b87cull, 11},
+    {0xead4b7efec9c3075ull, 7},
+    {0xeaf06aa128c93065ull, 8},
+    {0xeaf1f2a87b1d9c2bull, 7},
+    {0xeafb877d14404ebeull, 10},
+    {0xeb0733fb0d94f926ull, 6},
+    {0xeb0fdeb685090ff3ull, 7},
+    {0xeb118740fb9bb6f5ull, 10},
+    {0xeb2e41a03d4eef80ull, 8},
+    {0xeb32e966a74ad6ebull, 11},
+    {0xeb423e3ad40af452ull, 1},
+    {0xeb42cb9ff8b08cf6ull, 9},
+    {0xeb609a27a896c80dull, 2},
+    {0xeb6b317a44da9dbcull, 0},
+    {0xeb6c5307e0cc4d78ull, 6},
+    {0xeb7ad99e44346147ull, 10},
+    {0xeb86b666487a4965ull, 6},
+    {0xeb9be76be86a3cedull, 7},
+    {0xeba0cb5862d5daeeull, 9},
+    {0xeba375bd24aacf39ull, 9},
+    {0xeba8a4c4e0b24adfull, 11},
+    {0xebaa8c81973ef510ull, 0},
+    {0xebaab61f28165845ull, 7},
+    {0xebb55e5142709d59ull, 11},
+    {0xebcc376a952e9a80ull, 10},
+    {0xebd299089e9c29cbull, 6},
+    {0xebd89759301952bbull, 9},
+    {0xebee0d0c91d41464ull, 6},
+    {0xebf6759496ab9773ull, 1},
+    {0xebf98872658a0b37ull, 5},
+    {0xec000dcf8bc57346ull, 1},
+    {0xec027ab4a6d7a5b8ull, 8},
+    {0xec1b87e8ef74ff25ull, 7},
+    {0xec3550c9a57ced09ull, 3},
+    {0xec3650ee0897b56aull, 8},
+    {0xec39c333ab6639f5ull, 1},
+    {0xec4298ed246c4ef3ull, 11},
+    {0xec45690bbc831200ull, 6},
+    {0xec66dedef97349d2ull, 0},
+    {0xec673cb40b43d582ull, 10},
+    {0xec684610b64867a1ull, 11},
+    {0xec729236d465b4ceull, 6},
+    {0xec743b39564db996ull, 8},
+    {0xec7904aa3ef0de63ull, 9},
+    {0xec7cc9d4ca16fb7bull, 9},
+    {0xec86058c8ce84d49ull, 8},
+    {0xec9b017aa3a24d38ull, 5},
+    {0xeca08ea73f02bf1dull, 3},
+    {0xeca2d6f4ac3085bdull, 8},
+    {0xecac34c121396ebeull, 8},
+    {0xecb65c2bbf44e645ull, 6},
+    {0xecbf73c89a38d0fbull, 8},
+    {0xeccdf55133d0d22eull, 7},
+    {0xecda70ff4be2dae5ull, 8},
+    {0xecdb31ab7fb2881full, 7},
+    {0xecf244bd8599b620ull, 9},
+    {0xecfb06a567dfbfa3ull, 7},
+    {0xecfbf141d97882daull, 6},
+    {0xed222a7a2ba32ed8ull, 6},
+    {0xed34664a1919a04bull, 11},
+    {0xed3ee7df9d18cac9ull, 8},
+    {0xed4d394ddcc75a5cull, 9},
+    {0xed72280c4a80d4d8ull, 11},
+    {0xed788656648890bdull, 6},
+    {0xed7ed38fcea2d743ull, 8},
+    {0xed8dffed2c56b1e8ull, 2},
+    {0xed9bf6f75d42d431ull, 6},
+    {0xeda06e56746d6c77ull, 6},
+    {0xeda210dcbf6ad97bull, 9},
+    {0xeda4f68fcb945a5cull, 11},
+    {0xeda58ebd89bb69ecull, 11},
+    {0xeda631ef34613a7bull, 10},
+    {0xedb19ee7180bf19full, 6},
+    {0xedc3b9930107b4edull, 10},
+    {0xedc8cfe3f3877bc5ull, 7},
+    {0xede469871cbd3e9dull, 4},
+    {0xede531c5008af20cull, 7},
+    {0xede66a10bd5d75fbull, 8},
+    {0xedf898a311b22893ull, 0},
+    {0xee028d6225a1bc35ull, 9},
+    {0xee0494128b8a3d7eull, 0},
+    {0xee0bff3c98a7542cull, 9},
+    {0xee20d5e919f27f43ull, 11},
+    {0xee25ddc0ae3aee5bull, 9},
+    {0xee36a79b66541014ull, 10},
+    {0xee3de2569d5aa0ccull, 4},
+    {0xee4a367cf96d990cull, 7},
+    {0xee4a71d232da6121ull, 7},
+    {0xee4d56f93d0835efull, 1},
+    {0xee5a0bca85dbf8a5ull, 11},
+    {0xee5ce760f3eaedb8ull, 7},
+    {0xee66d7da86f2433bull, 7},
+    {0xee70f0e3e8cc56b9ull, 8},
+    {0xee719e9846ab2a3full, 9},
+    {0xee7596a40e9b8c2cull, 9},
+    {0xee77837711f3aee4ull, 10},
+    {0xee7a705aa7e1356aull, 8},
+    {0xee7eca7f83c22b79ull, 7},
+    {0xee8d9aef1f9f742eull, 7},
+    {0xee92fc1d129fde13ull, 7},
+    {0xee97c8a0957edcf4ull, 6},
+    {0xee9a97ec76b443a9ull, 10},
+    {0xeeb91fa5247531d7ull, 11},
+    {0xeebdc950321065f8ull, 1},
+    {0xeec02c4c9765d2bbull, 11},
+    {0xeec077af9aea6eeaull, 1},
+    {0xeec8fdd35106070bull, 6},
+    {0xeecac0c50454466dull, 6},
+    {0xeeccb94de18cf486ull, 6},
+    {0xeed8ad3e03ee4da6ull, 10},
+    {0xeef3bc116a452079ull, 11},
+    {0xeef78e6c63755e14ull, 0},
+    {0xef0a4b69f579e921ull, 6},
+    {0xef1b1e26d000cddfull, 6},
+    {0xef3e16165e946605ull, 10},
+    {0xef5270f672ea638aull, 9},
+    {0xef60ba598cdbe365ull, 11},
+    {0xef734647fb103c18ull, 9},
+    {0xef78643c151b2ff6ull, 8},
+    {0xef98e634c8b37cfdull, 0},
+    {0xefa2228c8fd69f92ull, 6},
+    {0xefaee6f2e420710dull, 8},
+    {0xefdf842696464e22ull, 6},
+    {0xefec449e119a3df4ull, 6},
+    {0xeff89a56a894b1e4ull, 6},
+    {0xeffcf16bc94907d7ull, 2},
+    {0xf000880df5817307ull, 11},
+    {0xf001339c48332573ull, 7},
+    {0xf002ef86f7def351ull, 8},
+    {0xf02597cbd198fb55ull, 7},
+    {0xf02ce99a9465f21eull, 2},
+    {0xf03be09e36e473a2ull, 9},
+    {0xf042b5b31c24b491ull, 7},
+    {0xf054c24b86f65f87ull, 6},
+    {0xf0607412f55dec1aull, 7},
+    {0xf063f8a13836e246ull, 11},
+    {0xf06761c4d8ed59b8ull, 10},
+    {0xf0a2418ed28e27d0ull, 7},
+    {0xf0a7d2cfb62972fcull, 9},
+    {0xf0bbbe9ab49a89c9ull, 7},
+    {0xf0bce5065d4c7ad0ull, 1},
+    {0xf0c3eaf0cf4d0073ull, 6},
+    {0xf0ca25f14efa7392ull, 10},
+    {0xf0ee15671e7deac0ull, 6},
+    {0xf0f111e0fa52d3c0ull, 11},
+    {0xf0f58d7331e9fc99ull, 8},
+    {0xf103eb8a46b00f7dull, 9},
+    {0xf1086b53e0e8bf21ull, 6},
+    {0xf10b915c29bfbe59ull, 6},
+    {0xf1170996a3ce274cull, 9},
+    {0xf11a6f0b86c76568ull, 11},
+    {0xf11e96c8738106bdull, 10},
+    {0xf12e0227e1364aa3ull, 6},
+    {0xf130c5eac773b310ull, 0},
+    {0xf13e10e01357c6f1ull, 10},
+    {0xf13ec0f54ee8ef45ull, 10},
+    {0xf14ecbda99cf825eull, 1},
+    {0xf1522497952193b3ull, 11},
+    {0xf15d53f207f8b7ceull, 7},
+    {0xf16045026867b5bdull, 8},
+    {0xf16348f0e5ee5b6eull, 6},
+    {0xf178de20cb0703bcull, 11},
+    {0xf180ad300a7f8362ull, 2},
+    {0xf1815aecb0ab7745ull, 6},
+    {0xf182c4ee51880fe1ull, 1},
+    {0xf18c21980b883553ull, 7},
+    {0xf18c63d27119190eull, 8},
+    {0xf19d4e21d410de9eull, 7},
+    {0xf1a246a8d652066aull, 8},
+    {0xf1aa8c70e934c0a3ull, 9},
+    {0xf1bc886257b86d3cull, 8},
+    {0xf1c4ab24c15a8d23ull, 10},
+    {0xf1cacd5a4e07ddc6ull, 0},
+    {0xf1cda8ee6dda0afcull, 7},
+    {0xf1d8a3186312df00ull, 6},
+    {0xf1e9aeb407c4a781ull, 6},
+    {0xf1ee058c90a6be53ull, 9},
+    {0xf1fe24c5bc36fc92ull, 7},
+    {0xf201cc5f426a4b77ull, 10},
+    {0xf215e0b2a1374564ull, 11},
+    {0xf219acb0b5580c2dull, 7},
+    {0xf228bf9a7d742581ull, 7},
+    {0xf246e0efa477db19ull, 7},
+    {0xf24c2c29f5d27651ull, 7},
+    {0xf25a342e23811355ull, 7},
+    {0xf25f5d1595457d8dull, 9},
+    {0xf26694d586d15cdcull, 2},
+    {0xf26808e127d3476aull, 11},
+    {0xf269dc19298bc769ull, 11},
+    {0xf26d880b2061c915ull, 5},
+    {0xf2828b527cede93eull, 7},
+    {0xf2845b05252b13b0ull, 0},
+    {0xf285ba7e529b9e1full, 11},
+    {0xf28eec6fbb953b37ull, 6},
+    {0xf2a3c9b91391e7dcull, 7},
+    {0xf2ada1e0994102faull, 6},
+    {0xf2ae8b2b1c81f81eull, 9},
+    {0xf2b21bb146ed7bf9ull, 9},
+    {0xf2bef17fce4015acull, 9},
+    {0xf2c0a26c73de82f0ull, 6},
+    {0xf2c6eea8dd1c35d7ull, 8},
+    {0xf2cf0ee558849818ull, 6},
+    {0xf2e0b4c9e4f881ffull, 8},
+    {0xf2f893d0d1605a18ull, 7},
+    {0xf2feace9ff09d256ull, 10},
+    {0xf3024272b4f9a37bull, 8},
+    {0xf3048f8b441b19b9ull, 0},
+    {0xf30865530c1f69faull, 6},
+    {0xf334b23f99e79863ull, 11},
+    {0xf343b84f88d77c44ull, 9},
+    {0xf344914b3e4c3dcfull, 3},
+    {0xf34b941e99dc72a9ull, 11},
+    {0xf351673cbff24d40ull, 6},
+    {0xf366fc0f959b809full, 8},
+    {0xf367cf8270dd3458ull, 10},
+    {0xf36e6d99cd79eca3ull, 6},
+    {0xf375a591e7f18e9bull, 9},
+    {0xf3801c48ce27335cull, 6},
+    {0xf381fe73e617b593ull, 9},
+    {0xf38eb3d099415a2bull, 9},
+    {0xf3a1dc9d260b02d3ull, 4},
+    {0xf3afeb7e7ed610a6ull, 6},
+    {0xf3b26aabe836520aull, 11},
+    {0xf3d6d7837d4c8c38ull, 6},
+    {0xf3e011a4dff06c88ull, 7},
+    {0xf3e2ba7988895b8full, 1},
+    {0xf3e442a2f93a64c2ull, 7},
+    {0xf3e6a2598c4bc509ull, 2},
+    {0xf3ec9c02441460b2ull, 0},
+    {0xf3f54b1908e2057eull, 7},
+    {0xf3f6ccec79268c9eull, 8},
+    {0xf435d3a6cea3cff2ull, 6},
+    {0xf4387fa316c30260ull, 6},
+    {0xf43e3545e1a572aeull, 6},
+    {0xf44f0429159ce27bull, 7},
+    {0xf455b65e64bd5702ull, 10},
+    {0xf45a10ba9b2335baull, 1},
+    {0xf45bdbde599e927cull, 6},
+    {0xf461b9dc72c28a0full, 9},
+    {0xf47d810656e33602ull, 6},
+    {0xf483164fa823c13cull, 6},
+    {0xf486472fa847b7f4ull, 6},
+    {0xf48aee20f67a3b39ull, 9},
+    {0xf48ff5120c8aea11ull, 10},
+    {0xf496caf468a25cb7ull, 7},
+    {0xf4984dc6a08cbf33ull, 7},
+    {0xf49d42732b715ad4ull, 7},
+    {0xf4a0bd0783262228ull, 9},
+    {0xf4a294cb3143868full, 10},
+    {0xf4a56792d0f59339ull, 7},
+    {0xf4a905d3a38999feull, 11},
+    {0xf4ae89219eca8254ull, 10},
+    {0xf4af629a2bb3d9aaull, 6},
+    {0xf4c58587b0b801c0ull, 6},
+    {0xf4c5ea92fcd22d3eull, 1},
+    {0xf4c861771b830a92ull, 11},
+    {0xf4d95277567627beull, 0},
+    {0xf4de2b97da620cd7ull, 7},
+    {0xf4e1a6f22aa3cadfull, 2},
+    {0xf4e20f9f802f442full, 1},
+    {0xf4e322255a84dba2ull, 6},
+    {0xf4eab07fa9c9bd7aull, 7},
+    {0xf4fb56aac452f551ull, 1},
+    {0xf4fe4bf0db965363ull, 0},
+    {0xf4ffac70166af281ull, 1},
+    {0xf505b10a04c8afa9ull, 7},
+    {0xf508b1ba28ae59d2ull, 1},
+    {0xf508e15eb19c6b84ull, 6},
+    {0xf5178677847fba46ull, 6},
+    {0xf53df7580ec07ca7ull, 11},
+    {0xf53fd0007a384b56ull, 8},
+    {0xf545d42dbca49c0full, 6},
+    {0xf5533a3720d0bfc1ull, 8},
+    {0xf5581fb5eae97033ull, 10},
+    {0xf55a72b52b0f2ee2ull, 0},
+    {0xf55cea8731b0abceull, 7},
+    {0xf55d293cb5c8b71dull, 1},
+    {0xf55f33b98c90c017ull, 8},
+    {0xf561afe4e94ab2caull, 11},
+    {0xf5670d44e43966e6ull, 0},
+    {0xf568c88fdda6d13bull, 10},
+    {0xf56e2430fa610162ull, 10},
+    {0xf57606084f4e6e76ull, 11},
+    {0xf5795a25d5cd6ed9ull, 9},
+    {0xf587122f45a972feull, 11},
+    {0xf591b9f4fcd3df1cull, 10},
+    {0xf598226d11f02d7eull, 10},
+    {0xf59ad6bc8887e556ull, 10},
+    {0xf59b514637bc379aull, 8},
+    {0xf59c0447d1046fe7ull, 7},
+    {0xf5cb2a72feb2ccffull, 9},
+    {0xf5ce669ea70236adull, 6},
+    {0xf5e65fb3def6aac5ull, 9},
+    {0xf5e7aeebab2f484bull, 8},
+    {0xf5f4870ad05c8b3eull, 6},
+    {0xf60dcc287a0fc531ull, 9},
+    {0xf61167d9855ce77eull, 7},
+    {0xf625ed6eabd54a9full, 9},
+    {0xf627ac3a8f121429ull, 8},
+    {0xf6349a7b076637c2ull, 6},
+    {0xf6390b23a1f65a3aull, 7},
+    {0xf63bd4f2dc029016ull, 6},
+    {0xf65411f667554877ull, 9},
+    {0xf6643f0f7976ff7eull, 11},
+    {0xf669a7c11db88c90ull, 7},
+    {0xf66f8cb737505292ull, 9},
+    {0xf68a9c308bf01937ull, 7},
+    {0xf6a5739f921db9d9ull, 10},
+    {0xf6ac09a6f1a12856ull, 7},
+    {0xf6acc493c1687941ull, 6},
+    {0xf6b23d1c42d64761ull, 11},
+    {0xf6b92ce08f7773d0ull, 0},
+    {0xf6bfb0ecb7036aa1ull, 7},
+    {0xf6bfbc7f51706717ull, 9},
+    {0xf6cbcde20b5fc151ull, 6},
+    {0xf6cc9c0f4b8f3ba7ull, 8},
+    {0xf6d2e243525ad827ull, 8},
+    {0xf6d3ff9c34286813ull, 1},
+    {0xf6da22ec5a06e74bull, 6},
+    {0xf6db03c37a69c07cull, 9},
+    {0xf6e23b281fa63ffdull, 9},
+    {0xf700d17bc9596839ull, 9},
+    {0xf7049a413509d82full, 2},
+    {0xf70a99c856ecbe00ull, 6},
+    {0xf7152fd1dd0021e7ull, 9},
+    {0xf723d332807d7a8aull, 7},
+    {0xf725aaba65a5c861ull, 11},
+    {0xf7265eba69f0a6ffull, 7},
+    {0xf73ce2fb5a857c18ull, 3},
+    {0xf74145ab6161641aull, 6},
+    {0xf741c348cf6d5b34ull, 8},
+    {0xf75575fc120cf223ull, 8},
+    {0xf7640a79390423b5ull, 1},
+    {0xf76912e6d2fe22a1ull, 6},
+    {0xf76add0ed9e9a93bull, 7},
+    {0xf76e23c0b840a601ull, 10},
+    {0xf7724878b76bfee0ull, 7},
+    {0xf77bb7817d801009ull, 9},
+    {0xf787a1bf9d64095bull, 7},
+    {0xf78c2e10c0a7931eull, 11},
+    {0xf7951a25c610bb66ull, 6},
+    {0xf797b17938849872ull, 7},
+    {0xf7b0ecb3ebc0559eull, 11},
+    {0xf7b561b5e42a76a9ull, 8},
+    {0xf7cffb55f7c905f3ull, 11},
+    {0xf7d145fc55ad3808ull, 7},
+    {0xf7dd93de0c4b3216ull, 9},
+    {0xf7de45ab081e62aaull, 0},
+    {0xf7e19c1538511b20ull, 8},
+    {0xf7ed37ff25d52070ull, 11},
+    {0xf7edee7d05d59ae4ull, 2},
+    {0xf7fc3eb24489a3a0ull, 7},
+    {0xf807c86ad1681558ull, 9},
+    {0xf8121f523a072c3dull, 9},
+    {0xf836a4d418fa5affull, 1},
+    {0xf8499dd60346e345ull, 6},
+    {0xf8518b02cc661848ull, 8},
+    {0xf8584178ce8f6ba4ull, 7},
+    {0xf86aa8f516b7047full, 0},
+    {0xf86bd6f2735806f1ull, 7},
+    {0xf86d8e57914ea6f1ull, 10},
+    {0xf87262d6c3f40d4cull, 11},
+    {0xf87f5dbf8c0a7477ull, 9},
+    {0xf8900213710a3933ull, 1},
+    {0xf8a4e191807386a5ull, 8},
+    {0xf8ada190b6fcfd72ull, 7},
+    {0xf8b7101dcdd0a76eull, 9},
+    {0xf8b74b60c47e9b96ull, 6},
+    {0xf8c541f65fc38587ull, 8},
+    {0xf8cb72184c283910ull, 10},
+    {0xf8ce71c099ae9875ull, 9},
+    {0xf8dda95aa80f2bfbull, 10},
+    {0xf8e1a4c4432e822aull, 7},
+    {0xf8e26230df257903ull, 8},
+    {0xf8e415c667acc172ull, 11},
+    {0xf8e48f103af4e53cull, 6},
+    {0xf8f910d0eae36151ull, 10},
+    {0xf90b7cfce87bdf29ull, 6},
+    {0xf9148c0ac2466dcbull, 6},
+    {0xf91f1dec8f161ac5ull, 10},
+    {0xf92c55c91489181aull, 11},
+    {0xf93533d312167315ull, 6},
+    {0xf93db24d19b69900ull, 1},
+    {0xf945898b31603eddull, 7},
+    {0xf94c6cc6461966f5ull, 9},
+    {0xf957b083f2569ac0ull, 11},
+    {0xf973e30eb13ce82full, 2},
+    {0xf97519b6555306bcull, 10},
+    {0xf98f88b674dbedd6ull, 10},
+    {0xf9936a8b1e6b3e31ull, 6},
+    {0xf9a5ad2e80d11745ull, 10},
+    {0xf9b385811ed097c3ull, 7},
+    {0xf9bf21b488ee146bull, 6},
+    {0xf9c79a199b0dda58ull, 10},
+    {0xf9cf1d9980d9bf99ull, 10},
+    {0xf9d94fa85004511bull, 8},
+    {0xf9e723611f876321ull, 10},
+    {0xf9e82a4a46aa0ca2ull, 9},
+    {0xf9f26fb5fd74e60full, 8},
+    {0xf9fe4825091b6020ull, 8},
+    {0xfa04f95f77490460ull, 8},
+    {0xfa2f89d443088f1dull, 7},
+    {0xfa3274f09c764f06ull, 8},
+    {0xfa3e10df7ddda1f5ull, 11},
+    {0xfa4f982383d39387ull, 6},
+    {0xfa51b7a5f4786b21ull, 7},
+    {0xfa5bcd4752fa2a7cull, 8},
+    {0xfa5d77f4eb07a918ull, 6},
+    {0xfa65fe92c70674d3ull, 6},
+    {0xfa7a5a88fae76196ull, 7},
+    {0xfa7c647a05ef6e1dull, 1},
+    {0xfa7da021ccd7aa48ull, 5},
+    {0xfa895ebcba53a1dcull, 6},
+    {0xfa8bf7035dc6a507ull, 6},
+    {0xfa8f63033630ffa6ull, 11},
+    {0xfa910d0d2d26450aull, 6},
+    {0xfa91e0e86fd01fb1ull, 11},
+    {0xfa9b13ed1749e35bull, 7},
+    {0xfa9c23911dc164c0ull, 6},
+    {0xfab7580406a68717ull, 6},
+    {0xfab7af3bd2339fe3ull, 6},
+    {0xfab93ce2680e13b8ull, 11},
+    {0xfae0a5b1b54f3792ull, 6},
+    {0xfae410231d745afdull, 7},
+    {0xfafe1c05dc28b8d9ull, 5},
+    {0xfb02c35febb3b766ull, 7},
+    {0xfb04bab334382552ull, 11},
+    {0xfb25c68ff79ab24cull, 9},
+    {0xfb2b2789faa68452ull, 8},
+    {0xfb2dbb63006b6c20ull, 11},
+    {0xfb3ac4c9309fdcd4ull, 7},
+    {0xfb3c58da385bb9bfull, 9},
+    {0xfb6970288f77f8ddull, 0},
+    {0xfb6dadf0a5ee6e08ull, 9},
+    {0xfb7544ffd0a5484dull, 8},
+    {0xfb7a1ba5ff83e064ull, 6},
+    {0xfb7c94136047a973ull, 7},
+    {0xfb7d35b430573c0full, 10},
+    {0xfb7de11a3f2a9054ull, 11},
+    {0xfb8347121efd1b0dull, 6},
+    {0xfb886e19bf06e7e2ull, 7},
+    {0xfbb1d7fbf0012e6full, 8},
+    {0xfbb40f41f5145174ull, 0},
+    {0xfbd2d4983ea1fc60ull, 7},
+    {0xfbe4322d0c64ba62ull, 7},
+    {0xfbf3b7858622f778ull, 1},
+    {0xfc0b380c8aeac1b0ull, 7},
+    {0xfc1aea04df965d95ull, 11},
+    {0xfc2e6d653e96e029ull, 8},
+    {0xfc32a57bb0511d63ull, 7},
+    {0xfc3915ad11682b40ull, 6},
+    {0xfc40b171984f6296ull, 8},
+    {0xfc434f5954def8e6ull, 10},
+    {0xfc485c580ac55e01ull, 6},
+    {0xfc4c67939f8609eeull, 2},
+    {0xfc53b35ec911ce64ull, 10},
+    {0xfc6cacbfda848abcull, 10},
+    {0xfc8b1cac639a8e74ull, 6},
+    {0xfc9d6a2a863a593aull, 8},
+    {0xfcb7161d584b23caull, 10},
+    {0xfcb804a518d3bc62ull, 6},
+    {0xfcbff76636781f87ull, 10},
+    {0xfcc2dd2a7509a0bdull, 10},
+    {0xfccf2b7fc4fc4b43ull, 6},
+    {0xfcd011432fb57cf1ull, 10},
+    {0xfcdf9263bfab06aaull, 0},
+    {0xfce5362bd4f6d16full, 8},
+    {0xfce67ea85942c7c4ull, 9},
+    {0xfcfc198a8df3c819ull, 11},
+    {0xfd01ad8df16e13abull, 6},
+    {0xfd0451a55af3227cull, 7},
+    {0xfd0758abe71e048full, 8},
+    {0xfd0e665aff74b8cfull, 10},
+    {0xfd0ef2e470a0c788ull, 6},
+    {0xfd1a77335dfe1f8bull, 10},
+    {0xfd26fef0f4739ed6ull, 8},
+    {0xfd31ab19c63a9efaull, 8},
+    {0xfd39b449b4cecb1dull, 11},
+    {0xfd3ac79415398f4eull, 7},
+    {0xfd43b4de980a0160ull, 9},
+    {0xfd50e3fc85d55890ull, 0},
+    {0xfd63f31b5c3162d5ull, 10},
+    {0xfd6e097ce6ae1731ull, 8},
+    {0xfd6f3b9e8e80b01full, 8},
+    {0xfd7008a0a48624dfull, 3},
+    {0xfd72e35ae46e9089ull, 3},
+    {0xfd811985828e938cull, 9},
+    {0xfd82d6f36d448843ull, 7},
+    {0xfd88f75e74a98019ull, 1},
+    {0xfd98bc01c394f7a5ull, 9},
+    {0xfda295cf1810c345ull, 5},
+    {0xfdae1eb9650621f7ull, 5},
+    {0xfdb1878b90d2e0c8ull, 6},
+    {0xfdc5a9840acf4926ull, 6},
+    {0xfdcec8815144a35full, 7},
+    {0xfdd19d68a6242626ull, 11},
+    {0xfddaf61edaf21818ull, 7},
+    {0xfde551b09e43dfe2ull, 9},
+    {0xfde6fe3471d69a8aull, 11},
+    {0xfdeb0e5b7c4365f7ull, 9},
+    {0xfdfbb94de523cb26ull, 8},
+    {0xfdffc0ae19831fd6ull, 8},
+    {0xfe07ba768df75865ull, 6},
+    {0xfe0b8922d41a523cull, 6},
+    {0xfe120d8d71de4957ull, 6},
+    {0xfe267ae4bef8d853ull, 6},
+    {0xfe322627017d8d6cull, 7},
+    {0xfe44b7cb9ac3c26bull, 7},
+    {0xfe508b4929603273ull, 6},
+    {0xfe5136cb1de7b2adull, 4},
+    {0xfe56da694b4b79d8ull, 9},
+    {0xfe5e0dc1cdd02332ull, 1},
+    {0xfe641c3fc3a7049full, 8},
+    {0xfe6b72e88f5856a1ull, 3},
+    {0xfe70ab31abf436baull, 7},
+    {0xfe764846df1105aeull, 6},
+    {0xfe86df3b9805170dull, 4},
+    {0xfe926839de143162ull, 11},
+    {0xfe942949d6cb792full, 10},
+    {0xfe9e38a3b99999e8ull, 8},
+    {0xfea3c59596f55807ull, 7},
+    {0xfea4fbdd68803f94ull, 8},
+    {0xfeacd490a9fa7b10ull, 11},
+    {0xfebdafb2cb634fb9ull, 9},
+    {0xfeceea0e2de92758ull, 6},
+    {0xfed3a9858436dc3aull, 7},
+    {0xfee07377d90a8907ull, 9},
+    {0xfee73a4a4dade226ull, 0},
+    {0xfeefafff403883caull, 7},
+    {0xff03541544550cb9ull, 6},
+    {0xff0c8dc6d89eb4cdull, 8},
+    {0xff27255366d3658cull, 7},
+    {0xff2aad9ffd198c33ull, 11},
+    {0xff2e29e1aa93b358ull, 7},
+    {0xff314edbde3a4620ull, 6},
+    {0xff40f40b3ba2aa70ull, 11},
+    {0xff4450b609573c11ull, 6},
+    {0xff4962b7e728e818ull, 7},
+    {0xff4be2fd617fde0eull, 2},
+    {0xff4ff41927f856e1ull, 6},
+    {0xff6e5f33b0b95165ull, 6},
+    {0xff757037ce565722ull, 6},
+    {0xff7f0826977d04d5ull, 8},
+    {0xffa4874e8077d719ull, 10},
+    {0xffbb03dc3703fdfdull, 8},
+    {0xffc6585cb279f4e2ull, 3},
+    {0xffd6e5f8637a654cull, 6},
+    {0xffd740e7b1945d32ull, 7},
+    {0xffe1bc26f9da62e7ull, 7},
+    {0xffe5fc3fe1ad408cull, 7},
+    {0xffe98adca299d265ull, 7},
+    {0xffed890fcab00db8ull, 7},
+    {0xfff5ef1e243839abull, 10},
+};
+
+#endif //AWALEGAME_BOOK_DATA_H
@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "game.h"
+#include "engine.h"
+
+#define DEFAULT_BOOK_PLIES 6
+#define DEFAULT_BOOK_DEPTH 12
+#define DEFAULT_BOOK_OUTPUT "src/book_data.h"
+#define BOOK_TT_MB 32
+#define BOOK_MAX_THREADS 256
+
+// A position of the opening tree and the move found for it
+typedef struct {
+    uint64_t hash;
+    Game game;
+    int move;
+    int score;
+} BookPosition;
+
+// Shared state of the builder, threads take positions one at a time
+typedef struct {
+    BookPosition* positions;
+    size_t count;
+    int depth;
+    _Atomic size_t next;
+    _Atomic size_t done;
+} Builder;
+
+int compare_positions(const void* a, const void* b) {
+    uint64_t x = ((const BookPosition*) a)->hash, y = ((const BookPosition*) b)->hash;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * @brief Lists every distinct position reachable from init_game in fewer than plies plies.
+ *
+ * @param plies Depth of the opening tree.
+ * @param count Set to the number of positions.
+ *
+ * @return BookPosition* The positions sorted by hash (to be freed), or NULL if allocation failed.
+ */
+BookPosition* collect_positions(int plies, size_t* count) {
+    size_t capacity = 1024;
+    BookPosition* positions = malloc(sizeof(BookPosition) * capacity);
+    if (!positions) {
+        return NULL;
+    }
+
+    init_game(&positions[0].game, "book0", "book1");
+    positions[0].hash = hash_game(&positions[0].game);
+    *count = 1;
+
+    // One layer per ply, duplicates (transpositions) are removed before expanding the next layer
+    size_t layer_start = 0;
+    for (int ply = 1; ply < plies; ply++) {
+        size_t layer_end = *count;
+        for (size_t i = layer_start; i < layer_end; i++) {
+            int moves[6];
+            int move_count = list_moves(&positions[i].game, moves);
+            for (int m = 0; m < move_count; m++) {
+                if (*count == capacity) {
+                    capacity *= 2;
+                    BookPosition* grown = realloc(positions, sizeof(BookPosition) * capacity);
+                    if (!grown) {
+                        free(positions);
+                        return NULL;
+                    }
+                    positions = grown;
+                }
+
+                BookPosition* child = &positions[*count];
+                child->game = positions[i].game;
+                if (play_turn(&child->game, moves[m])) {
+                    continue;  // Finished games need no book move
+                }
+                child->hash = hash_game(&child->game);
+                (*count)++;
+            }
+        }
+
+        qsort(positions + layer_end, *count - layer_end, sizeof(BookPosition), compare_positions);
+        size_t unique = layer_end;
+        for (size_t i = layer_end; i < *count; i++) {
+            if (unique == layer_end || positions[i].hash != positions[unique - 1].hash) {
+                positions[unique++] = positions[i];
+            }
+        }
+        layer_start = layer_end;
+        *count = unique;
+    }
+
+    // A position can appear at two different plies, keep the first
+    qsort(positions, *count, sizeof(BookPosition), compare_positions);
+    size_t unique = 0;
+    for (size_t i = 0; i < *count; i++) {
+        if (unique == 0 || positions[i].hash != positions[unique - 1].hash) {
+            positions[unique++] = positions[i];
+        }
+    }
+    *count = unique;
+    return positions;
+}
+
+void* builder_main(void* arg) {
+    Builder* builder = arg;
+
+    TransTable tt;
+    if (tt_init(&tt, BOOK_TT_MB, false)) {
+        return NULL;
+    }
+
+    size_t index;
+    while ((index = atomic_fetch_add(&builder->next, 1)) < builder->count) {
+        BookPosition* position = &builder->positions[index];
+        SearchLimits limits = {.depth = builder->depth, .time_ms = 0, .nodes = 0, .history = NULL};
+        SearchResult result;
+        if (engine_search(&position->game, &limits, &tt, &result)) {
+            position->move = -1;
+        } else {
+            position->move = result.move;
+            position->score = result.score;
+        }
+
+        size_t done = atomic_fetch_add(&builder->done, 1) + 1;
+        if (done % 1000 == 0) {
+            fprintf(stderr, "%zu / %zu\n", done, builder->count);
+        }
+    }
+
+    tt_free(&tt);
+    return NULL;
+}
+
+/**
+ * @brief Writes the book as a C header, sorted by hash for book_probe's binary search.
+ *
+ * @return int Returns 0 on success, or -1 if the file could not be written.
+ */
+int write_book(const char* filename, const BookPosition* positions, size_t count, int plies, int depth) {
+    FILE* file = fopen(filename, "w");
+    if (!file) {
+        fprintf(stderr, "Error: Could not open %s for writing\n", filename);
+        return -1;
+    }
+
+    size_t entries = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (positions[i].move >= 0) entries++;
+    }
+
+    fprintf(file, "//\n");
+    fprintf(file, "// Opening book generated by awale_book %d %d, do not edit.\n", plies, depth);
+    fprintf(file, "// Best move of every position reachable in fewer than %d plies, searched to depth %d\n", plies, depth);
+    fprintf(file, "//\n\n");
+    fprintf(file, "#ifndef AWALEGAME_BOOK_DATA_H\n#define AWALEGAME_BOOK_DATA_H\n\n");
+    fprintf(file, "#define OPENING_BOOK_PLIES %d\n", plies);
+    fprintf(file, "#define OPENING_BOOK_DEPTH %d\n", depth);
+    fprintf(file, "#define OPENING_BOOK_SIZE %zu\n\n", entries);
+    fprintf(file, "// Sorted by hash_game\n");
+    fprintf(file, "const BookEntry OPENING_BOOK[OPENING_BOOK_SIZE] = {\n");
+    for (size_t i = 0; i < count; i++) {
+        if (positions[i].move >= 0) {
+            fprintf(file, "    {0x%016llxull, %d},\n", (unsigned long long) positions[i].hash, positions[i].move);
+        }
+    }
+    fprintf(file, "};\n\n#endif //AWALEGAME_BOOK_DATA_H\n");
+
+    if (fclose(file) != 0) {
+        fprintf(stderr, "Error: Could not write %s\n", filename);
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int plies = argc > 1 ? atoi(argv[1]) : DEFAULT_BOOK_PLIES;
+    int depth = argc > 2 ? atoi(argv[2]) : DEFAULT_BOOK_DEPTH;
+    const char* output = argc > 3 ? argv[3] : DEFAULT_BOOK_OUTPUT;
+    long threads = argc > 4 ? atol(argv[4]) : sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (plies < 1 || depth < 1 || depth >= ENGINE_MAX_PLY) {
+        printf("Usage: awale_book [plies] [depth] [output] [threads]\n");
+        exit(0);
+    }
+    if (threads < 1) threads = 1;
+    if (threads > BOOK_MAX_THREADS) threads = BOOK_MAX_THREADS;
+
+    init_engine();
+
+    Builder builder;
+    builder.positions = collect_positions(plies, &builder.count);
+    if (!builder.positions) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    builder.depth = depth;
+    atomic_init(&builder.next, 0);
+    atomic_init(&builder.done, 0);
+    printf("%zu positions in the first %d plies, searching to depth %d on %ld threads\n",
+           builder.count, plies, depth, threads);
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pthread_t workers[BOOK_MAX_THREADS];
+    int started = 0;
+    for (; started < threads; started++) {
+        if (pthread_create(&workers[started], NULL, builder_main, &builder)) {
+            break;
+        }
+    }
+    for (int i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    if (started == 0 || atomic_load(&builder.done) < builder.count) {
+        fprintf(stderr, "Error: Search threads failed\n");
+        free(builder.positions);
+        return 1;
+    }
+
+    int result = write_book(output, builder.positions, builder.count, plies, depth);
+    if (result == 0) {
+        printf("Wrote %s in %.1f s\n", output, elapsed_ms(&start) / 1000.0);
+    }
+    free(builder.positions);
+    return result ? 1 : 0;
+}
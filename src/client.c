@@ -14,10 +14,11 @@
 #define SERVER_IP "127.0.0.1"
 
 int main(int argc, char** argv) {
-    if (argc != 3) {
-        printf("Usage: socket_client server port\n");
+    if (argc != 3 && argc != 4) {
+        printf("Usage: socket_client server port [json|binary]\n");
         exit(0);
     }
+    bool binary = argc < 4 || strcmp(argv[3], "json") != 0;  // Binary unless asked otherwise
 
     // Initialise parameters
     struct sockaddr_in serv_addr;
@@ -49,7 +50,10 @@ int main(int argc, char** argv) {
         exit(EXIT_FAILURE);
     }
 
+    set_no_delay(server_socket);
     printf("Connected to server at %s:%d\n", SERVER_IP, PORT_NO);
+    Connection server;
+    connection_init(&server, server_socket);
 
     printf("Welcome to:\n");
     printf("░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░░\n░░      ░░░  ░░░░  ░░░      ░░░  ░░░░░░░░        ░\n▒  ▒▒▒▒  ▒▒  ▒  ▒  ▒▒  ▒▒▒▒  ▒▒  ▒▒▒▒▒▒▒▒  ▒▒▒▒▒▒▒\n▓  ▓▓▓▓  ▓▓        ▓▓  ▓▓▓▓  ▓▓  ▓▓▓▓▓▓▓▓      ▓▓▓\n█        ██   ██   ██        ██  ████████  ███████\n█  ████  ██  ████  ██  ████  ██        ██        █\n██████████████████████████████████████████████████\n");
@@ -83,7 +87,7 @@ int main(int argc, char** argv) {
 
             printf("Username accepted: %s\n", username);
             // Attempt log in
-            if (login(server_socket, username)) {
+            if (login(&server, username, binary)) {
                 fprintf(stderr, "Error: Could not log in\n");
                 continue;
             }
@@ -119,26 +123,27 @@ int main(int argc, char** argv) {
         }
 
         if (strcmp(input, "list") == 0) {
-            list(server_socket, username);
+            list(&server, username);
             continue;
         }
 
         if (strcmp(input, "challenge") == 0) {
-            challenge(server_socket, username);
+            challenge(&server, username);
             continue;
         }
 
         if (strcmp(input, "respond") == 0) {
-            respond(server_socket, username);
+            respond(&server, username);
             continue;
         }
 
         if (strcmp(input, "play") == 0) {
-            play(server_socket, username);
+            play(&server, username);
             continue;
         }
 
         if (strcmp(input, "quit") == 0) {
+            connection_free(&server);
             close(server_socket);
             printf("Logged out\n");
             break;
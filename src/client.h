@@ -57,8 +57,56 @@ char** convert_name_string_to_list(const char* jsonString, int* item_count) {
     return output;
 }
 
+// Read a list of names sent in response to a request, in either protocol. Returned value needs to be freed
+char** receive_names(Connection* server, uint32_t id, int* item_count) {
+    *item_count = 0;
+
+    size_t length;
+    char* res = receive_response(server, id, &length);
+    if (res == NULL) {
+        return NULL;
+    }
+    if (server->protocol == PROTOCOL_JSON) {
+        char** output = convert_name_string_to_list(res, item_count);
+        free(res);
+        return output;
+    }
+
+    BinaryReader reader;
+    reader_init(&reader, res, length);
+    uint64_t count = read_byte(&reader) == BINARY_NAMES ? read_varint(&reader) : 0;
+    if (reader.error || count > length) {  // Every name takes at least a byte
+        fprintf(stderr, "Error: Invalid list received\n");
+        free(res);
+        return NULL;
+    }
+
+    char** output = (char**) malloc((count ? count : 1) * sizeof(char*));
+    if (!output) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        free(res);
+        return NULL;
+    }
+    for (uint64_t i = 0; i < count; i++) {
+        char name[MAX_NAME_LENGTH + 1];
+        if (read_string(&reader, name, sizeof(name)) || !(output[*item_count] = strdup(name))) {
+            fprintf(stderr, "Error: Invalid list received\n");
+            for (int j = 0; j < *item_count; j++) {
+                free(output[j]);
+            }
+            free(output);
+            free(res);
+            *item_count = 0;
+            return NULL;
+        }
+        (*item_count)++;
+    }
+    free(res);
+    return output;
+}
+
 // Perform request to get list of active users (with respect to a user)
-char** get_active_users(int server, char* username, int* no_users) {
+char** get_active_users(Connection* server, char* username, int* no_users) {
     Request req = empty_request();
     req.action = LIST;
     strcpy(req.arguments[0], username);
@@ -68,25 +116,22 @@ char** get_active_users(int server, char* username, int* no_users) {
         return NULL;
     }
 
-    char* res = read_response(server);
-    if (res == NULL) {
+    char** res1 = receive_names(server, req.id, no_users);
+    if (res1 == NULL) {
         fprintf(stderr, "Error: Could not retrieve list of online users.\n");
         return NULL;
     }
 
-    char** res1 = convert_name_string_to_list(res, no_users);
-    free(res);
-
     if (res1 == NULL) {
         return NULL;
     }
     return res1;
 }
 
-// Perform request to get a list of a user's current games
-char** get_current_games(int server, char* username, int* no_users) {
+// Perform request to get all of a user's games in one response. Returned value needs to be freed
+Game* get_current_games(Connection* server, char* username, int* no_games) {
     Request req = empty_request();
-    req.action = LIST_GAMES;
+    req.action = GAMES_BATCH;
     strcpy(req.arguments[0], username);
 
     if (send_request(server, &req)) {
@@ -94,36 +139,168 @@ char** get_current_games(int server, char* username, int* no_users) {
         return NULL;
     }
 
-    char* res = read_response(server);
-    if (res == NULL) {
+    Game* games = receive_games(server, req.id, no_games);
+    if (games == NULL) {
         fprintf(stderr, "Error: Could not retrieve list of user's games.\n");
         return NULL;
     }
+    return games;
+}
 
-    char** res1 = convert_name_string_to_list(res, no_users);
+
+/**
+ * @brief Asks the server for the engine's evaluation of the current position and prints it.
+ *
+ * @param server The connection to the server.
+ * @param username The username of the current player.
+ * @param chosen_user The username of the opponent.
+ *
+ * @return int Returns 0 on success, or -1 if an error occurs.
+ */
+int hint(Connection* server, char* username, char* chosen_user) {
+    Request req = empty_request();
+    req.action = ANALYZE;
+    strcpy(req.arguments[0], username);
+    strcpy(req.arguments[1], chosen_user);
+
+    if (send_request(server, &req)) {
+        fprintf(stderr, "Error: Could not send request.\n");
+        return -1;
+    }
+
+    size_t length;
+    char* res = receive_response(server, req.id, &length);
+    if (res == NULL) {
+        fprintf(stderr, "Error: Could not read response from analyze request.\n");
+        return -1;
+    }
+
+    if (server->protocol == PROTOCOL_BINARY) {
+        BinaryReader reader;
+        reader_init(&reader, res, length);
+        if (read_byte(&reader) != BINARY_ANALYSIS) {
+            printf("No analysis available.\n");
+            free(res);
+            return -1;
+        }
+        int move = (int) read_varint(&reader);
+        int score = (int) read_signed(&reader);
+        int depth = (int) read_varint(&reader);
+        read_varint(&reader);  // Nodes
+        read_byte(&reader);    // Cached
+        uint64_t pv_length = read_varint(&reader);
+        printf("Engine suggests %d (score %d, depth %d), line:", move, score, depth);
+        for (uint64_t i = 0; i < pv_length && !reader.error; i++) {
+            printf(" %d", (int) read_varint(&reader));
+        }
+        printf("\n");
+        free(res);
+        return reader.error ? -1 : 0;
+    }
+
+    cJSON* json = cJSON_Parse(res);
     free(res);
+    cJSON* move = cJSON_GetObjectItem(json, "move");
+    if (!cJSON_IsNumber(move)) {
+        printf("No analysis available.\n");
+        cJSON_Delete(json);
+        return -1;
+    }
 
-    if (res1 == NULL) {
-        return NULL;
+    printf("Engine suggests %d (score %d, depth %d), line:", move->valueint,
+           cJSON_GetObjectItem(json, "score")->valueint, cJSON_GetObjectItem(json, "depth")->valueint);
+    cJSON* pv_item;
+    cJSON_ArrayForEach(pv_item, cJSON_GetObjectItem(json, "pv")) {
+        printf(" %d", pv_item->valueint);
+    }
+    printf("\n");
+
+    cJSON_Delete(json);
+    return 0;
+}
+
+
+// Describe the state of a game from the point of view of one of its players
+const char* game_status(const Game* game, const char* username) {
+    bool is_player0 = strcmp(username, game->player0) == 0;
+    switch (game->current_state) {
+        case MOVE_PLAYER_0: return is_player0 ? "your turn" : "their turn";
+        case MOVE_PLAYER_1: return is_player0 ? "their turn" : "your turn";
+        case WIN_PLAYER_0: return is_player0 ? "won" : "lost";
+        case WIN_PLAYER_1: return is_player0 ? "lost" : "won";
+        case DRAW: return "draw";
+        default: return "unknown";
+    }
+}
+
+
+// Name of the other player of a game
+const char* opponent_of(const Game* game, const char* username) {
+    return strcmp(username, game->player0) == 0 ? game->player1 : game->player0;
+}
+
+
+/**
+ * @brief Lists the user's games with their state.
+ *
+ * @param username The username of the current user.
+ * @param games The games of the user, as received from GAMES_BATCH.
+ * @param count The number of games.
+ */
+void print_games(char* username, const Game* games, int count) {
+    for (int i = 0; i < count; i++) {
+        const Game* game = &games[i];
+        printf("%d. Me <--> %s (%s, %d - %d)\n", i + 1, opponent_of(game, username), game_status(game, username),
+               strcmp(username, game->player0) == 0 ? game->score.player0 : game->score.player1,
+               strcmp(username, game->player0) == 0 ? game->score.player1 : game->score.player0);
     }
-    return res1;
+}
+
+
+/**
+ * @brief Receives the changes of a move to the game shown, fetching the whole game again if
+ * the client missed some.
+ *
+ * @param server The connection to the server.
+ * @param id The correlation ID of the request.
+ * @param game The game shown, updated in place.
+ * @param username The username of the current player.
+ * @param chosen_user The username of the opponent.
+ *
+ * @return int Returns 0 on success, or -1 if an error occurs.
+ */
+int receive_move(Connection* server, uint32_t id, Game* game, char* username, char* chosen_user) {
+    int result = receive_game(server, id, game);
+    if (result <= 0) {
+        return result;
+    }
+
+    Request req = empty_request();
+    req.action = GAME;
+    strcpy(req.arguments[0], username);
+    strcpy(req.arguments[1], chosen_user);
+    if (send_request(server, &req)) {
+        fprintf(stderr, "Error: Could not send request.\n");
+        return -1;
+    }
+    return receive_game(server, req.id, game) ? -1 : 0;
 }
 
 
 /**
  * @brief Manages the game loop between the current user and the chosen opponent.
  *
- * @param server The server socket.
+ * @param server The connection to the server.
  * @param username The username of the current player.
  * @param chosen_user The username of the opponent.
  *
  * @return int Returns 0 upon successful completion of the game loop, or -1 if an error occurs.
  *
- * @note The game state is updated in a loop by polling the server every 2 seconds until a change is detected.
- *  This times out after 10 refreshes.
+ * @note While the opponent thinks, the client waits with WAIT_FOR_MOVE, which the server answers
+ *  as soon as they have moved.
  *
  */
-int play_game(int server, char* username, char* chosen_user) {
+int play_game(Connection* server, char* username, char* chosen_user) {
     printf("Resuming game against %s.\n", chosen_user);
 
     // 1. Load current game state
@@ -139,7 +316,7 @@ int play_game(int server, char* username, char* chosen_user) {
     }
 
     Game game;
-    if (receive_game(server, &game)) {
+    if (receive_game(server, req.id, &game)) {
         return -1;
     }
 
@@ -164,33 +341,18 @@ int play_game(int server, char* username, char* chosen_user) {
                    (game.current_state == MOVE_PLAYER_1 && is_player0)) {
             printf("Waiting for other player to move\n");
 
-            // Loop every second to update game state to check for changes
-            GAME_STATE current_state = game.current_state;
-            int retry_count = 0;
-            const int max_retries = 100; // Allow 10 retries
-
-            while (current_state == game.current_state) {
-                if (retry_count++ >= max_retries) {
-                    printf("Timed out waiting for the other player's move.\n");
-                    return -1;
-                }
-
-                // Send request to server
-                Request req1 = empty_request();
-                req1.action = GAME;
-                strcpy(req1.arguments[0], username);
-                strcpy(req1.arguments[1], chosen_user);
-
-                if (send_request(server, &req1)) {
-                    fprintf(stderr, "Error: Could not send request.\n");
-                    return -1;
-                }
-
-                if (receive_game(server, &game)) {
-                    return -1;
-                }
-
-                sleep(2);
+            // The server answers once the game has moved past our version, or after a while without a move
+            req = empty_request();
+            req.action = WAIT_FOR_MOVE;
+            strcpy(req.arguments[0], username);
+            strcpy(req.arguments[1], chosen_user);
+            sprintf(req.arguments[2], "%u", game.version);
+            if (send_request(server, &req)) {
+                fprintf(stderr, "Error: Could not send request.\n");
+                return -1;
+            }
+            if (receive_move(server, req.id, &game, username, chosen_user)) {
+                return -1;
             }
             continue;
         }
@@ -212,11 +374,17 @@ int play_game(int server, char* username, char* chosen_user) {
             break;
         }
 
+        // Position repeated with neither player ahead
+        if (game.current_state == DRAW) {
+            printf("GAME OVER: Draw\n");
+            break;
+        }
+
         // Current player's turn
         if ((game.current_state == MOVE_PLAYER_0 && is_player0) ||
             (game.current_state == MOVE_PLAYER_1 && ! is_player0)) {
             printf("Choose a square (%d-%d) to empty seeds and distribute\n", (is_player0 + 1) % 2 * 6 + 1, (is_player0 + 1) % 2 * 6 + 6);
-            printf("(enter 'back' to go home) (enter 0 to surrender)\n");
+            printf("(enter 'back' to go home) (enter 'hint' for the engine's move) (enter 0 to surrender)\n");
             printf("GAME //: ");
         }
 
@@ -237,6 +405,14 @@ int play_game(int server, char* username, char* chosen_user) {
             break;
         }
 
+        // User wants the engine's advice
+        if (strcmp(input, "hint") == 0) {
+            hint(server, username, chosen_user);
+            printf("Press enter to continue");
+            fgets(input, sizeof(input), stdin);
+            continue;
+        }
+
         printf("Input: %s\n", input);
         // Get move from input
         int slot = convert_and_validate(input, 0, 12);
@@ -260,8 +436,8 @@ int play_game(int server, char* username, char* chosen_user) {
             return -1;
         }
 
-        // Get back false / new board state
-        if (receive_game(server, &game)) {
+        // Get back false / the changes made by the move
+        if (receive_move(server, req.id, &game, username, chosen_user)) {
             return -1;
         }
     }
@@ -273,28 +449,38 @@ int play_game(int server, char* username, char* chosen_user) {
 /**
  * @brief Attempts to log in a user by sending a login request to the server.
  *
- * @param server The server socket.
+ * @param server The connection to the server.
  * @param username The username of the user attempting to log in.
+ * @param binary Ask the server for the binary protocol, the connection switches to it if accepted.
  *
  * @return int Returns 0 if login is successful, or -1 if an error occurs.
  *
- * @note The server is expected to respond with either "true" (successful login) or "false" (login failure).
+ * @note The server is expected to respond with either "true" (successful login), "binary" (successful
+ * login, binary protocol from now on) or "false" (login failure).
  */
-int login(int server, char* username) {
+int login(Connection* server, char* username, bool binary) {
     Request req = empty_request();
     req.action = LOGIN;
     strcpy(req.arguments[0], username);
+    if (binary) {
+        strcpy(req.arguments[1], PROTOCOL_BINARY_NAME);
+    }
 
     if (send_request(server, &req)) {
         fprintf(stderr, "Error: Could not send request to login.\n");
     }
 
-    char* res = read_response(server);
+    char* res = read_response(server, req.id);
     if (res == NULL) {
         fprintf(stderr, "Error: Could not read response from login request.\n");
         return -1;
     }
 
+    if (binary && strcmp(res, PROTOCOL_BINARY_NAME) == 0) {
+        server->protocol = PROTOCOL_BINARY;
+        free(res);
+        return 0;
+    }
     if (strcmp(res, "true") != 0) {
         fprintf(stderr, "Server Error: Could not login.\n");
         free(res);
@@ -309,14 +495,14 @@ int login(int server, char* username) {
 /**
  * @brief Retrieves and displays the list of active users from the server.
  *
- * @param server The server socket.
+ * @param server The connection to the server.
  * @param username The username of the current user.
  *
  * @return int Returns 0 on success, or -1 if an error occurs.
  *
  * @note Memory allocated for the list of active users (array of strings) is dynamically managed and must be freed.
  */
-int list(int server, char* username) {
+int list(Connection* server, char* username) {
     int len_users;
     char** users = get_active_users(server, username, &len_users);
     if (users == NULL) {
@@ -340,12 +526,12 @@ int list(int server, char* username) {
 /**
  * @brief Allows the user to challenge another online player to a game.
  *
- * @param server The server socket.
+ * @param server The connection to the server.
  * @param username The username of the current player initiating the challenge.
  *
  * @return int Returns 0 if the challenge is successfully sent and acknowledged, or -1 if an error occurs.
  */
-int challenge(int server, char* username) {
+int challenge(Connection* server, char* username) {
     // 1. Show online active_users to choose from
     int len_users;
     char** active_users = get_active_users(server, username, &len_users);
@@ -403,29 +589,22 @@ int challenge(int server, char* username) {
     }
 
     // 4. Read response (true or false)
-    char* res = read_response(server);
-    if (res == NULL) {
-        fprintf(stderr, "Error: Could not retrieve list of online active_users.\n");
+    bool challenged;
+    if (receive_bool(server, req.id, &challenged)) {
+        fprintf(stderr, "Error: Could not read response from challenge request.\n");
         return -1;
     }
-    if (strcmp(res, "false") == 0) {
+    if (!challenged) {
         fprintf(stderr, "Error: Could not challenge user.\n");
-        free(res);
         return -1;
     }
-    if (strcmp(res, "true") == 0) {
-        printf("Challenged user: %s\n", chosen_user);
-        free(res);
-        return 0;
-    }
-    fprintf(stderr, "Error: Unexpected response from server: %s\n", res);
-    free(res);
+    printf("Challenged user: %s\n", chosen_user);
     return 0;
 }
 
 
 // TODO: Respond to a challenge request. Return -1 if there is an error
-int respond(int server, char* username) {
+int respond(Connection* server, char* username) {
     fprintf(stderr, "Not yet implemented\n");
     // 1. Display all requests to be either accepted or declined
     // 2. Pick a request from the list (in same way as in Challenge function)
@@ -438,15 +617,15 @@ int respond(int server, char* username) {
 /**
  * @brief Facilitates user interaction to select and play one of their current games.
  *
- * @param server The socket used for communication with the server.
+ * @param server The connection to the server.
  * @param username The username of the current player.
  *
  * @return int Returns 0 upon successful execution, or -1 if an error occurs.
  */
-int play(int server, char* username) {
-    // 1. Display all the user's games
+int play(Connection* server, char* username) {
+    // 1. Display all the user's games, fetched in a single request
     int len_games;
-    char** users_games = get_current_games(server, username, &len_games);
+    Game* users_games = get_current_games(server, username, &len_games);
     if (users_games == NULL) {
         return -1;
     }
@@ -458,9 +637,7 @@ int play(int server, char* username) {
     }
 
     printf("Your current games:\n");
-    for (int i = 0; i < len_games; i++) {
-        printf("%d. Me <--> %s\n", i+1, users_games[i]);
-    }
+    print_games(username, users_games, len_games);
     // 2. Allow user to pick a game from the list
     printf("GAME // Select game number (1-%d): ", len_games);
 
@@ -490,8 +667,8 @@ int play(int server, char* username) {
         break;
     }
 
-    char chosen_user[MAX_NAME_LENGTH];
-    strcpy(chosen_user, users_games[choice - 1]);
+    char chosen_user[MAX_NAME_LENGTH + 1];
+    strcpy(chosen_user, opponent_of(&users_games[choice - 1], username));
     free(users_games);
 
     // 3. play_game()
@@ -0,0 +1,443 @@
+//
+// Alpha-beta search engine built on the game rules of game.h.
+// To be used by bots, analysis and the offline tools
+//
+
+#ifndef AWALEGAME_ENGINE_H
+#define AWALEGAME_ENGINE_H
+
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "game.h"
+#include "zobrist.h"
+#include "transposition.h"
+#include "tablebase.h"
+#include "repetition.h"
+
+#define ENGINE_MAX_PLY 128
+#define SCORE_INFINITE 32000
+#define SCORE_WIN 30000            // Win at the root, minus one per ply to reach it
+#define SCORE_WIN_BOUND (SCORE_WIN - 4096)  // Anything above is a win, tablebase distances included
+#define SCORE_MAX_DISTANCE (SCORE_WIN - SCORE_WIN_BOUND - ENGINE_MAX_PLY)
+#define SCORE_PER_SEED 4           // Weight of a captured seed against a seed on our side
+#define ENGINE_MAX_THREADS 64
+#define SKIP_PATTERNS 20
+#define PATH_SIZE (REPETITION_SIZE + ENGINE_MAX_PLY)
+#define PATH_FILTER_SIZE 1024      // Power of 2
+
+// Depth skipping pattern of helper threads (size and phase), as used by Lazy SMP engines
+const int SKIP_SIZE[SKIP_PATTERNS] = {1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4};
+const int SKIP_PHASE[SKIP_PATTERNS] = {0, 1, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7};
+
+// Limits for a search, 0 means no limit (depth is capped at ENGINE_MAX_PLY - 1)
+typedef struct {
+    int depth;
+    int time_ms;
+    uint64_t nodes;
+    const RepetitionRing* history;  // Positions played before the root, can be NULL
+} SearchLimits;
+
+// Outcome of a search, moves are slots from 0 to 11
+typedef struct {
+    int move;
+    int score;
+    int depth;
+    uint64_t nodes;
+    double elapsed_ms;
+    int pv[ENGINE_MAX_PLY];
+    int pv_length;
+} SearchResult;
+
+// State of one searching thread
+typedef struct {
+    TransTable* tt;  // Can be NULL to search without a table
+    SearchLimits limits;
+    struct timespec start;
+    uint64_t nodes;
+    bool stopped;
+    _Atomic bool* abort;  // Set by the main thread to stop the helpers, can be NULL
+    int pv[ENGINE_MAX_PLY][ENGINE_MAX_PLY];
+    int pv_length[ENGINE_MAX_PLY];
+    // Hashes of the game before the root and of the current line, a repetition ends the game
+    uint64_t path[PATH_SIZE];
+    int path_length;
+    int path_floor;                          // First position since the last capture
+    uint8_t path_filter[PATH_FILTER_SIZE];   // Positions of the path per low bits of their hash
+} SearchContext;
+
+// A thread taking part in a parallel search
+typedef struct {
+    SearchContext ctx;
+    const Game* game;
+    int id;  // 0 for the main thread
+    SearchResult result;
+    pthread_t thread;
+} SearchThread;
+
+// Endgame tablebase probed below the root, NULL if none is loaded
+const Tablebase* engine_tablebase = NULL;
+
+// Must be called once before the first search
+void init_engine() {
+    init_zobrist();
+}
+
+double elapsed_ms(const struct timespec* start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) (now.tv_sec - start->tv_sec) * 1000.0 + (double) (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+bool search_should_stop(const SearchContext* ctx) {
+    if (ctx->abort && atomic_load_explicit(ctx->abort, memory_order_relaxed)) return true;
+    if (ctx->limits.nodes && ctx->nodes >= ctx->limits.nodes) return true;
+    if (ctx->limits.time_ms && elapsed_ms(&ctx->start) >= ctx->limits.time_ms) return true;
+    return false;
+}
+
+// Static evaluation from the point of view of the player to move
+int evaluate(const Game* game) {
+    int own = 0;
+    int other = 0;
+    for (int i = 0; i < 6; i++) {
+        own += game->board[game->current_state * 6 + i];
+        other += game->board[(1 - game->current_state) * 6 + i];
+    }
+
+    int diff = game->score.player0 - game->score.player1;
+    if (game->current_state == MOVE_PLAYER_1) {
+        diff = -diff;
+    }
+    return diff * SCORE_PER_SEED + (own - other);
+}
+
+// Win scores are stored relative to the node so they stay valid when found at another ply
+int score_to_tt(int score, int ply) {
+    if (score >= SCORE_WIN_BOUND) return score + ply;
+    if (score <= -SCORE_WIN_BOUND) return score - ply;
+    return score;
+}
+
+int score_from_tt(int score, int ply) {
+    if (score >= SCORE_WIN_BOUND) return score - ply;
+    if (score <= -SCORE_WIN_BOUND) return score + ply;
+    return score;
+}
+
+// Whether a position appeared since the last capture, the filter makes the usual miss O(1)
+bool path_repeats(const SearchContext* ctx, uint64_t hash) {
+    if (ctx->path_filter[hash & (PATH_FILTER_SIZE - 1)] == 0) {
+        return false;
+    }
+    for (int i = ctx->path_length - 1; i >= ctx->path_floor; i--) {
+        if (ctx->path[i] == hash) return true;
+    }
+    return false;
+}
+
+void path_push(SearchContext* ctx, uint64_t hash) {
+    ctx->path[ctx->path_length++] = hash;
+    ctx->path_filter[hash & (PATH_FILTER_SIZE - 1)]++;
+}
+
+void path_pop(SearchContext* ctx) {
+    uint64_t hash = ctx->path[--ctx->path_length];
+    ctx->path_filter[hash & (PATH_FILTER_SIZE - 1)]--;
+}
+
+// Start the path with the game history and the root
+void path_init(SearchContext* ctx, const Game* root) {
+    ctx->path_length = 0;
+    ctx->path_floor = 0;
+    memset(ctx->path_filter, 0, sizeof(ctx->path_filter));
+
+    uint64_t hash = hash_game(root);
+    const RepetitionRing* history = ctx->limits.history;
+    for (int i = 0; history && i < history->count; i++) {
+        if (ring_at(history, i) != hash) {
+            path_push(ctx, ring_at(history, i));
+        }
+    }
+    path_push(ctx, hash);
+}
+
+// Score of a repeated position for its player to move, as the server would adjudicate it
+int repetition_score(const Game* game, int ply) {
+    GAME_STATE result = adjudicate(game, engine_tablebase);
+    if (result == DRAW) return 0;
+    return (result == WIN_PLAYER_0) == (game->current_state == MOVE_PLAYER_0) ? SCORE_WIN - ply : -SCORE_WIN + ply;
+}
+
+/**
+ * @brief Negamax alpha-beta search of a position.
+ *
+ * @param ctx The search context of the calling thread.
+ * @param game The position to search, moves are made and unmade in place so it is restored on return.
+ * @param depth Remaining depth in plies.
+ * @param alpha Lower bound of the window.
+ * @param beta Upper bound of the window.
+ * @param ply Distance from the root.
+ *
+ * @return int The score of the position for the player to move (meaningless once ctx->stopped is set).
+ */
+int search_node(SearchContext* ctx, Game* game, int depth, int alpha, int beta, int ply) {
+    ctx->nodes++;
+    ctx->pv_length[ply] = ply;
+
+    if ((ctx->nodes & 1023) == 0 && search_should_stop(ctx)) {
+        ctx->stopped = true;
+    }
+    if (ctx->stopped) {
+        return 0;
+    }
+
+    int moves[6];
+    int move_count = list_moves(game, moves);
+    if (move_count == 0) {
+        return -SCORE_WIN + ply;  // Nothing left to sow with
+    }
+
+    // Exact result in the endgame, the root still needs a move so it is always searched
+    TBResult tb_result;
+    if (ply > 0 && engine_tablebase && tb_probe(engine_tablebase, game, &tb_result)) {
+        int distance = ply + (tb_result.distance < SCORE_MAX_DISTANCE ? tb_result.distance : SCORE_MAX_DISTANCE);
+        if (tb_result.value == TB_WIN) return SCORE_WIN - distance;
+        if (tb_result.value == TB_LOSS) return -SCORE_WIN + distance;
+        return 0;
+    }
+
+    if (depth <= 0 || ply >= ENGINE_MAX_PLY - 1) {
+        return evaluate(game);
+    }
+
+    // Transposition table lookup, cutoffs are only taken below the root
+    uint64_t hash = 0;
+    int tt_move = TT_NO_MOVE;
+    if (ctx->tt) {
+        TTHit hit;
+        hash = hash_game(game);
+        if (tt_probe(ctx->tt, hash, &hit)) {
+            tt_move = hit.move;
+            int score = score_from_tt(hit.score, ply);
+            if (ply > 0 && hit.depth >= depth &&
+                (hit.bound == BOUND_EXACT ||
+                 (hit.bound == BOUND_LOWER && score >= beta) ||
+                 (hit.bound == BOUND_UPPER && score <= alpha))) {
+                return score;
+            }
+        }
+    }
+
+    // Try the table move first
+    for (int i = 1; i < move_count; i++) {
+        if (moves[i] == tt_move) {
+            moves[i] = moves[0];
+            moves[0] = tt_move;
+            break;
+        }
+    }
+
+    int original_alpha = alpha;
+    int best_score = -SCORE_INFINITE;
+    int best_move = moves[0];
+
+    for (int i = 0; i < move_count; i++) {
+        MoveUndo undo;
+        int score;
+        if (make_move(game, moves[i], &undo)) {
+            score = SCORE_WIN - (ply + 1);
+            ctx->pv_length[ply + 1] = ply + 1;
+        } else {
+            // No earlier position can come back after a capture
+            int floor = ctx->path_floor;
+            if (undo.captured) {
+                ctx->path_floor = ctx->path_length;
+            }
+
+            uint64_t child_hash = hash_game(game);
+            if (path_repeats(ctx, child_hash)) {
+                score = -repetition_score(game, ply + 1);
+                ctx->pv_length[ply + 1] = ply + 1;
+            } else {
+                path_push(ctx, child_hash);
+                score = -search_node(ctx, game, depth - 1, -beta, -alpha, ply + 1);
+                path_pop(ctx);
+            }
+            ctx->path_floor = floor;
+        }
+        unmake_move(game, &undo);
+
+        if (ctx->stopped) {
+            return 0;
+        }
+
+        if (score > best_score) {
+            best_score = score;
+            best_move = moves[i];
+
+            if (score > alpha) {
+                alpha = score;
+
+                // Update the principal variation
+                ctx->pv[ply][ply] = moves[i];
+                for (int j = ply + 1; j < ctx->pv_length[ply + 1]; j++) {
+                    ctx->pv[ply][j] = ctx->pv[ply + 1][j];
+                }
+                ctx->pv_length[ply] = ctx->pv_length[ply + 1] > ply + 1 ? ctx->pv_length[ply + 1] : ply + 1;
+
+                if (alpha >= beta) {
+                    break;
+                }
+            }
+        }
+    }
+
+    if (ctx->tt) {
+        BOUND bound = best_score >= beta ? BOUND_LOWER : (best_score > original_alpha ? BOUND_EXACT : BOUND_UPPER);
+        tt_store(ctx->tt, hash, depth, bound, score_to_tt(best_score, ply), best_move);
+    }
+
+    return best_score;
+}
+
+/**
+ * @brief Iterative deepening loop of one search thread.
+ *
+ * @details Helper threads (id > 0) skip some depths following a per-thread pattern, so that
+ * with Lazy SMP they reach different depths at different times and fill the shared table
+ * with entries the other threads can use.
+ */
+void search_iterate(SearchContext* ctx, const Game* game, int id, SearchResult* result) {
+    int max_depth = ctx->limits.depth > 0 && ctx->limits.depth < ENGINE_MAX_PLY ? ctx->limits.depth : ENGINE_MAX_PLY - 1;
+    Game position = *game;  // Own copy to make and unmake moves on
+    path_init(ctx, game);
+
+    for (int depth = 1; depth <= max_depth; depth++) {
+        if (id > 0) {
+            int i = (id - 1) % SKIP_PATTERNS;
+            if (((depth + SKIP_PHASE[i]) / SKIP_SIZE[i]) % 2) {
+                continue;
+            }
+        }
+
+        int score = search_node(ctx, &position, depth, -SCORE_INFINITE, SCORE_INFINITE, 0);
+        // Keep the last completed iteration, only the main thread may fall back on a partial first one
+        if (ctx->stopped && (result->depth > 0 || id > 0)) {
+            break;
+        }
+
+        result->score = score;
+        result->depth = depth;
+        result->pv_length = ctx->pv_length[0];
+        memcpy(result->pv, ctx->pv[0], sizeof(int) * ctx->pv_length[0]);
+        if (result->pv_length > 0) {
+            result->move = result->pv[0];
+        }
+
+        // A forced result will not change with more depth
+        if (ctx->stopped || score >= SCORE_WIN_BOUND || score <= -SCORE_WIN_BOUND) {
+            break;
+        }
+    }
+}
+
+void* search_thread_main(void* arg) {
+    SearchThread* thread = arg;
+    search_iterate(&thread->ctx, thread->game, thread->id, &thread->result);
+    return NULL;
+}
+
+/**
+ * @brief Iterative deepening search of a position on several threads sharing the transposition table.
+ *
+ * @param game The position to search.
+ * @param limits When to stop, at least one iteration is always completed. Node limits apply per thread.
+ * @param tt Transposition table to use, or NULL to search without one (helpers are then useless).
+ * @param threads Number of threads, from 1 to ENGINE_MAX_THREADS.
+ * @param result Filled with the deepest completed iteration, nodes are summed over all threads.
+ *
+ * @return int Returns 0 on success, or -1 if the player to move has no move or allocation failed.
+ */
+int engine_search_parallel(const Game* game, const SearchLimits* limits, TransTable* tt, int threads, SearchResult* result) {
+    int moves[6];
+    if (list_moves(game, moves) == 0) {
+        return -1;
+    }
+
+    if (threads < 1) threads = 1;
+    if (threads > ENGINE_MAX_THREADS) threads = ENGINE_MAX_THREADS;
+
+    SearchThread* pool = malloc(sizeof(SearchThread) * threads);
+    if (!pool) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+
+    if (tt) {
+        tt_new_search(tt);
+    }
+
+    _Atomic bool abort = false;
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (int i = 0; i < threads; i++) {
+        pool[i].ctx.tt = tt;
+        pool[i].ctx.limits = *limits;
+        pool[i].ctx.start = start;
+        pool[i].ctx.nodes = 0;
+        pool[i].ctx.stopped = false;
+        pool[i].ctx.abort = &abort;
+        pool[i].game = game;
+        pool[i].id = i;
+        pool[i].result.move = moves[0];
+        pool[i].result.score = 0;
+        pool[i].result.depth = 0;
+        pool[i].result.pv_length = 0;
+    }
+
+    // Helpers run until the main thread is done
+    int started = 1;
+    for (; started < threads; started++) {
+        if (pthread_create(&pool[started].thread, NULL, search_thread_main, &pool[started])) {
+            break;
+        }
+    }
+
+    search_iterate(&pool[0].ctx, game, 0, &pool[0].result);
+    atomic_store(&abort, true);
+
+    int best = 0;
+    uint64_t nodes = pool[0].ctx.nodes;
+    for (int i = 1; i < started; i++) {
+        pthread_join(pool[i].thread, NULL);
+        nodes += pool[i].ctx.nodes;
+        if (pool[i].result.depth > pool[best].result.depth) {
+            best = i;
+        }
+    }
+
+    *result = pool[best].result;
+    result->nodes = nodes;
+    result->elapsed_ms = elapsed_ms(&start);
+    free(pool);
+    return 0;
+}
+
+/**
+ * @brief Iterative deepening search of a position.
+ *
+ * @param game The position to search.
+ * @param limits When to stop, at least one iteration is always completed.
+ * @param tt Transposition table to use, or NULL to search without one.
+ * @param result Filled with the result of the last completed iteration.
+ *
+ * @return int Returns 0 on success, or -1 if the player to move has no move.
+ */
+int engine_search(const Game* game, const SearchLimits* limits, TransTable* tt, SearchResult* result) {
+    return engine_search_parallel(game, limits, tt, 1, result);
+}
+
+#endif //AWALEGAME_ENGINE_H
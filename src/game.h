@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #include "cJSON.h"
 
@@ -18,6 +19,7 @@
 #define MAX_GAMES 100
 #define MAX_NAME_LENGTH 32
 #define BOARD_SIZE 12
+#define MAX_HISTORY 1024
 #define JSON_FILENAME "game.json"
 
 
@@ -26,6 +28,7 @@ typedef enum {
     MOVE_PLAYER_1,
     WIN_PLAYER_0,
     WIN_PLAYER_1,
+    DRAW,  // Adjudicated after a repetition
 } GAME_STATE;
 
 // Represent the score of a game
@@ -41,19 +44,40 @@ typedef struct {
     GAME_STATE current_state;
     Score score;
     int board[BOARD_SIZE];
+    uint32_t version;  // Increased by the server with every move, so that clients can tell what they missed
 } Game;
 
+// Changes made to a game by one move, sent instead of the whole game to clients holding the previous version
+typedef struct {
+    uint32_t version;        // Version of the game after the move
+    int move;                // Slot played, from 1 to 12 as in MOVE, or 0 for a surrender
+    int count;               // Number of pits changed
+    int pits[BOARD_SIZE];    // Their indexes
+    int seeds[BOARD_SIZE];   // Their new number of seeds
+    int captured;            // Seeds captured by the move
+    Score score;
+    GAME_STATE state;
+} GameDelta;
+
 // Represent a single player
 typedef struct {
     char name[MAX_NAME_LENGTH + 1];
     bool online;
 } Player;
 
+// Slots played in a game since init_game, enough to rebuild any of its past positions
+typedef struct {
+    int count;
+    bool complete;  // False for games stored before their moves were recorded, or too long to record
+    int8_t slots[MAX_HISTORY];
+} MoveHistory;
+
 // Represent the entire game data
 typedef struct {
     Player players[MAX_PLAYERS];
     int player_count;
     Game games[MAX_GAMES];
+    MoveHistory histories[MAX_GAMES];  // Same index as games
     int game_count;
 } GameData;
 
@@ -65,8 +89,8 @@ int init_score(Game* game) {
 
 int init_game(Game *game, const char* player0, const char* player1) {
     strncpy(game->player0, player0, MAX_NAME_LENGTH);
-    strncpy(game->player1, player1, MAX_NAME_LENGTH);
     game->player0[MAX_NAME_LENGTH] = '\0';
+    strncpy(game->player1, player1, MAX_NAME_LENGTH);
     game->player1[MAX_NAME_LENGTH] = '\0';
 
     game->current_state = MOVE_PLAYER_0;
@@ -74,6 +98,7 @@ int init_game(Game *game, const char* player0, const char* player1) {
     for (int i = 0; i < 12; i++) {
         game->board[i] = 4;
     }
+    game->version = 0;
     return 0;
 }
 
@@ -152,6 +177,212 @@ int play_turn(Game* game, int slot) {
     return 0;
 }
 
+// Everything needed to take back a move played with make_move
+typedef struct {
+    int8_t slot;
+    uint8_t pebbles;    // Seeds taken from the slot
+    uint16_t captured;  // Bit i set if pit i was captured
+    uint16_t threes;    // Bit i set if captured pit i held 3 seeds (2 otherwise)
+    uint8_t state;      // current_state before the move
+} MoveUndo;
+
+/**
+ * @brief Same as play_turn, but records what the move changed so that unmake_move can revert it.
+ *
+ * @param game The game, updated in place.
+ * @param slot The slot to empty, from 0 to 11.
+ * @param undo Filled with the sown seeds and the captures.
+ *
+ * @return int 1 if the current player has won (the turn is then not switched), 0 otherwise.
+ */
+int make_move(Game* game, int slot, MoveUndo* undo) {
+    undo->slot = (int8_t) slot;
+    undo->state = (uint8_t) game->current_state;
+    undo->captured = 0;
+    undo->threes = 0;
+
+    // Sow as move_pebbles does: one seed per lap in each pit 1 to 10 pits away, none in the slot or the pit before it
+    int pebbles = game->board[slot];
+    undo->pebbles = (uint8_t) pebbles;
+    game->board[slot] = 0;
+    for (int d = 1; d <= 10 && d <= pebbles; d++) {
+        int pit = slot + d < BOARD_SIZE ? slot + d : slot + d - BOARD_SIZE;
+        game->board[pit] += (pebbles - d) / 12 + 1;
+    }
+
+    // Victory if opponent has no pebbles in its camp
+    int enemy = ((game->current_state + 1) % 2) * 6;
+    int hasPebbles = 0;
+    for (int i = enemy; i < enemy + 6; i++) {
+        if (game->board[i] != 0) {
+            hasPebbles = 1;
+            break;
+        }
+    }
+    if (!hasPebbles) {
+        return 1;
+    }
+
+    // Captures, walking back from the last pit sown as compute_score does
+    int lastSlot = (slot + pebbles) % 12;
+    int slotScore = game->board[lastSlot];
+    while (slotScore == 2 || slotScore == 3) {
+        if ((game->current_state == MOVE_PLAYER_0 && lastSlot >= 6) ||
+            (game->current_state == MOVE_PLAYER_1 && lastSlot < 6)) {
+            if (game->current_state == MOVE_PLAYER_0) {
+                game->score.player0 += slotScore;
+            } else {
+                game->score.player1 += slotScore;
+            }
+            game->board[lastSlot] = 0;
+            undo->captured |= (uint16_t) (1u << lastSlot);
+            if (slotScore == 3) {
+                undo->threes |= (uint16_t) (1u << lastSlot);
+            }
+        }
+
+        lastSlot = lastSlot == 0 ? BOARD_SIZE - 1 : lastSlot - 1;
+        slotScore = game->board[lastSlot];
+    }
+
+    // Victory if more than half the available points (player0's score, as in play_turn)
+    if (game->score.player0 > 24) {
+        return 1;
+    }
+
+    game->current_state = (game->current_state + 1) % 2;
+    return 0;
+}
+
+// Revert the move recorded in undo, which must be the last one made on this game
+void unmake_move(Game* game, const MoveUndo* undo) {
+    int captured = 0;
+    for (unsigned mask = undo->captured; mask; mask &= mask - 1) {
+        int pit = __builtin_ctz(mask);
+        int seeds = undo->threes & (1u << pit) ? 3 : 2;
+        game->board[pit] = seeds;
+        captured += seeds;
+    }
+    if (undo->state == MOVE_PLAYER_0) {
+        game->score.player0 -= captured;
+    } else {
+        game->score.player1 -= captured;
+    }
+
+    // Take back the sown seeds, as make_move sowed them
+    int slot = undo->slot, pebbles = undo->pebbles;
+    for (int d = 1; d <= 10 && d <= pebbles; d++) {
+        int pit = slot + d < BOARD_SIZE ? slot + d : slot + d - BOARD_SIZE;
+        game->board[pit] -= (pebbles - d) / 12 + 1;
+    }
+    game->board[slot] = pebbles;
+    game->current_state = (GAME_STATE) undo->state;
+}
+
+// List the slots the player to move may empty (non-empty pits on their side), returns how many
+int list_moves(const Game* game, int moves[6]) {
+    int count = 0;
+    if (game->current_state != MOVE_PLAYER_0 && game->current_state != MOVE_PLAYER_1) {
+        return 0;
+    }
+
+    int first = game->current_state * 6;
+    for (int i = first; i < first + 6; i++) {
+        if (game->board[i] > 0) {
+            moves[count++] = i;
+        }
+    }
+    return count;
+}
+
+// Start recording the moves of a new game
+int init_history(MoveHistory* history) {
+    history->count = 0;
+    history->complete = true;
+    return 0;
+}
+
+// Append a played slot (0 to 11), returns -1 if the slot is invalid or the history is full
+int record_move(MoveHistory* history, int slot) {
+    if (slot < 0 || slot >= BOARD_SIZE || history->count >= MAX_HISTORY) {
+        history->complete = false;
+        return -1;
+    }
+    history->slots[history->count++] = (int8_t) slot;
+    return 0;
+}
+
+/**
+ * @brief Rebuilds the position of a game after its first ply moves by replaying its history.
+ *
+ * @param game The game, only its player names are used.
+ * @param history The moves played in the game.
+ * @param ply Number of moves to replay, from 0 (initial position) to history->count.
+ * @param position Filled with the position. A winning last move sets the WIN state, as the server does.
+ *
+ * @return int Returns 0 on success, or -1 if the history is incomplete or ply is out of range.
+ */
+int game_at_ply(const Game* game, const MoveHistory* history, int ply, Game* position) {
+    if (!history->complete || ply < 0 || ply > history->count) {
+        return -1;
+    }
+
+    init_game(position, game->player0, game->player1);
+    for (int i = 0; i < ply; i++) {
+        MoveUndo undo;
+        if (make_move(position, history->slots[i], &undo)) {
+            position->current_state = position->current_state == MOVE_PLAYER_0 ? WIN_PLAYER_0 : WIN_PLAYER_1;
+            return i == ply - 1 ? 0 : -1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Describes a move by the differences between the game before and after it.
+ *
+ * @param before The game before the move.
+ * @param after The game after the move, its version already increased.
+ * @param move The slot played, from 1 to 12, or 0 for a surrender.
+ * @param delta Filled with the changes.
+ */
+void diff_games(const Game* before, const Game* after, int move, GameDelta* delta) {
+    delta->version = after->version;
+    delta->move = move;
+    delta->count = 0;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        if (before->board[i] != after->board[i]) {
+            delta->pits[delta->count] = i;
+            delta->seeds[delta->count] = after->board[i];
+            delta->count++;
+        }
+    }
+    delta->captured = (after->score.player0 - before->score.player0) + (after->score.player1 - before->score.player1);
+    delta->score = after->score;
+    delta->state = after->current_state;
+}
+
+/**
+ * @brief Applies the changes of a move to a game.
+ *
+ * @param game The game, updated in place.
+ * @param delta The changes, which must follow the version of the game.
+ *
+ * @return int Returns 0 on success, or -1 if versions were missed (the game is left unchanged).
+ */
+int apply_delta(Game* game, const GameDelta* delta) {
+    if (delta->version != game->version + 1) {
+        return -1;
+    }
+    for (int i = 0; i < delta->count; i++) {
+        game->board[delta->pits[i]] = delta->seeds[i];
+    }
+    game->score = delta->score;
+    game->current_state = delta->state;
+    game->version = delta->version;
+    return 0;
+}
+
 int print_board_state(Game* game) {
     printf("========= Board State: =========\n\n");
 
@@ -210,6 +441,68 @@ int print_player_stats(Game *game, int player) {
     return 0;
 }
 
+// Fill a game and its move history from its JSON object, as stored in the games array
+int parse_game(const cJSON *json, Game *game, MoveHistory *history) {
+    if (!json || !cJSON_IsObject(json)) {
+        return 1;
+    }
+
+    cJSON *player0 = cJSON_GetObjectItem(json, "player0");
+    cJSON *player1 = cJSON_GetObjectItem(json, "player1");
+    cJSON *current_state = cJSON_GetObjectItem(json, "currentState");
+
+    cJSON *score = cJSON_GetObjectItem(json, "score");
+    cJSON *board = cJSON_GetObjectItem(json, "board");
+
+    if (player0 && cJSON_IsString(player0)) {
+        strncpy(game->player0, player0->valuestring, MAX_NAME_LENGTH);
+    }
+    if (player1 && cJSON_IsString(player1)) {
+        strncpy(game->player1, player1->valuestring, MAX_NAME_LENGTH);
+    }
+    if (current_state && cJSON_IsNumber(current_state)) {
+        game->current_state = current_state->valueint;
+    }
+
+    // Games stored before versions existed start from 0
+    cJSON *version = cJSON_GetObjectItem(json, "version");
+    game->version = version && cJSON_IsNumber(version) ? (uint32_t) version->valuedouble : 0;
+
+    if (score && cJSON_IsObject(score)) {
+        cJSON *score0 = cJSON_GetObjectItem(score, "player0");
+        cJSON *score1 = cJSON_GetObjectItem(score, "player1");
+
+        if (score0 && cJSON_IsNumber(score0)) {
+            game->score.player0 = score0->valueint;
+        }
+        if (score1 && cJSON_IsNumber(score1)) {
+            game->score.player1 = score1->valueint;
+        }
+    }
+
+    if (board && cJSON_IsArray(board)) {
+        int board_size = cJSON_GetArraySize(board);
+        for (int j = 0; j < board_size && j < BOARD_SIZE; j++) {
+            cJSON *cell = cJSON_GetArrayItem(board, j);
+            if (cell && cJSON_IsNumber(cell)) {
+                game->board[j] = cell->valueint;
+            }
+        }
+    }
+
+    cJSON *moves = cJSON_GetObjectItem(json, "moves");
+    history->count = 0;
+    history->complete = moves && cJSON_IsArray(moves);
+    cJSON *slot;
+    cJSON_ArrayForEach(slot, moves) {
+        if (!cJSON_IsNumber(slot) || record_move(history, slot->valueint)) {
+            history->complete = false;
+            break;
+        }
+    }
+    return 0;
+}
+
 // Parse the JSON file into a GameData struct
 int parse_json(GameData* gameData, const char *filename) {
     FILE *file = fopen(filename, "r");
@@ -261,47 +554,7 @@ int parse_json(GameData* gameData, const char *filename) {
         gameData->game_count = cJSON_GetArraySize(games);
         for (int i = 0; i < gameData->game_count; i++) {
             cJSON *game = cJSON_GetArrayItem(games, i);
-
-            if (game && cJSON_IsObject(game)) {
-                cJSON *player0 = cJSON_GetObjectItem(game, "player0");
-                cJSON *player1 = cJSON_GetObjectItem(game, "player1");
-                cJSON *current_state = cJSON_GetObjectItem(game, "currentState");
-
-                cJSON *score = cJSON_GetObjectItem(game, "score");
-                cJSON *board = cJSON_GetObjectItem(game, "board");
-
-                if (player0 && cJSON_IsString(player0)) {
-                    strncpy(gameData->games[i].player0, player0->valuestring, MAX_NAME_LENGTH);
-                }
-                if (player1 && cJSON_IsString(player1)) {
-                    strncpy(gameData->games[i].player1, player1->valuestring, MAX_NAME_LENGTH);
-                }
-                if (current_state && cJSON_IsNumber(current_state)) {
-                    gameData->games[i].current_state = current_state->valueint;
-                }
-
-                if (score && cJSON_IsObject(score)) {
-                    cJSON *score0 = cJSON_GetObjectItem(score, "player0");
-                    cJSON *score1 = cJSON_GetObjectItem(score, "player1");
-
-                    if (score0 && cJSON_IsNumber(score0)) {
-                        gameData->games[i].score.player0 = score0->valueint;
-                    }
-                    if (score1 && cJSON_IsNumber(score1)) {
-                        gameData->games[i].score.player1 = score1->valueint;
-                    }
-                }
-
-                if (board && cJSON_IsArray(board)) {
-                    int board_size = cJSON_GetArraySize(board);
-                    for (int j = 0; j < board_size && j < BOARD_SIZE; j++) {
-                        cJSON *cell = cJSON_GetArrayItem(board, j);
-                        if (cell && cJSON_IsNumber(cell)) {
-                            gameData->games[i].board[j] = cell->valueint;
-                        }
-                    }
-                }
-            }
+            parse_game(game, &gameData->games[i], &gameData->histories[i]);
         }
     }
 
@@ -338,6 +591,14 @@ int save_to_json(const char *filename, const GameData *data) {
 
         cJSON *board = cJSON_CreateIntArray(data->games[i].board, BOARD_SIZE);
         cJSON_AddItemToObject(game, "board", board);
+        cJSON_AddNumberToObject(game, "version", data->games[i].version);
+
+        if (data->histories[i].complete) {
+            cJSON *moves = cJSON_AddArrayToObject(game, "moves");
+            for (int j = 0; j < data->histories[i].count; j++) {
+                cJSON_AddItemToArray(moves, cJSON_CreateNumber(data->histories[i].slots[j]));
+            }
+        }
 
         cJSON_AddItemToArray(games, game);
     }
@@ -0,0 +1,443 @@
+//
+// JSON read in a single pass straight into the fields of the caller, without building a cJSON tree.
+// It accepts exactly what cJSON_Parse accepts (whitespace is any byte up to a space, numbers are
+// what strtod reads, the text ends at its first null byte and anything after the root value is
+// ignored), so that decoders built on it give the same results as the cJSON ones
+//
+
+#ifndef AWALEGAME_JSON_READER_H
+#define AWALEGAME_JSON_READER_H
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define JSON_NESTING_LIMIT 1000  // Same as CJSON_NESTING_LIMIT
+#define JSON_NUMBER_SIZE 64      // cJSON reads at most 63 characters of a number
+
+// Kind of the next value, told by its first byte as cJSON does
+typedef enum {
+    JSON_INVALID,
+    JSON_NULL,
+    JSON_FALSE,
+    JSON_TRUE,
+    JSON_NUMBER,
+    JSON_STRING,
+    JSON_ARRAY,
+    JSON_OBJECT
+} JSON_TYPE;
+
+// Input text, reading anything malformed sets error and every later read fails
+typedef struct {
+    const char* data;
+    size_t length;  // Bytes before the first null byte
+    size_t offset;
+    int depth;      // Arrays and objects entered
+    bool error;
+} JsonReader;
+
+void json_read_space(JsonReader* reader) {
+    while (reader->offset < reader->length && (unsigned char) reader->data[reader->offset] <= ' ') {
+        reader->offset++;
+    }
+}
+
+// Starts before the root value, after a UTF-8 byte order mark if there is one
+void json_reader_init(JsonReader* reader, const char* data, size_t length) {
+    reader->data = data;
+    reader->length = strnlen(data, length);
+    reader->offset = 0;
+    reader->depth = 0;
+    reader->error = false;
+    if (reader->length >= 4 && memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        reader->offset = 3;
+    }
+    json_read_space(reader);
+}
+
+// Returns false, and sets error, if the next bytes are not the given text
+bool json_read_literal(JsonReader* reader, const char* literal, size_t length) {
+    if (reader->error || reader->length - reader->offset < length ||
+        memcmp(reader->data + reader->offset, literal, length) != 0) {
+        reader->error = true;
+        return false;
+    }
+    reader->offset += length;
+    return true;
+}
+
+JSON_TYPE json_peek(const JsonReader* reader) {
+    if (reader->error || reader->offset >= reader->length) {
+        return JSON_INVALID;
+    }
+    const char* next = reader->data + reader->offset;
+    size_t left = reader->length - reader->offset;
+    switch (*next) {
+        case 'n': return left >= 4 && memcmp(next, "null", 4) == 0 ? JSON_NULL : JSON_INVALID;
+        case 'f': return left >= 5 && memcmp(next, "false", 5) == 0 ? JSON_FALSE : JSON_INVALID;
+        case 't': return left >= 4 && memcmp(next, "true", 4) == 0 ? JSON_TRUE : JSON_INVALID;
+        case '"': return JSON_STRING;
+        case '[': return JSON_ARRAY;
+        case '{': return JSON_OBJECT;
+        case '-': return JSON_NUMBER;
+        default: return *next >= '0' && *next <= '9' ? JSON_NUMBER : JSON_INVALID;
+    }
+}
+
+/**
+ * @brief Reads a number as cJSON does: the longest run of digits, signs, exponents and points
+ * (63 at most) given to strtod, which may use only part of it.
+ *
+ * @param reader The input, just before the number.
+ * @param value Set to the number.
+ *
+ * @return bool Returns true on success, or false if strtod reads nothing (the reader's error is set).
+ */
+bool json_read_number(JsonReader* reader, double* value) {
+    if (reader->error) {
+        return false;
+    }
+    char number[JSON_NUMBER_SIZE];
+    size_t length = 0;
+    bool digits = true;  // Only digits after an optional minus, what the server sends
+    while (length < JSON_NUMBER_SIZE - 1 && reader->offset + length < reader->length) {
+        char c = reader->data[reader->offset + length];
+        if (c >= '0' && c <= '9') {
+        } else if (c == '-' && length == 0) {
+        } else if (c == '+' || c == '-' || c == 'e' || c == 'E' || c == '.') {
+            digits = false;
+        } else {
+            break;
+        }
+        number[length++] = c;
+    }
+    number[length] = '\0';
+
+    // Up to 9 digits fit an int, strtod is much slower and would give the same double
+    size_t sign = length && number[0] == '-';
+    if (digits && length > sign && length - sign <= 9) {
+        int integer = 0;
+        for (size_t i = sign; i < length; i++) {
+            integer = integer * 10 + (number[i] - '0');
+        }
+        *value = sign ? -integer : integer;
+        reader->offset += length;
+        return true;
+    }
+
+    char* end;
+    *value = strtod(number, &end);
+    if (end == number) {
+        reader->error = true;
+        return false;
+    }
+    reader->offset += (size_t) (end - number);
+    return true;
+}
+
+// Appends one byte of a decoded string, keeping what C sees of it: the bytes before the first null one
+void json_store(char* string, size_t size, size_t* length, bool* ended, bool* longer, unsigned char byte) {
+    if (*ended) return;
+    if (byte == '\0') {
+        *ended = true;
+    } else if (*length + 1 < size) {
+        string[(*length)++] = (char) byte;
+    } else {
+        *longer = true;
+    }
+}
+
+// Appends bytes which are not null, see json_store
+void json_store_run(char* string, size_t size, size_t* length, bool ended, bool* longer, const char* bytes, size_t count) {
+    if (ended || count == 0) return;
+    size_t room = size - 1 - *length;
+    if (count > room) {
+        count = room;
+        *longer = true;
+    }
+    memcpy(string + *length, bytes, count);
+    *length += count;
+}
+
+// Value of 4 hexadecimal digits, 0 if one is not (as cJSON, which then decodes a null character)
+unsigned json_hex4(const char* hex) {
+    unsigned value = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = hex[i];
+        if (c >= '0' && c <= '9') value = value * 16 + (unsigned) (c - '0');
+        else if (c >= 'A' && c <= 'F') value = value * 16 + 10 + (unsigned) (c - 'A');
+        else if (c >= 'a' && c <= 'f') value = value * 16 + 10 + (unsigned) (c - 'a');
+        else return 0;
+    }
+    return value;
+}
+
+/**
+ * @brief Reads a string, decoding its escapes.
+ *
+ * @param reader The input, just before the opening quote.
+ * @param string Filled with the decoded string, null-terminated, can be NULL to skip it.
+ * @param size Size of the buffer, longer strings are cut.
+ * @param longer Set to true if the string was cut, can be NULL.
+ *
+ * @return bool Returns true on success, or false if the string is malformed (the reader's error is set).
+ */
+bool json_read_string(JsonReader* reader, char* string, size_t size, bool* longer) {
+    char ignored;
+    if (!string) {
+        string = &ignored;
+        size = 1;
+    }
+    bool cut = false;
+    if (longer) *longer = false;
+    string[0] = '\0';
+    if (reader->error || reader->offset >= reader->length || reader->data[reader->offset] != '"') {
+        reader->error = true;
+        return false;
+    }
+
+    // The closing quote is the first one not following a backslash
+    const char* data = reader->data;
+    size_t start = reader->offset + 1;
+    size_t end = start;
+    while (end < reader->length && data[end] != '"') {
+        end += data[end] == '\\' ? 2 : 1;
+    }
+    if (end >= reader->length) {
+        reader->error = true;
+        return false;
+    }
+
+    size_t length = 0;
+    bool ended = false;
+    size_t i = start;
+    while (i < end) {
+        // Bytes up to the next escape are copied as they are, there is no null byte before length
+        const char* escape = memchr(data + i, '\\', end - i);
+        size_t run = escape ? (size_t) (escape - data) - i : end - i;
+        json_store_run(string, size, &length, ended, &cut, data + i, run);
+        i += run;
+        if (i >= end) {
+            break;
+        }
+
+        // data[i + 1] is at most the closing quote
+        unsigned char escaped = (unsigned char) data[i + 1];
+        size_t sequence = 2;
+        switch (escaped) {
+            case 'b': escaped = '\b'; break;
+            case 'f': escaped = '\f'; break;
+            case 'n': escaped = '\n'; break;
+            case 'r': escaped = '\r'; break;
+            case 't': escaped = '\t'; break;
+            case '"':
+            case '\\':
+            case '/':
+                break;
+            case 'u': {
+                if (end - i < 6) {
+                    reader->error = true;
+                    return false;
+                }
+                unsigned long codepoint = json_hex4(data + i + 2);
+                sequence = 6;
+                if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+                    reader->error = true;
+                    return false;
+                }
+                if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+                    unsigned low = end - i < 12 || data[i + 6] != '\\' || data[i + 7] != 'u' ? 0 : json_hex4(data + i + 8);
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        reader->error = true;
+                        return false;
+                    }
+                    codepoint = 0x10000 + (((codepoint & 0x3FF) << 10) | (low & 0x3FF));
+                    sequence = 12;
+                }
+
+                // First byte marks of UTF-8 sequences by their length
+                const unsigned char marks[] = {0, 0, 0xC0, 0xE0, 0xF0};
+                unsigned char utf8[4];
+                int bytes = codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4;
+                for (int b = bytes - 1; b > 0; b--) {
+                    utf8[b] = (unsigned char) ((codepoint & 0x3F) | 0x80);
+                    codepoint >>= 6;
+                }
+                utf8[0] = (unsigned char) (codepoint | marks[bytes]);
+                for (int b = 0; b < bytes; b++) {
+                    json_store(string, size, &length, &ended, &cut, utf8[b]);
+                }
+                i += sequence;
+                continue;
+            }
+            default:
+                reader->error = true;
+                return false;
+        }
+        json_store(string, size, &length, &ended, &cut, escaped);
+        i += sequence;
+    }
+
+    string[length] = '\0';
+    if (longer) *longer = cut;
+    reader->offset = end + 1;
+    json_read_space(reader);
+    return true;
+}
+
+/**
+ * @brief Enters an array or an object.
+ *
+ * @param reader The input, just before the value.
+ * @param open '[' or '{'.
+ *
+ * @return bool Returns true on success, or false if the next value is something else or nested too
+ * deeply (the reader's error is set).
+ */
+bool json_read_begin(JsonReader* reader, char open) {
+    if (reader->error || reader->depth >= JSON_NESTING_LIMIT || reader->offset >= reader->length ||
+        reader->data[reader->offset] != open) {
+        reader->error = true;
+        return false;
+    }
+    reader->depth++;
+    reader->offset++;
+    json_read_space(reader);
+    return true;
+}
+
+/**
+ * @brief Moves to the next element of an array or member of an object.
+ *
+ * @param reader The input, after json_read_begin or the previous element.
+ * @param close ']' or '}'.
+ * @param first Must be true before the first element, then is set to false.
+ *
+ * @return bool Returns true if an element follows, or false at the end of the container (consumed)
+ * or on a syntax error (the reader's error is set).
+ */
+bool json_read_next(JsonReader* reader, char close, bool* first) {
+    if (reader->error || reader->offset >= reader->length) {
+        reader->error = true;
+        return false;
+    }
+    char next = reader->data[reader->offset];
+    if (next == close) {
+        reader->depth--;
+        reader->offset++;
+        json_read_space(reader);
+        return false;
+    }
+    if (!*first) {
+        if (next != ',') {
+            reader->error = true;
+            return false;
+        }
+        reader->offset++;
+        json_read_space(reader);
+    }
+    *first = false;
+    return true;
+}
+
+// Name of the next member of an object and its colon, see json_read_string
+bool json_read_key(JsonReader* reader, char* key, size_t size, bool* longer) {
+    if (!json_read_string(reader, key, size, longer)) {
+        return false;
+    }
+    if (reader->offset >= reader->length || reader->data[reader->offset] != ':') {
+        reader->error = true;
+        return false;
+    }
+    reader->offset++;
+    json_read_space(reader);
+    return true;
+}
+
+// Reads and ignores the next value, returns false if it is malformed (the reader's error is set)
+bool json_read_skip(JsonReader* reader) {
+    double number;
+    bool first = true;
+    switch (json_peek(reader)) {
+        case JSON_NULL: json_read_literal(reader, "null", 4); break;
+        case JSON_FALSE: json_read_literal(reader, "false", 5); break;
+        case JSON_TRUE: json_read_literal(reader, "true", 4); break;
+        case JSON_NUMBER: json_read_number(reader, &number); break;
+        case JSON_STRING: json_read_string(reader, NULL, 0, NULL); break;
+        case JSON_ARRAY:
+            json_read_begin(reader, '[');
+            while (json_read_next(reader, ']', &first)) {
+                json_read_skip(reader);
+            }
+            break;
+        case JSON_OBJECT:
+            json_read_begin(reader, '{');
+            while (json_read_next(reader, '}', &first) && json_read_key(reader, NULL, 0, NULL)) {
+                json_read_skip(reader);
+            }
+            break;
+        case JSON_INVALID:
+            reader->error = true;
+            break;
+    }
+    if (!reader->error) json_read_space(reader);
+    return !reader->error;
+}
+
+// Number member of an object, type stays JSON_INVALID until it is found
+typedef struct {
+    JSON_TYPE type;
+    double value;
+} JsonNumber;
+
+// Reads a member into number if it is the first of its name (as cJSON_GetObjectItem finds), skips it otherwise
+void json_read_member_number(JsonReader* reader, JsonNumber* number) {
+    if (number->type != JSON_INVALID) {
+        json_read_skip(reader);
+        return;
+    }
+    number->type = json_peek(reader);
+    if (number->type == JSON_NUMBER) {
+        if (json_read_number(reader, &number->value)) json_read_space(reader);
+    } else {
+        json_read_skip(reader);
+    }
+}
+
+// Same for a string member, see json_read_string
+void json_read_member_string(JsonReader* reader, JSON_TYPE* type, char* string, size_t size) {
+    if (*type != JSON_INVALID) {
+        json_read_skip(reader);
+        return;
+    }
+    *type = json_peek(reader);
+    if (*type == JSON_STRING) {
+        json_read_string(reader, string, size, NULL);
+    } else {
+        json_read_skip(reader);
+    }
+}
+
+// Int of a number as cJSON's valueint, saturated
+int json_to_int(double value) {
+    if (value >= INT_MAX) return INT_MAX;
+    if (value <= (double) INT_MIN) return INT_MIN;
+    return (int) value;
+}
+
+// Version of a game from a number, 0 when out of range
+uint32_t json_to_version(double value) {
+    return value >= 0 && value <= UINT32_MAX ? (uint32_t) value : 0;
+}
+
+// Whether two keys are equal ignoring ASCII case, as cJSON_GetObjectItem compares them
+bool json_key_is(const char* key, const char* name) {
+    for (; *key && *name; key++, name++) {
+        char a = *key >= 'A' && *key <= 'Z' ? (char) (*key - 'A' + 'a') : *key;
+        char b = *name >= 'A' && *name <= 'Z' ? (char) (*name - 'A' + 'a') : *name;
+        if (a != b) return false;
+    }
+    return *key == *name;
+}
+
+#endif //AWALEGAME_JSON_READER_H
@@ -0,0 +1,182 @@
+//
+// JSON written straight into a growable buffer, without building a cJSON tree first.
+// The output is byte for byte that of cJSON_PrintUnformatted on the equivalent tree, so that
+// clients cannot tell which one the server used
+//
+
+#ifndef AWALEGAME_JSON_WRITER_H
+#define AWALEGAME_JSON_WRITER_H
+
+#include <stdio.h>
+
+#include "game.h"
+
+#define JSON_INITIAL_CAPACITY 256
+
+// Kept by each connection and reset before every message, so that it allocates only while it grows.
+// The text is always null-terminated, a failed allocation is remembered and reported by the caller
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+    bool error;
+} JsonWriter;
+
+void json_writer_init(JsonWriter* writer) {
+    writer->data = NULL;
+    writer->length = 0;
+    writer->capacity = 0;
+    writer->error = false;
+}
+
+void json_writer_free(JsonWriter* writer) {
+    free(writer->data);
+    json_writer_init(writer);
+}
+
+// Empties the writer, keeping its buffer
+void json_reset(JsonWriter* writer) {
+    writer->length = 0;
+    writer->error = false;
+    if (writer->data) writer->data[0] = '\0';
+}
+
+void json_append(JsonWriter* writer, const char* text, size_t length) {
+    if (writer->error) return;
+    if (writer->length + length + 1 > writer->capacity) {
+        size_t capacity = writer->capacity ? writer->capacity * 2 : JSON_INITIAL_CAPACITY;
+        while (capacity < writer->length + length + 1) capacity *= 2;
+        char* data = realloc(writer->data, capacity);
+        if (!data) {
+            writer->error = true;
+            return;
+        }
+        writer->data = data;
+        writer->capacity = capacity;
+    }
+    memcpy(writer->data + writer->length, text, length);
+    writer->length += length;
+    writer->data[writer->length] = '\0';
+}
+
+void json_char(JsonWriter* writer, char c) {
+    json_append(writer, &c, 1);
+}
+
+// Up to 2^32 cJSON prints the same digits with %1.15g. Digits are written from the end of the
+// buffer, snprintf costs more than the rest of a game
+void json_uint(JsonWriter* writer, uint32_t value) {
+    char digits[10];
+    char* start = digits + sizeof(digits);
+    do {
+        *--start = (char) ('0' + value % 10);
+        value /= 10;
+    } while (value);
+    json_append(writer, start, (size_t) (digits + sizeof(digits) - start));
+}
+
+// Integers are printed as cJSON prints a number holding an int
+void json_int(JsonWriter* writer, int value) {
+    if (value < 0) {
+        json_char(writer, '-');
+        json_uint(writer, 0u - (uint32_t) value);
+        return;
+    }
+    json_uint(writer, (uint32_t) value);
+}
+
+// Quoted string, escaped as cJSON does: short escapes where JSON has them, \u00xx for other control characters
+void json_string(JsonWriter* writer, const char* string) {
+    json_char(writer, '"');
+    const char* start = string;
+    for (const char* c = string; *c; c++) {
+        unsigned char byte = (unsigned char) *c;
+        if (byte > 31 && byte != '"' && byte != '\\') {
+            continue;
+        }
+        json_append(writer, start, (size_t) (c - start));
+        start = c + 1;
+
+        char escape[7];
+        switch (byte) {
+            case '"': json_append(writer, "\\\"", 2); break;
+            case '\\': json_append(writer, "\\\\", 2); break;
+            case '\b': json_append(writer, "\\b", 2); break;
+            case '\f': json_append(writer, "\\f", 2); break;
+            case '\n': json_append(writer, "\\n", 2); break;
+            case '\r': json_append(writer, "\\r", 2); break;
+            case '\t': json_append(writer, "\\t", 2); break;
+            default: json_append(writer, escape, (size_t) snprintf(escape, sizeof(escape), "\\u%04x", byte)); break;
+        }
+    }
+    json_append(writer, start, strlen(start));
+    json_char(writer, '"');
+}
+
+// Same text as game_to_json_string
+void json_write_game(JsonWriter* writer, const Game* game) {
+    json_append(writer, "{\"player0\":", 11);
+    json_string(writer, game->player0);
+    json_append(writer, ",\"player1\":", 11);
+    json_string(writer, game->player1);
+    json_append(writer, ",\"currentState\":", 16);
+    json_int(writer, game->current_state);
+    json_append(writer, ",\"score\":{\"player0\":", 20);
+    json_int(writer, game->score.player0);
+    json_append(writer, ",\"player1\":", 11);
+    json_int(writer, game->score.player1);
+    json_append(writer, "},\"board\":[", 11);
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        if (i) json_char(writer, ',');
+        json_int(writer, game->board[i]);
+    }
+    json_append(writer, "],\"version\":", 12);
+    json_uint(writer, game->version);
+    json_char(writer, '}');
+}
+
+// Same text as games_to_json_string
+void json_write_games(JsonWriter* writer, const Game* const* games, int count) {
+    json_char(writer, '[');
+    for (int i = 0; i < count; i++) {
+        if (i) json_char(writer, ',');
+        json_write_game(writer, games[i]);
+    }
+    json_char(writer, ']');
+}
+
+// Same text as delta_to_json_string
+void json_write_delta(JsonWriter* writer, const GameDelta* delta) {
+    json_append(writer, "{\"version\":", 11);
+    json_uint(writer, delta->version);
+    json_append(writer, ",\"move\":", 8);
+    json_int(writer, delta->move);
+    json_append(writer, ",\"pits\":[", 9);
+    for (int i = 0; i < delta->count; i++) {
+        if (i) json_char(writer, ',');
+        json_int(writer, delta->pits[i]);
+        json_char(writer, ',');
+        json_int(writer, delta->seeds[i]);
+    }
+    json_append(writer, "],\"captured\":", 13);
+    json_int(writer, delta->captured);
+    json_append(writer, ",\"score\":{\"player0\":", 20);
+    json_int(writer, delta->score.player0);
+    json_append(writer, ",\"player1\":", 11);
+    json_int(writer, delta->score.player1);
+    json_append(writer, "},\"currentState\":", 17);
+    json_int(writer, delta->state);
+    json_char(writer, '}');
+}
+
+// Array of strings, as sent by LIST and LIST_GAMES
+void json_write_names(JsonWriter* writer, const char* const* names, int count) {
+    json_char(writer, '[');
+    for (int i = 0; i < count; i++) {
+        if (i) json_char(writer, ',');
+        json_string(writer, names[i]);
+    }
+    json_char(writer, ']');
+}
+
+#endif //AWALEGAME_JSON_WRITER_H
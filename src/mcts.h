@@ -0,0 +1,374 @@
+//
+// Monte Carlo Tree Search engine (UCT with virtual loss), an alternative to engine.h for
+// weak and fast bots. Playouts use the sowing and capture rules of game.h.
+//
+
+#ifndef AWALEGAME_MCTS_H
+#define AWALEGAME_MCTS_H
+
+#include <math.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "game.h"
+
+#define MCTS_MAX_THREADS 64
+#define MCTS_MAX_DEPTH 256        // Deepest path followed from the root
+#define MCTS_PLAYOUT_PLIES 200    // Playouts longer than this are scored on captured seeds
+#define MCTS_VIRTUAL_LOSS 3       // Visits counted as losses while a thread is below a node
+#define MCTS_EXPLORATION 1.4
+#define MCTS_NO_MOVE 15
+
+typedef enum {
+    POLICY_RANDOM,  // Uniformly random moves
+    POLICY_LIGHT    // Half of the moves are the winning move or best capture, the rest random
+} PLAYOUT_POLICY;
+
+typedef enum {
+    NODE_LEAF,
+    NODE_EXPANDING,
+    NODE_EXPANDED
+} NODE_STATE;
+
+// A node of the tree, its statistics are from the point of view of the player who moved into it
+typedef struct {
+    _Atomic uint32_t visits;
+    _Atomic uint32_t reward;        // 2 per win, 1 per draw
+    _Atomic uint32_t virtual_loss;
+    _Atomic uint8_t state;          // NODE_STATE
+    uint8_t move;                   // Slot played to reach this node
+    uint8_t child_count;
+    bool terminal;                  // The move reaching this node won the game
+    uint32_t first_child;           // Children are allocated next to each other
+} MctsNode;
+
+// Bump allocator for nodes, reset before each search
+typedef struct {
+    MctsNode* nodes;
+    uint32_t capacity;
+    _Atomic uint32_t used;
+} MctsPool;
+
+typedef struct {
+    uint32_t playouts;  // Total budget over all threads, 0 for none
+    int time_ms;        // 0 for none
+    PLAYOUT_POLICY policy;
+} MctsLimits;
+
+typedef struct {
+    int move;           // Most visited root move (slot 0 to 11)
+    double win_rate;    // Expected result of that move for the player to move, from 0 to 1
+    uint32_t playouts;
+    uint32_t nodes;
+    double elapsed_ms;
+} MctsResult;
+
+// Shared state of a search
+typedef struct {
+    MctsPool* pool;
+    const Game* root_game;
+    MctsLimits limits;
+    struct timespec start;
+    _Atomic uint32_t playouts;
+} MctsSearch;
+
+int mcts_pool_init(MctsPool* pool, uint32_t capacity) {
+    pool->nodes = malloc(sizeof(MctsNode) * capacity);
+    if (!pool->nodes) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return -1;
+    }
+    pool->capacity = capacity;
+    atomic_init(&pool->used, 0);
+    return 0;
+}
+
+void mcts_pool_free(MctsPool* pool) {
+    free(pool->nodes);
+    pool->nodes = NULL;
+    pool->capacity = 0;
+}
+
+// Reserve count consecutive nodes, returns UINT32_MAX if the pool is full
+uint32_t mcts_pool_alloc(MctsPool* pool, uint32_t count) {
+    uint32_t first = atomic_fetch_add_explicit(&pool->used, count, memory_order_relaxed);
+    if (first + count > pool->capacity) {
+        return UINT32_MAX;
+    }
+    return first;
+}
+
+void mcts_node_init(MctsNode* node, int move) {
+    atomic_init(&node->visits, 0);
+    atomic_init(&node->reward, 0);
+    atomic_init(&node->virtual_loss, 0);
+    atomic_init(&node->state, NODE_LEAF);
+    node->move = (uint8_t) move;
+    node->child_count = 0;
+    node->terminal = false;
+    node->first_child = 0;
+}
+
+// xorshift64, each thread owns its state
+uint64_t mcts_random(uint64_t* state) {
+    uint64_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *state = x;
+}
+
+double mcts_elapsed_ms(const struct timespec* start) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) (now.tv_sec - start->tv_sec) * 1000.0 + (double) (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+// Captured seeds of the player whose turn it is in state
+int mcts_own_score(const Game* game, GAME_STATE state) {
+    return state == MOVE_PLAYER_0 ? game->score.player0 : game->score.player1;
+}
+
+/**
+ * @brief Plays a game out from a position.
+ *
+ * @param game The position, modified in place.
+ * @param policy How moves are picked.
+ * @param rng The random state of the calling thread.
+ *
+ * @return int The winner (0 or 1), or -1 for a draw.
+ */
+int mcts_playout(Game* game, PLAYOUT_POLICY policy, uint64_t* rng) {
+    for (int ply = 0; ply < MCTS_PLAYOUT_PLIES; ply++) {
+        int moves[6];
+        int count = list_moves(game, moves);
+        int player = game->current_state;
+        if (count == 0) {
+            return 1 - player;
+        }
+
+        int choice = moves[mcts_random(rng) % count];
+
+        if (policy == POLICY_LIGHT && (mcts_random(rng) & 1)) {
+            int best_gain = 0;
+            for (int i = 0; i < count; i++) {
+                Game next = *game;
+                if (play_turn(&next, moves[i])) {
+                    choice = moves[i];
+                    break;
+                }
+                int gain = mcts_own_score(&next, (GAME_STATE) player) - mcts_own_score(game, (GAME_STATE) player);
+                if (gain > best_gain) {
+                    best_gain = gain;
+                    choice = moves[i];
+                }
+            }
+        }
+
+        if (play_turn(game, choice)) {
+            return player;
+        }
+    }
+
+    if (game->score.player0 == game->score.player1) return -1;
+    return game->score.player0 > game->score.player1 ? 0 : 1;
+}
+
+// UCT value of a child seen from its parent, virtual losses count as visits without reward
+double mcts_uct(const MctsNode* child, double log_parent) {
+    uint32_t visits = atomic_load_explicit(&child->visits, memory_order_relaxed)
+                      + atomic_load_explicit(&child->virtual_loss, memory_order_relaxed);
+    if (visits == 0) {
+        return 1e9;
+    }
+    double reward = atomic_load_explicit(&child->reward, memory_order_relaxed) / 2.0;
+    return reward / visits + MCTS_EXPLORATION * sqrt(log_parent / visits);
+}
+
+// Create the children of a node, returns false if another thread is doing it or the pool is full
+bool mcts_expand(MctsSearch* search, MctsNode* node, const Game* game) {
+    uint8_t expected = NODE_LEAF;
+    if (!atomic_compare_exchange_strong(&node->state, &expected, NODE_EXPANDING)) {
+        return false;
+    }
+
+    int moves[6];
+    int count = list_moves(game, moves);
+    uint32_t first = count > 0 ? mcts_pool_alloc(search->pool, count) : UINT32_MAX;
+    if (first == UINT32_MAX) {
+        atomic_store(&node->state, NODE_LEAF);  // Keep it a leaf, playouts still run from it
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        MctsNode* child = &search->pool->nodes[first + i];
+        mcts_node_init(child, moves[i]);
+        Game next = *game;
+        child->terminal = play_turn(&next, moves[i]) == 1;
+    }
+    node->first_child = first;
+    node->child_count = (uint8_t) count;
+    atomic_store_explicit(&node->state, NODE_EXPANDED, memory_order_release);
+    return true;
+}
+
+// One selection / expansion / playout / backpropagation step
+void mcts_iterate(MctsSearch* search, uint64_t* rng) {
+    MctsNode* path[MCTS_MAX_DEPTH];
+    int movers[MCTS_MAX_DEPTH];
+    int length = 0;
+
+    Game game = *search->root_game;
+    MctsNode* node = &search->pool->nodes[0];
+    path[length] = node;
+    movers[length++] = -1;
+    int winner = -2;
+
+    // Selection, adding a virtual loss on the way down
+    while (length < MCTS_MAX_DEPTH) {
+        if (atomic_load_explicit(&node->state, memory_order_acquire) != NODE_EXPANDED) {
+            // Leaves are expanded on their second visit
+            if (atomic_load_explicit(&node->visits, memory_order_relaxed) == 0 || !mcts_expand(search, node, &game)) {
+                break;
+            }
+        }
+        if (node->child_count == 0) {
+            break;
+        }
+
+        uint32_t parent_visits = atomic_load_explicit(&node->visits, memory_order_relaxed) + 1;
+        double log_parent = log((double) parent_visits);
+        MctsNode* best = NULL;
+        double best_value = -1;
+        for (int i = 0; i < node->child_count; i++) {
+            MctsNode* child = &search->pool->nodes[node->first_child + i];
+            double value = mcts_uct(child, log_parent);
+            if (value > best_value) {
+                best_value = value;
+                best = child;
+            }
+        }
+
+        atomic_fetch_add_explicit(&best->virtual_loss, MCTS_VIRTUAL_LOSS, memory_order_relaxed);
+        int mover = game.current_state;
+        path[length] = best;
+        movers[length++] = mover;
+        node = best;
+
+        if (play_turn(&game, node->move)) {
+            winner = mover;
+            break;
+        }
+    }
+
+    if (winner == -2) {
+        winner = mcts_playout(&game, search->limits.policy, rng);
+    }
+
+    // Backpropagation, each node is rewarded for the player who moved into it
+    for (int i = 0; i < length; i++) {
+        uint32_t reward = winner < 0 ? 1 : (winner == movers[i] ? 2 : 0);
+        atomic_fetch_add_explicit(&path[i]->visits, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&path[i]->reward, reward, memory_order_relaxed);
+        if (i > 0) {
+            atomic_fetch_sub_explicit(&path[i]->virtual_loss, MCTS_VIRTUAL_LOSS, memory_order_relaxed);
+        }
+    }
+}
+
+bool mcts_should_stop(MctsSearch* search) {
+    if (search->limits.time_ms && mcts_elapsed_ms(&search->start) >= search->limits.time_ms) {
+        return true;
+    }
+    return false;
+}
+
+void* mcts_thread_main(void* arg) {
+    MctsSearch* search = arg;
+    uint64_t rng = 0x9E3779B97F4A7C15ull ^ (uint64_t) (uintptr_t) &rng;
+
+    while (true) {
+        uint32_t done = atomic_fetch_add_explicit(&search->playouts, 1, memory_order_relaxed);
+        if (search->limits.playouts && done >= search->limits.playouts) {
+            atomic_fetch_sub_explicit(&search->playouts, 1, memory_order_relaxed);
+            break;
+        }
+        if ((done & 63) == 0 && mcts_should_stop(search)) {
+            atomic_fetch_sub_explicit(&search->playouts, 1, memory_order_relaxed);
+            break;
+        }
+        mcts_iterate(search, &rng);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Runs a Monte Carlo Tree Search from a position.
+ *
+ * @param game The position to search.
+ * @param limits Playout budget and/or time limit (at least one should be set).
+ * @param pool Node pool, reset by this call. Full pools stop growing the tree but keep playing out.
+ * @param threads Number of threads running playouts, from 1 to MCTS_MAX_THREADS.
+ * @param result Filled with the most visited move.
+ *
+ * @return int Returns 0 on success, or -1 if the player to move has no move or the pool is too
+ * small for the root's children.
+ */
+int mcts_search(const Game* game, const MctsLimits* limits, MctsPool* pool, int threads, MctsResult* result) {
+    int moves[6];
+    if (list_moves(game, moves) == 0 || pool->capacity == 0) {
+        return -1;
+    }
+    if (threads < 1) threads = 1;
+    if (threads > MCTS_MAX_THREADS) threads = MCTS_MAX_THREADS;
+
+    MctsSearch search;
+    search.pool = pool;
+    search.root_game = game;
+    search.limits = *limits;
+    atomic_init(&search.playouts, 0);
+    clock_gettime(CLOCK_MONOTONIC, &search.start);
+
+    atomic_store(&pool->used, 1);
+    MctsNode* root = &pool->nodes[0];
+    mcts_node_init(root, MCTS_NO_MOVE);
+    atomic_store(&root->visits, 1);
+    mcts_expand(&search, root, game);
+    if (root->child_count == 0) {
+        return -1;  // The pool cannot even hold the root's children
+    }
+
+    pthread_t workers[MCTS_MAX_THREADS];
+    int started = 1;
+    for (; started < threads; started++) {
+        if (pthread_create(&workers[started], NULL, mcts_thread_main, &search)) {
+            break;
+        }
+    }
+    mcts_thread_main(&search);
+    for (int i = 1; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    // Most visited child is the most robust choice
+    const MctsNode* best = NULL;
+    for (int i = 0; i < root->child_count; i++) {
+        const MctsNode* child = &pool->nodes[root->first_child + i];
+        if (!best || child->visits > best->visits || (child->terminal && !best->terminal)) {
+            best = child;
+            if (child->terminal) break;
+        }
+    }
+
+    result->move = best->move;
+    result->win_rate = best->visits ? best->reward / (2.0 * best->visits) : 0.5;
+    result->playouts = atomic_load(&search.playouts);
+    uint32_t used = atomic_load(&pool->used);
+    result->nodes = used < pool->capacity ? used : pool->capacity;
+    result->elapsed_ms = mcts_elapsed_ms(&search.start);
+    return 0;
+}
+
+#endif //AWALEGAME_MCTS_H
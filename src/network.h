@@ -8,10 +8,28 @@
 #define AWALEGAME_REQUEST_H
 
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <errno.h>
+#include <stdint.h>
+#include <poll.h>
+
+#include "binary.h"
+#include "json_writer.h"
+#include "json_reader.h"
 
 #define BUFFER_SIZE 1024
 #define PORT_NO 3001
 #define MAX_ARG_LENGTH 255
+#define MAX_ARGS 4  // The last one is only used by GAME, and left out of messages when empty
+#define FRAME_HEADER_SIZE 8  // Length, then correlation ID
+#define MAX_FRAME_SIZE (16 * 1024 * 1024)  // Larger lengths can only come from a broken or hostile peer
+#define MAX_REQUEST_SIZE (8 * 1024)         // Largest frame a server accepts, requests hold a few names
+#define SEND_TIMEOUT_MS 5000                // A peer not reading for this long is given up on
+#define MAX_QUEUED_BYTES (64 * 1024)         // Output waiting for a slow peer, see queue_is_full
+#define MAX_WRITE_PARTS 64                  // Parts of the output queue written by one system call
 
 typedef enum {
     LOGIN,      // Log in
@@ -21,20 +39,36 @@ typedef enum {
     DECLINE,    // Decline a challenge request
     GAME,       // Retrieve a game
     LIST_GAMES, // Retrieve all user's games
-    MOVE        // Make a move within a game
+    MOVE,       // Make a move within a game
+    ANALYZE,    // Engine evaluation of the current position of a game
+    WATCH,      // Retrieve a game and receive it again after every move
+    WAIT_FOR_MOVE, // Reply once a game has moved past a given version
+    GAMES_BATCH,   // Retrieve several games of a player at once
+    SPECTATE       // Follow the game of two other players
 } ACTION;
 
+// Encoding of the messages of a connection, JSON until the client asks for binary at LOGIN
+typedef enum {
+    PROTOCOL_JSON,
+    PROTOCOL_BINARY
+} PROTOCOL;
+
+#define PROTOCOL_BINARY_NAME "binary"  // LOGIN argument asking for it, and the server's reply accepting it
+#define NOT_MODIFIED_NAME "\"not_modified\""  // JSON reply (a string) when the client already has the latest version of a game
+
 typedef struct {
     ACTION action;
-    char arguments[3][MAX_ARG_LENGTH];
+    char arguments[MAX_ARGS][MAX_ARG_LENGTH];
+    uint32_t id;  // Correlation ID, carried by the frame and copied into the response
 } Request;
 
 Request empty_request() {
     Request req;
+    req.id = 0;
     req.action = LOGIN;
-    strcpy(req.arguments[0], "");
-    strcpy(req.arguments[1], "");
-    strcpy(req.arguments[2], "");
+    for (int i = 0; i < MAX_ARGS; i++) {
+        strcpy(req.arguments[i], "");
+    }
     return req;
 }
 
@@ -48,6 +82,11 @@ const char* action_to_string(ACTION action) {
         case GAME: return "GAME";
         case LIST_GAMES: return "LIST_GAMES";
         case MOVE: return "MOVE";
+        case ANALYZE: return "ANALYZE";
+        case WATCH: return "WATCH";
+        case WAIT_FOR_MOVE: return "WAIT_FOR_MOVE";
+        case GAMES_BATCH: return "GAMES_BATCH";
+        case SPECTATE: return "SPECTATE";
         default: return NULL;
     }
 }
@@ -69,6 +108,16 @@ int string_to_action(const char* action_str, ACTION* action) {
         *action = LIST_GAMES;
     else if (strcmp(action_str, "MOVE") == 0)
         *action = MOVE;
+    else if (strcmp(action_str, "ANALYZE") == 0)
+        *action = ANALYZE;
+    else if (strcmp(action_str, "WATCH") == 0)
+        *action = WATCH;
+    else if (strcmp(action_str, "WAIT_FOR_MOVE") == 0)
+        *action = WAIT_FOR_MOVE;
+    else if (strcmp(action_str, "GAMES_BATCH") == 0)
+        *action = GAMES_BATCH;
+    else if (strcmp(action_str, "SPECTATE") == 0)
+        *action = SPECTATE;
     else
         return -1;
     return 0;
@@ -83,7 +132,7 @@ void print_request(const Request* request) {
     printf("Request:\n");
     printf("  Action: %s\n", action_to_string(request->action));
     printf("  Arguments:\n");
-    for (int i = 0; i < 3; i++) {
+    for (int i = 0; i < MAX_ARGS; i++) {
         printf("    [%d]: %s\n", i, request->arguments[i]);
     }
 }
@@ -110,15 +159,17 @@ char* request_to_json(const Request* request) {
     // Add the action as a string
     cJSON_AddStringToObject(json_request, "action", action_to_string(request->action));
 
-    // Add the arguments as a JSON array
+    // Add the arguments as a JSON array, always the first three as servers before the fourth expect
+    int count = MAX_ARGS;
+    while (count > 3 && request->arguments[count - 1][0] == '\0') count--;
     cJSON* json_arguments = cJSON_CreateArray();
-    for (int i = 0; i < 3; i++) {
+    for (int i = 0; i < count; i++) {
         cJSON_AddItemToArray(json_arguments, cJSON_CreateString(request->arguments[i]));
     }
     cJSON_AddItemToObject(json_request, "arguments", json_arguments);
 
     // Convert the JSON object to a string
-    char* json_string = cJSON_Print(json_request);
+    char* json_string = cJSON_PrintUnformatted(json_request);
 
     // Free the JSON object (but keep the string)
     cJSON_Delete(json_request);
@@ -126,8 +177,9 @@ char* request_to_json(const Request* request) {
     return json_string;
 }
 
-// Function to parse JSON into a Request struct - returned value indicates error
-int json_to_request(const char* json_string, Request* request) {
+// Function to parse JSON into a Request struct with cJSON - returned value indicates error.
+// Reference for json_to_request, which awale_bench decode checks against it
+int cjson_to_request(const char* json_string, Request* request) {
     if (!json_string || !request) {
         return -1;  // Invalid input
     }
@@ -162,10 +214,11 @@ int json_to_request(const char* json_string, Request* request) {
     }
 
     // Fill the arguments array in the struct
-    for (int i = 0; i < 3; i++) {
+    for (int i = 0; i < MAX_ARGS; i++) {
         cJSON* argument_item = cJSON_GetArrayItem(arguments_array, i);
         if (cJSON_IsString(argument_item) && argument_item->valuestring) {
-            strncpy(request->arguments[i], argument_item->valuestring, MAX_ARG_LENGTH);
+            strncpy(request->arguments[i], argument_item->valuestring, MAX_ARG_LENGTH - 1);
+            request->arguments[i][MAX_ARG_LENGTH - 1] = '\0';
         } else {
             request->arguments[i][0] = '\0';  // Empty string for missing/invalid items
         }
@@ -177,138 +230,956 @@ int json_to_request(const char* json_string, Request* request) {
     return 0;  // Success
 }
 
-// Receive a JSON string from a socket
-int receive_request(int socket_from, Request* req) {
-    char buffer[BUFFER_SIZE];
-    memset(buffer, 0, BUFFER_SIZE);
+// Fill the arguments of a request from their JSON array, missing or invalid ones are empty strings
+void json_read_arguments(JsonReader* reader, Request* request) {
+    int count = 0;
+    bool first = true;
+    json_read_begin(reader, '[');
+    while (json_read_next(reader, ']', &first)) {
+        if (count < MAX_ARGS && json_peek(reader) == JSON_STRING) {
+            json_read_string(reader, request->arguments[count], MAX_ARG_LENGTH, NULL);
+        } else {
+            if (count < MAX_ARGS) request->arguments[count][0] = '\0';
+            json_read_skip(reader);
+        }
+        count++;
+    }
+    for (int i = count; i < MAX_ARGS; i++) {
+        request->arguments[i][0] = '\0';
+    }
+}
+
+/**
+ * @brief Parses JSON into a Request in one pass, without building a cJSON tree or allocating.
+ *
+ * @details Gives the same results as cjson_to_request on any input: the first "action" and
+ * "arguments" members count, and arguments longer than MAX_ARG_LENGTH - 1 bytes are cut.
+ *
+ * @param json_string The message, it ends at its first null byte.
+ * @param length Length of the message.
+ * @param request Filled with the action and arguments.
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ */
+int json_to_request(const char* json_string, size_t length, Request* request) {
+    if (!json_string || !request) {
+        return -1;  // Invalid input
+    }
+
+    JsonReader reader;
+    json_reader_init(&reader, json_string, length);
+    char action[MAX_ARG_LENGTH];
+    bool action_longer = false;
+    JSON_TYPE action_type = JSON_INVALID, arguments_type = JSON_INVALID;
+    if (json_peek(&reader) == JSON_OBJECT) {
+        char key[16];
+        bool longer, first = true;
+        json_read_begin(&reader, '{');
+        while (json_read_next(&reader, '}', &first) && json_read_key(&reader, key, sizeof(key), &longer)) {
+            if (!longer && strcmp(key, "action") == 0 && action_type == JSON_INVALID) {
+                action_type = json_peek(&reader);
+                if (action_type == JSON_STRING) {
+                    json_read_string(&reader, action, sizeof(action), &action_longer);
+                } else {
+                    json_read_skip(&reader);
+                }
+            } else if (!longer && strcmp(key, "arguments") == 0 && arguments_type == JSON_INVALID) {
+                arguments_type = json_peek(&reader);
+                if (arguments_type == JSON_ARRAY) {
+                    json_read_arguments(&reader, request);
+                } else {
+                    json_read_skip(&reader);
+                }
+            } else {
+                json_read_skip(&reader);
+            }
+        }
+    } else {
+        json_read_skip(&reader);
+    }
+
+    if (reader.error) {
+        fprintf(stderr, "Error: Failed to parse JSON\n");
+        return -1;
+    }
+    if (action_type != JSON_STRING) {
+        fprintf(stderr, "Error: 'action' field is missing or invalid\n");
+        return -1;
+    }
+    if (action_longer || string_to_action(action, &request->action)) {
+        fprintf(stderr, "Error: 'action' field does not match the ACTION enum\n");
+        return -1;
+    }
+    if (arguments_type != JSON_ARRAY) {
+        fprintf(stderr, "Error: 'arguments' field is missing or invalid\n");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Every message, in both directions, is a frame: its length and a correlation ID as 4 bytes
+ * each in network byte order, then that many bytes. A response carries the ID of its request,
+ * so a client can send several requests without waiting and match the responses, which may come
+ * back in another order. Messages the server sends on its own (pushes) have ID 0, request IDs
+ * start at 1. A recv can return part of a frame or several of them, so each connection keeps
+ * the bytes received but not yet consumed.
+ */
+
+// A response received before the one being waited for
+typedef struct PendingFrame {
+    uint32_t id;
+    char* data;
+    size_t length;
+    struct PendingFrame* next;
+} PendingFrame;
+
+// Frame encoded once and sent to many connections, like the changes of a move pushed to everyone
+// following the game. Every queue holding it has a reference, the last one released frees it
+typedef struct {
+    int references;
+    size_t length;   // Header included
+    char data[];     // Frame header, then the message
+} SharedFrame;
+
+// Part of what is left to send on a connection: a shared frame, or if frame is NULL the next
+// length bytes of the connection's own output
+typedef struct {
+    SharedFrame* frame;
+    size_t length;
+} QueuedOutput;
+
+typedef struct {
+    int socket;
+    PROTOCOL protocol;
+    char* buffer;     // Received bytes, the next frame starts at buffer + start
+    size_t start;
+    size_t length;    // Bytes after start
+    size_t capacity;
+    uint32_t next_id;           // Last ID given to a request sent on this connection
+    PendingFrame* pending;      // Responses received out of order, oldest first
+    JsonWriter json;            // Reused for every JSON response, see send_json
+    size_t max_frame;           // Largest frame accepted from the peer, see take_frame
+    bool deferred;              // Frames are queued and written by flush_queue instead of sent at once
+    QueuedOutput* queue;        // Ring of what is left to send, oldest first from queue_start
+    int queue_start;
+    int queue_count;
+    int queue_capacity;
+    size_t queue_offset;        // Bytes of the oldest part already sent
+    size_t queued_bytes;        // Bytes of the queue not sent yet
+    char* output;               // Frames written for this connection only, not sent yet from output_start
+    size_t output_start;
+    size_t output_length;
+    size_t output_capacity;
+    size_t bytes_sent;          // Since the connection opened, tells a slow peer from one not reading at all
+} Connection;
+
+void connection_init(Connection* conn, int socket) {
+    conn->socket = socket;
+    conn->protocol = PROTOCOL_JSON;
+    conn->buffer = NULL;
+    conn->start = 0;
+    conn->length = 0;
+    conn->capacity = 0;
+    conn->next_id = 0;
+    conn->pending = NULL;
+    json_writer_init(&conn->json);
+    conn->max_frame = MAX_FRAME_SIZE;
+    conn->deferred = false;
+    conn->queue = NULL;
+    conn->queue_start = conn->queue_count = conn->queue_capacity = 0;
+    conn->queue_offset = conn->queued_bytes = 0;
+    conn->output = NULL;
+    conn->output_start = conn->output_length = conn->output_capacity = 0;
+    conn->bytes_sent = 0;
+}
+
+void shared_frame_release(SharedFrame* frame) {
+    if (frame && --frame->references == 0) {
+        free(frame);
+    }
+}
+
+QueuedOutput* queued_part(const Connection* conn, int i) {
+    return &conn->queue[(conn->queue_start + i) % conn->queue_capacity];
+}
+
+// Removes the oldest part of the queue once it is sent
+void pop_queue(Connection* conn) {
+    QueuedOutput* part = queued_part(conn, 0);
+    if (part->frame) {
+        shared_frame_release(part->frame);
+    } else {
+        conn->output_start += part->length;
+        if (conn->output_start == conn->output_length) {
+            conn->output_start = conn->output_length = 0;
+        }
+    }
+    conn->queue_start = (conn->queue_start + 1) % conn->queue_capacity;
+    conn->queue_count--;
+    conn->queue_offset = 0;
+}
+
+// Adds a part at the end of the queue, which grows as needed. Returns 0 on success or -1 on failure
+int push_queue(Connection* conn, SharedFrame* frame, size_t length) {
+    if (conn->queue_count == conn->queue_capacity) {
+        int capacity = conn->queue_capacity ? conn->queue_capacity * 2 : 16;
+        QueuedOutput* queue = malloc(capacity * sizeof(QueuedOutput));
+        if (!queue) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            return -1;
+        }
+        for (int i = 0; i < conn->queue_count; i++) {
+            queue[i] = *queued_part(conn, i);
+        }
+        free(conn->queue);
+        conn->queue = queue;
+        conn->queue_start = 0;
+        conn->queue_capacity = capacity;
+    }
+    QueuedOutput* part = &conn->queue[(conn->queue_start + conn->queue_count) % conn->queue_capacity];
+    part->frame = frame;
+    part->length = length;
+    conn->queue_count++;
+    conn->queued_bytes += length;
+    return 0;
+}
+
+// Whether enough is waiting to be sent that the connection should not be given more: its requests
+// are left unread and the pushes for it are replaced by a whole game
+bool queue_is_full(const Connection* conn) {
+    return conn->queued_bytes >= MAX_QUEUED_BYTES;
+}
+
+// Drops the shared frames not started, the pushes: the connection's own frames are responses, and
+// a frame sent in part must be finished or the peer loses track of where the next one begins
+void drop_shared_frames(Connection* conn) {
+    int count = 0;
+    for (int i = 0; i < conn->queue_count; i++) {
+        QueuedOutput part = *queued_part(conn, i);
+        if (part.frame && !(i == 0 && conn->queue_offset > 0)) {
+            shared_frame_release(part.frame);
+            conn->queued_bytes -= part.length;
+            continue;
+        }
+        *queued_part(conn, count++) = part;
+    }
+    conn->queue_count = count;
+    if (count == 0) {
+        conn->queue_offset = 0;
+    }
+}
+
+// Frees the buffers of a connection, the socket is left open
+void connection_free(Connection* conn) {
+    free(conn->buffer);
+    conn->buffer = NULL;
+    conn->start = conn->length = conn->capacity = 0;
+    while (conn->pending) {
+        PendingFrame* next = conn->pending->next;
+        free(conn->pending->data);
+        free(conn->pending);
+        conn->pending = next;
+    }
+    json_writer_free(&conn->json);
+    while (conn->queue_count > 0) {
+        pop_queue(conn);
+    }
+    free(conn->queue);
+    free(conn->output);
+    connection_init(conn, conn->socket);
+}
+
+// Frames are written whole (see send_frame), so waiting to coalesce them only delays pipelined responses
+void set_no_delay(int socket) {
+    int enable = 1;
+    if (setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable)) < 0) {
+        perror("Error setting TCP_NODELAY");
+    }
+}
+
+// Send the whole buffer, send can write less than asked. Non-blocking sockets wait until writable
+int send_all(int socket, const char* data, size_t length, int flags) {
+    while (length > 0) {
+        ssize_t bytes_sent = send(socket, data, length, flags | MSG_NOSIGNAL);
+        if (bytes_sent < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                struct pollfd writable = {socket, POLLOUT, 0};
+                if (poll(&writable, 1, SEND_TIMEOUT_MS) > 0) continue;
+                fprintf(stderr, "Error: Peer is not reading, giving up sending\n");
+                return -1;
+            }
+            perror("Error sending data");
+            return -1;
+        }
+        data += bytes_sent;
+        length -= bytes_sent;
+    }
+    return 0;
+}
+
+/**
+ * @brief Adds a shared frame to what is left to send on a connection, without copying it.
+ *
+ * @param conn The connection.
+ * @param frame The frame, which gets one more reference.
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ */
+int queue_frame(Connection* conn, SharedFrame* frame) {
+    if (push_queue(conn, frame, frame->length)) {
+        return -1;
+    }
+    frame->references++;
+    return 0;
+}
 
-    // Receive data from the socket_from
-    ssize_t bytes_received = recv(socket_from, buffer, BUFFER_SIZE - 1, 0);
-    if (bytes_received < 0) {
-        perror("Error receiving data");
+// Copies a frame to the end of the connection's own output. Frames following each other there make
+// a single part of the queue
+int queue_output(Connection* conn, uint32_t id, const char* data, size_t length) {
+    size_t size = FRAME_HEADER_SIZE + length;
+    if (conn->output_length + size > conn->output_capacity && conn->output_start > 0) {
+        // Move the bytes not sent yet to the front before growing, the queue only holds their lengths
+        memmove(conn->output, conn->output + conn->output_start, conn->output_length - conn->output_start);
+        conn->output_length -= conn->output_start;
+        conn->output_start = 0;
+    }
+    if (conn->output_length + size > conn->output_capacity) {
+        size_t capacity = conn->output_capacity ? conn->output_capacity * 2 : BUFFER_SIZE;
+        while (capacity < conn->output_length + size) capacity *= 2;
+        char* output = realloc(conn->output, capacity);
+        if (!output) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            return -1;
+        }
+        conn->output = output;
+        conn->output_capacity = capacity;
+    }
+
+    QueuedOutput* last = conn->queue_count > 0 ? queued_part(conn, conn->queue_count - 1) : NULL;
+    if (last && !last->frame) {
+        last->length += size;
+        conn->queued_bytes += size;
+    } else if (push_queue(conn, NULL, size)) {
         return -1;
-    } else if (bytes_received == 0) {
-        printf("Connection closed by peer\n");
+    }
+    uint32_t header[2] = {htonl((uint32_t) length), htonl(id)};
+    memcpy(conn->output + conn->output_length, header, FRAME_HEADER_SIZE);
+    memcpy(conn->output + conn->output_length + FRAME_HEADER_SIZE, data, length);
+    conn->output_length += size;
+    return 0;
+}
+
+/**
+ * @brief Sends as much of the queue as the socket takes without waiting, up to MAX_WRITE_PARTS
+ * parts in each system call.
+ *
+ * @param conn The connection.
+ *
+ * @return int Returns 0 on success, even if some is left for later, or -1 on failure.
+ */
+int flush_queue(Connection* conn) {
+    while (conn->queue_count > 0) {
+        struct iovec parts[MAX_WRITE_PARTS];
+        int count = 0;
+        size_t output = conn->output_start;
+        for (int i = 0; i < conn->queue_count && count < MAX_WRITE_PARTS; i++, count++) {
+            const QueuedOutput* part = queued_part(conn, i);
+            char* data = part->frame ? part->frame->data : conn->output + output;
+            size_t skip = i == 0 ? conn->queue_offset : 0;
+            if (!part->frame) output += part->length;
+            parts[count].iov_base = data + skip;
+            parts[count].iov_len = part->length - skip;
+        }
+
+        struct msghdr message = {.msg_iov = parts, .msg_iovlen = count};
+        ssize_t bytes_sent = sendmsg(conn->socket, &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if (bytes_sent < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) return 0;
+            perror("Error sending data");
+            return -1;
+        }
+        conn->bytes_sent += bytes_sent;
+        conn->queued_bytes -= bytes_sent;
+        size_t left = (size_t) bytes_sent;
+        while (left > 0) {
+            size_t rest = queued_part(conn, 0)->length - conn->queue_offset;
+            if (left < rest) {
+                conn->queue_offset += left;
+                break;
+            }
+            left -= rest;
+            pop_queue(conn);
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Sends one message as a frame.
+ *
+ * @param conn The connection.
+ * @param id The correlation ID: a new one for a request, the request's one for a response.
+ * @param data The message, not necessarily null-terminated.
+ * @param length Its length in bytes, at most MAX_FRAME_SIZE.
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details On a deferred connection the frame is only queued, see flush_queue.
+ */
+int send_frame(Connection* conn, uint32_t id, const char* data, size_t length) {
+    if (length > MAX_FRAME_SIZE) {
+        fprintf(stderr, "Error: Message of %zu bytes is too large to send\n", length);
         return -1;
     }
+    if (conn->deferred) {
+        return queue_output(conn, id, data, length);
+    }
 
-    // Allocate memory for the received JSON string
-    char *json_string = (char *) malloc(bytes_received + 1);
-    if (!json_string) {
-        fprintf(stderr, "Memory allocation failed\n");
+    // MSG_MORE keeps the header and the message in the same packet
+    uint32_t header[2] = {htonl((uint32_t) length), htonl(id)};
+    if (send_all(conn->socket, (const char*) header, FRAME_HEADER_SIZE, length ? MSG_MORE : 0)) {
         return -1;
     }
+    return send_all(conn->socket, data, length, 0);
+}
 
-    // Copy the received data into the allocated memory and null-terminate it
-    strncpy(json_string, buffer, bytes_received);
-    json_string[bytes_received] = '\0';
+// Send a null-terminated string as a frame
+int send_string(Connection* conn, uint32_t id, const char* string) {
+    return send_frame(conn, id, string, strlen(string));
+}
 
-//    printf("JSON Received: %s\n", json_string);
+/**
+ * @brief Takes the next whole frame out of the bytes already received, without reading the socket.
+ *
+ * @param conn The connection.
+ * @param id Set to the correlation ID of the message if not NULL.
+ * @param length Set to the length of the message if not NULL.
+ * @param invalid Set to true if the next frame can never be valid (the connection must be closed).
+ *
+ * @return char* The message, null-terminated (to be freed), or NULL if it is not complete yet.
+ */
+char* take_frame(Connection* conn, uint32_t* id, size_t* length, bool* invalid) {
+    *invalid = false;
+    if (conn->length < FRAME_HEADER_SIZE) {
+        return NULL;
+    }
 
-    // Form request object from JSON string
-    if (json_to_request(json_string, req)) {
-        perror("Error forming Request object from retrieved JSON\n");
-        free(json_string);
+    uint32_t header[2];
+    memcpy(header, conn->buffer + conn->start, FRAME_HEADER_SIZE);
+    size_t size = ntohl(header[0]);
+    if (size > conn->max_frame) {
+        fprintf(stderr, "Error: Received a frame of %zu bytes\n", size);
+        *invalid = true;
+        return NULL;
+    }
+    if (conn->length < FRAME_HEADER_SIZE + size) {
+        return NULL;
+    }
+
+    char* message = malloc(size + 1);
+    if (!message) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        *invalid = true;
+        return NULL;
+    }
+    memcpy(message, conn->buffer + conn->start + FRAME_HEADER_SIZE, size);
+    message[size] = '\0';
+    conn->start += FRAME_HEADER_SIZE + size;
+    conn->length -= FRAME_HEADER_SIZE + size;
+    if (conn->length == 0) conn->start = 0;
+    if (id) *id = ntohl(header[1]);
+    if (length) *length = size;
+    return message;
+}
+
+/**
+ * @brief Reads from the socket into the reassembly buffer, making room for the frame in progress.
+ *
+ * @param conn The connection.
+ *
+ * @return ssize_t The number of bytes read, 0 if the peer closed the connection, or -1 on error
+ * (errno is EAGAIN when a non-blocking socket has nothing to read).
+ */
+ssize_t fill_buffer(Connection* conn) {
+    // A frame longer than the connection accepts is not made room for, take_frame rejects it
+    size_t needed = FRAME_HEADER_SIZE;
+    if (conn->length >= FRAME_HEADER_SIZE) {
+        uint32_t size;
+        memcpy(&size, conn->buffer + conn->start, sizeof(size));
+        if (ntohl(size) <= conn->max_frame) {
+            needed += ntohl(size);
+        }
+    }
+
+    // Move what is left of the frame to the front, and grow the buffer if it cannot hold it
+    if (conn->start > 0) {
+        memmove(conn->buffer, conn->buffer + conn->start, conn->length);
+        conn->start = 0;
+    }
+    if (conn->capacity < needed || conn->capacity - conn->length < BUFFER_SIZE / 4) {
+        size_t capacity = conn->capacity ? conn->capacity * 2 : BUFFER_SIZE;
+        while (capacity < needed) capacity *= 2;
+        char* buffer = realloc(conn->buffer, capacity);
+        if (!buffer) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            errno = ENOMEM;
+            return -1;
+        }
+        conn->buffer = buffer;
+        conn->capacity = capacity;
+    }
+
+    ssize_t bytes_received;
+    do {
+        bytes_received = recv(conn->socket, conn->buffer + conn->length, conn->capacity - conn->length, 0);
+    } while (bytes_received < 0 && errno == EINTR);
+    if (bytes_received > 0) {
+        conn->length += bytes_received;
+    }
+    return bytes_received;
+}
+
+/**
+ * @brief Receives the next message of a connection, reading from its socket only when the
+ * buffered bytes do not hold a whole frame.
+ *
+ * @param conn The connection, with a blocking socket.
+ * @param id Set to the correlation ID of the message if not NULL.
+ * @param length Set to the length of the message if not NULL.
+ *
+ * @return char* The message, null-terminated (to be freed), or NULL if the connection was closed
+ * or sent an invalid frame.
+ */
+char* receive_frame(Connection* conn, uint32_t* id, size_t* length) {
+    while (true) {
+        bool invalid;
+        char* message = take_frame(conn, id, length, &invalid);
+        if (message || invalid) {
+            return message;
+        }
+
+        ssize_t bytes_received = fill_buffer(conn);
+        if (bytes_received < 0) {
+            perror("Error receiving data");
+            return NULL;
+        } else if (bytes_received == 0) {
+            printf("Connection closed by peer\n");
+            return NULL;
+        }
+    }
+}
+
+/**
+ * @brief Receives the response to a request, keeping the responses to other requests that
+ * arrive first for later calls.
+ *
+ * @param conn The connection.
+ * @param id The correlation ID of the request.
+ * @param length Set to the length of the response if not NULL.
+ *
+ * @return char* The response, null-terminated (to be freed), or NULL if the connection failed.
+ */
+char* receive_response(Connection* conn, uint32_t id, size_t* length) {
+    for (PendingFrame** link = &conn->pending; *link; link = &(*link)->next) {
+        PendingFrame* frame = *link;
+        if (frame->id == id) {
+            char* data = frame->data;
+            if (length) *length = frame->length;
+            *link = frame->next;
+            free(frame);
+            return data;
+        }
+    }
+
+    while (true) {
+        uint32_t received_id;
+        size_t received_length = 0;
+        char* data = receive_frame(conn, &received_id, &received_length);
+        if (!data || received_id == id) {
+            if (length) *length = received_length;
+            return data;
+        }
+
+        PendingFrame* frame = malloc(sizeof(PendingFrame));
+        if (!frame) {
+            fprintf(stderr, "Error: Memory allocation failed\n");
+            free(data);
+            return NULL;
+        }
+        frame->id = received_id;
+        frame->data = data;
+        frame->length = received_length;
+        frame->next = NULL;
+        PendingFrame** tail = &conn->pending;
+        while (*tail) tail = &(*tail)->next;
+        *tail = frame;
+    }
+}
+
+/*
+ * Binary request: the action as one byte, then the arguments as strings. Trailing empty
+ * arguments are left out, so most requests take a few bytes plus the names.
+ */
+void encode_request(const Request* request, BinaryWriter* writer) {
+    int count = MAX_ARGS;
+    while (count > 0 && request->arguments[count - 1][0] == '\0') count--;
+
+    write_byte(writer, (uint8_t) request->action);
+    for (int i = 0; i < count; i++) {
+        write_string(writer, request->arguments[i]);
+    }
+}
+
+// Returns 0 on success, or -1 if the message is not a valid request
+int decode_request(const char* data, size_t length, Request* request) {
+    BinaryReader reader;
+    reader_init(&reader, data, length);
+
+    uint8_t action = read_byte(&reader);
+    if (reader.error || action_to_string((ACTION) action) == NULL) {
+        fprintf(stderr, "Error: Invalid action in binary request\n");
         return -1;
     }
+    request->action = (ACTION) action;
 
-    free(json_string);
+    for (int i = 0; i < MAX_ARGS; i++) {
+        request->arguments[i][0] = '\0';
+        if (!reader_done(&reader)) {
+            read_string(&reader, request->arguments[i], MAX_ARG_LENGTH);
+        }
+    }
+    if (reader.error || !reader_done(&reader)) {
+        fprintf(stderr, "Error: Invalid arguments in binary request\n");
+        return -1;
+    }
     return 0;
 }
 
-// Send a Request to a socket
-int send_request(int socket_to, const Request* req) {
+// Form a Request from a received message, in the protocol of the connection
+int parse_request(const Connection* conn, const char* message, size_t length, Request* req) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        return decode_request(message, length, req);
+    }
+
+//    printf("JSON Received: %s\n", message);
+
+    // Form request object from JSON string
+    if (json_to_request(message, length, req)) {
+        fprintf(stderr, "Error forming Request object from retrieved JSON\n");
+        return -1;
+    }
+    return 0;
+}
+
+// Receive a Request from a connection
+int receive_request(Connection* conn, Request* req) {
+    size_t length;
+    char* message = receive_frame(conn, &req->id, &length);
+    if (!message) {
+        return -1;
+    }
+
+    int result = parse_request(conn, message, length, req);
+    free(message);
+    return result;
+}
+
+// Send a Request to a connection, giving it a new correlation ID to wait for its response with
+int send_request(Connection* conn, Request* req) {
+    req->id = ++conn->next_id;
+
 //    printf("Sending %s request\n", action_to_string(req->action));
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        encode_request(req, &writer);
+        int result = writer.error ? -1 : send_frame(conn, req->id, (const char*) writer.data, writer.length);
+        writer_free(&writer);
+        return result;
+    }
+
     char* json = request_to_json(req);
 
     if (json == NULL) {
-        perror("Error converting to json\n");
+        fprintf(stderr, "Error converting to json\n");
         return -1;
     }
 
 //    printf("JSON to send: %s\n", json);
 
-    // Send the serialized request over the socket_to
-    ssize_t bytes_sent = send(socket_to, json, strlen(json), 0);
+    // Send the serialized request over the connection
+    int result = send_string(conn, req->id, json);
     free(json);  // Free the json string regardless of success or failure
-    if (bytes_sent < 0) {
-        perror("Error sending data\n");
-        return -1;
+    return result;
+}
+
+// Read response to a request (intended to be used to read responses from server) - returned value must be freed
+char* read_response(Connection* conn, uint32_t id) {
+    return receive_response(conn, id, NULL);
+}
+
+// Send a binary message built with a BinaryWriter, which is freed
+int send_writer(Connection* conn, uint32_t id, BinaryWriter* writer) {
+    int result = -1;
+    if (writer->error) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+    } else {
+        result = send_frame(conn, id, (const char*) writer->data, writer->length);
     }
-    return 0;
+    writer_free(writer);
+    return result;
 }
 
-// Read response (intended to be used to read responses from server) - returned value must be freed
-char* read_response(int socket) {
-    char buffer[BUFFER_SIZE];  // Temporary buffer for reading
-    char *result = NULL;       // Pointer to hold the full string
-    size_t result_size = 0;    // Size of the dynamically allocated result buffer
-    ssize_t bytes_received;
+// Reply to a request with success or failure: "true"/"false" in JSON, a single tag byte in binary
+int send_bool(Connection* conn, uint32_t id, bool value) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        uint8_t tag = value ? BINARY_TRUE : BINARY_FALSE;
+        return send_frame(conn, id, (const char*) &tag, 1);
+    }
+    return send_string(conn, id, value ? "true" : "false");
+}
 
-    while ((bytes_received = recv(socket, buffer, BUFFER_SIZE - 1, 0)) > 0) {
-        buffer[bytes_received] = '\0';  // Null-terminate the chunk
+// Send the JSON text built in the connection's writer. The writer replaces a cJSON tree and
+// its printed copy, two allocations per value, by a buffer which stops growing after a few messages
+int send_json(Connection* conn, uint32_t id) {
+    if (conn->json.error) {
+        fprintf(stderr, "Error: Failed to serialize JSON\n");
+        return -1;
+    }
+    return send_frame(conn, id, conn->json.data, conn->json.length);
+}
 
-        // Allocate or expand memory for the result buffer
-        char *new_result = realloc(result, result_size + bytes_received + 1);
-        if (!new_result) {
-            perror("realloc failed\n");
-            free(result);
-            return NULL;
+// Reply with a list of player names: a JSON array of strings, or a count and the strings in binary
+int send_names(Connection* conn, uint32_t id, const char* const* names, int count) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        write_byte(&writer, BINARY_NAMES);
+        write_varint(&writer, count);
+        for (int i = 0; i < count; i++) {
+            write_string(&writer, names[i]);
         }
-        result = new_result;
+        return send_writer(conn, id, &writer);
+    }
 
-        // Append the received chunk to the result buffer
-        memcpy(result + result_size, buffer, bytes_received + 1);
-        result_size += bytes_received;
+    json_reset(&conn->json);
+    json_write_names(&conn->json, names, count);
+    return send_json(conn, id);
+}
 
-        // Optional: Stop reading if you detect a termination condition
-        if (strchr(buffer, '\0')) {  // If a null terminator is received, stop
-            break;
+// Reply with the state of a game
+int send_game(Connection* conn, uint32_t id, const Game* game) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        write_byte(&writer, BINARY_GAME);
+        write_game(&writer, game);
+        return send_writer(conn, id, &writer);
+    }
+
+    json_reset(&conn->json);
+    json_write_game(&conn->json, game);
+    return send_json(conn, id);
+}
+
+// Send several games in one message
+int send_games(Connection* conn, uint32_t id, const Game* const* games, int count) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        write_byte(&writer, BINARY_GAMES);
+        write_varint(&writer, count);
+        for (int i = 0; i < count; i++) {
+            write_game(&writer, games[i]);
         }
+        return send_writer(conn, id, &writer);
+    }
+
+    json_reset(&conn->json);
+    json_write_games(&conn->json, games, count);
+    return send_json(conn, id);
+}
+
+// Send the changes made by a move, to a client holding the previous version of the game
+int send_delta(Connection* conn, uint32_t id, const GameDelta* delta) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        write_byte(&writer, BINARY_DELTA);
+        write_delta(&writer, delta);
+        return send_writer(conn, id, &writer);
     }
 
-    if (bytes_received < 0) {
-        perror("recv failed\n");
-        free(result);
+    json_reset(&conn->json);
+    json_write_delta(&conn->json, delta);
+    return send_json(conn, id);
+}
+
+// Tell the client that its version of a game is still the latest
+int send_not_modified(Connection* conn, uint32_t id) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        char tag = BINARY_NOT_MODIFIED;
+        return send_frame(conn, id, &tag, 1);
+    }
+    return send_string(conn, id, NOT_MODIFIED_NAME);
+}
+
+/**
+ * @brief Builds a shared frame holding a message, to be queued to several connections.
+ *
+ * @param id The correlation ID, 0 for a push.
+ * @param data The message, not necessarily null-terminated.
+ * @param length Its length in bytes, at most MAX_FRAME_SIZE.
+ *
+ * @return SharedFrame* The frame with a single reference, or NULL on failure.
+ */
+SharedFrame* shared_frame_new(uint32_t id, const char* data, size_t length) {
+    if (length > MAX_FRAME_SIZE) {
+        fprintf(stderr, "Error: Message of %zu bytes is too large to send\n", length);
+        return NULL;
+    }
+    SharedFrame* frame = malloc(sizeof(SharedFrame) + FRAME_HEADER_SIZE + length);
+    if (!frame) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
         return NULL;
     }
+    frame->references = 1;
+    frame->length = FRAME_HEADER_SIZE + length;
+    uint32_t header[2] = {htonl((uint32_t) length), htonl(id)};
+    memcpy(frame->data, header, FRAME_HEADER_SIZE);
+    memcpy(frame->data + FRAME_HEADER_SIZE, data, length);
+    return frame;
+}
+
+// Same message as send_game, encoded once for every connection using the protocol
+SharedFrame* shared_game_frame(PROTOCOL protocol, uint32_t id, const Game* game) {
+    SharedFrame* frame = NULL;
+    if (protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        write_byte(&writer, BINARY_GAME);
+        write_game(&writer, game);
+        if (!writer.error) frame = shared_frame_new(id, (const char*) writer.data, writer.length);
+        writer_free(&writer);
+        return frame;
+    }
 
-    return result;  // Caller is responsible for freeing the memory
+    JsonWriter writer;
+    json_writer_init(&writer);
+    json_write_game(&writer, game);
+    if (!writer.error) frame = shared_frame_new(id, writer.data, writer.length);
+    json_writer_free(&writer);
+    return frame;
 }
 
-// TODO: Read game object from socket
-int receive_game(int socket, Game* game) {
-    char buffer[BUFFER_SIZE];
-    memset(buffer, 0, BUFFER_SIZE);
+// Same message as send_delta, encoded once for every connection using the protocol
+SharedFrame* shared_delta_frame(PROTOCOL protocol, uint32_t id, const GameDelta* delta) {
+    SharedFrame* frame = NULL;
+    if (protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        write_byte(&writer, BINARY_DELTA);
+        write_delta(&writer, delta);
+        if (!writer.error) frame = shared_frame_new(id, (const char*) writer.data, writer.length);
+        writer_free(&writer);
+        return frame;
+    }
 
-    // Receive the JSON string from the server
-    ssize_t bytes_received = recv(socket, buffer, BUFFER_SIZE - 1, 0);
-    if (bytes_received <= 0) {
-        fprintf(stderr, "Error: Failed to receive game state\n");
+    JsonWriter writer;
+    json_writer_init(&writer);
+    json_write_delta(&writer, delta);
+    if (!writer.error) frame = shared_frame_new(id, writer.data, writer.length);
+    json_writer_free(&writer);
+    return frame;
+}
+
+// Fill a GameDelta from its JSON object, returns 0 on success or -1 if a field is missing
+int json_to_delta(const cJSON* json, GameDelta* delta) {
+    cJSON* version = cJSON_GetObjectItem(json, "version");
+    cJSON* move = cJSON_GetObjectItem(json, "move");
+    cJSON* pits = cJSON_GetObjectItem(json, "pits");
+    cJSON* captured = cJSON_GetObjectItem(json, "captured");
+    cJSON* score = cJSON_GetObjectItem(json, "score");
+    cJSON* state = cJSON_GetObjectItem(json, "currentState");
+    cJSON* score0 = cJSON_GetObjectItem(score, "player0");
+    cJSON* score1 = cJSON_GetObjectItem(score, "player1");
+    if (!cJSON_IsNumber(version) || !cJSON_IsNumber(move) || !cJSON_IsArray(pits) || !cJSON_IsNumber(captured) ||
+        !cJSON_IsNumber(score0) || !cJSON_IsNumber(score1) || !cJSON_IsNumber(state) ||
+        state->valueint < MOVE_PLAYER_0 || state->valueint > DRAW) {
         return -1;
     }
 
-    // Null-terminate the received string
-    buffer[bytes_received] = '\0';
+    int size = cJSON_GetArraySize(pits);
+    if (size % 2 != 0 || size > 2 * BOARD_SIZE) {
+        return -1;
+    }
+    delta->count = size / 2;
+    for (int i = 0; i < delta->count; i++) {
+        cJSON* pit = cJSON_GetArrayItem(pits, 2 * i);
+        cJSON* seeds = cJSON_GetArrayItem(pits, 2 * i + 1);
+        if (!cJSON_IsNumber(pit) || !cJSON_IsNumber(seeds) || pit->valueint < 0 || pit->valueint >= BOARD_SIZE) {
+            return -1;
+        }
+        delta->pits[i] = pit->valueint;
+        delta->seeds[i] = seeds->valueint;
+    }
 
-    // Parse the JSON string into the Game structure
-    cJSON* game_json = cJSON_Parse(buffer);
-    if (game_json == NULL) {
-        fprintf(stderr, "Error: Failed to parse JSON\n");
+    delta->version = json_to_version(version->valuedouble);
+    delta->move = move->valueint;
+    delta->captured = captured->valueint;
+    delta->score.player0 = score0->valueint;
+    delta->score.player1 = score1->valueint;
+    delta->state = (GAME_STATE) state->valueint;
+    return 0;
+}
+
+/**
+ * @brief Reads a success or failure reply.
+ *
+ * @param conn The connection.
+ * @param id The correlation ID of the request.
+ * @param value Set to the reply.
+ *
+ * @return int Returns 0 on success, or -1 if nothing or something else was received.
+ */
+int receive_bool(Connection* conn, uint32_t id, bool* value) {
+    size_t length;
+    char* res = receive_response(conn, id, &length);
+    if (!res) {
         return -1;
     }
 
+    int result = 0;
+    if (conn->protocol == PROTOCOL_BINARY && length == 1 && (uint8_t) res[0] <= BINARY_TRUE) {
+        *value = res[0] == BINARY_TRUE;
+    } else if (conn->protocol == PROTOCOL_JSON && (strcmp(res, "true") == 0 || strcmp(res, "false") == 0)) {
+        *value = strcmp(res, "true") == 0;
+    } else {
+        fprintf(stderr, "Error: Unexpected response from server\n");
+        result = -1;
+    }
+    free(res);
+    return result;
+}
+
+// Fill a Game from its JSON object, the fields missing or of another type are left as they were
+void json_to_game(const cJSON* game_json, Game* game) {
     // Extract player0 and player1
     cJSON* player0_json = cJSON_GetObjectItem(game_json, "player0");
     cJSON* player1_json = cJSON_GetObjectItem(game_json, "player1");
-    if (player0_json && player1_json) {
-        strncpy(game->player0, player0_json->valuestring, MAX_NAME_LENGTH);
-        strncpy(game->player1, player1_json->valuestring, MAX_NAME_LENGTH);
+    if (cJSON_IsString(player0_json) && cJSON_IsString(player1_json)) {
+        strncpy(game->player0, player0_json->valuestring, sizeof(game->player0) - 1);
+        strncpy(game->player1, player1_json->valuestring, sizeof(game->player1) - 1);
+        game->player0[sizeof(game->player0) - 1] = '\0';
+        game->player1[sizeof(game->player1) - 1] = '\0';
     }
 
     // Extract current game state
     cJSON* state_json = cJSON_GetObjectItem(game_json, "currentState");
-    if (state_json) {
+    if (cJSON_IsNumber(state_json)) {
         game->current_state = (GAME_STATE)state_json->valueint;
     }
 
@@ -317,7 +1188,7 @@ int receive_game(int socket, Game* game) {
     if (score_json) {
         cJSON* player0_score_json = cJSON_GetObjectItem(score_json, "player0");
         cJSON* player1_score_json = cJSON_GetObjectItem(score_json, "player1");
-        if (player0_score_json && player1_score_json) {
+        if (cJSON_IsNumber(player0_score_json) && cJSON_IsNumber(player1_score_json)) {
             game->score.player0 = player0_score_json->valueint;
             game->score.player1 = player1_score_json->valueint;
         }
@@ -329,15 +1200,358 @@ int receive_game(int socket, Game* game) {
         int board_size = cJSON_GetArraySize(board_json);
         for (int i = 0; i < board_size && i < BOARD_SIZE; i++) {
             cJSON* cell_json = cJSON_GetArrayItem(board_json, i);
-            if (cell_json) {
+            if (cJSON_IsNumber(cell_json)) {
                 game->board[i] = cell_json->valueint;
             }
         }
     }
 
-    // Clean up
+    cJSON* version_json = cJSON_GetObjectItem(game_json, "version");
+    if (cJSON_IsNumber(version_json)) {
+        game->version = json_to_version(version_json->valuedouble);
+    }
+}
+
+/**
+ * @brief Decodes a game or the changes of a move with cJSON.
+ *
+ * @details Reference for json_decode_game, which awale_bench decode checks against it.
+ *
+ * @param json The message.
+ * @param game Updated with the fields of a whole game.
+ * @param delta Filled with the changes of a move.
+ *
+ * @return int Returns 0 if the game was updated, 1 if delta was filled, or -1 on failure.
+ */
+int cjson_decode_game(const char* json, Game* game, GameDelta* delta) {
+    cJSON* game_json = cJSON_Parse(json);
+    if (game_json == NULL) {
+        return -1;
+    }
+
+    // The changes of a move are told apart from a whole game by their move
+    int result = 0;
+    if (cJSON_GetObjectItem(game_json, "move")) {
+        result = json_to_delta(game_json, delta) ? -1 : 1;
+    } else {
+        json_to_game(game_json, game);
+    }
     cJSON_Delete(game_json);
+    return result;
+}
+
+/**
+ * @brief Reads a game or the changes of a move in one pass, without building a cJSON tree or allocating.
+ *
+ * @details Every member is decoded as it comes and kept aside, as the object only tells whether
+ * it is a game or a delta once all of it was read. The first member of each name counts and names
+ * are compared ignoring case, as cJSON_GetObjectItem does, so that the results are those of
+ * json_to_game and json_to_delta.
+ *
+ * @param reader The input, just before the value.
+ * @param game Updated with the fields of a whole game, those missing or of another type are left as they were.
+ * @param delta Filled with the changes of a move.
+ * @param deltas Whether a "move" member makes the object a delta, otherwise it is always read as a game.
+ *
+ * @return int Returns 0 if the game was updated, 1 if delta was filled, or -1 on failure.
+ */
+int json_read_game(JsonReader* reader, Game* game, GameDelta* delta, bool deltas) {
+    if (json_peek(reader) != JSON_OBJECT) {
+        return json_read_skip(reader) ? 0 : -1;  // "false" from a failed request leaves the game as it was
+    }
+
+    char player0[MAX_NAME_LENGTH + 1], player1[MAX_NAME_LENGTH + 1];
+    JSON_TYPE player0_type = JSON_INVALID, player1_type = JSON_INVALID;
+    JSON_TYPE score_type = JSON_INVALID, board_type = JSON_INVALID, pits_type = JSON_INVALID;
+    JsonNumber state = {0}, version = {0}, move = {0}, captured = {0}, score0 = {0}, score1 = {0};
+    JsonNumber board[BOARD_SIZE] = {{0}}, pits[2 * BOARD_SIZE] = {{0}};
+    int board_count = 0, pits_count = 0;
+
+    char key[16];
+    bool longer, first = true;
+    json_read_begin(reader, '{');
+    while (json_read_next(reader, '}', &first) && json_read_key(reader, key, sizeof(key), &longer)) {
+        if (longer) {
+            json_read_skip(reader);
+        } else if (json_key_is(key, "player0")) {
+            json_read_member_string(reader, &player0_type, player0, sizeof(player0));
+        } else if (json_key_is(key, "player1")) {
+            json_read_member_string(reader, &player1_type, player1, sizeof(player1));
+        } else if (json_key_is(key, "currentState")) {
+            json_read_member_number(reader, &state);
+        } else if (json_key_is(key, "version")) {
+            json_read_member_number(reader, &version);
+        } else if (json_key_is(key, "move")) {
+            json_read_member_number(reader, &move);
+        } else if (json_key_is(key, "captured")) {
+            json_read_member_number(reader, &captured);
+        } else if (json_key_is(key, "score") && score_type == JSON_INVALID) {
+            score_type = json_peek(reader);
+            if (score_type != JSON_OBJECT) {
+                json_read_skip(reader);
+                continue;
+            }
+            bool first_score = true;
+            json_read_begin(reader, '{');
+            while (json_read_next(reader, '}', &first_score) && json_read_key(reader, key, sizeof(key), &longer)) {
+                if (!longer && json_key_is(key, "player0")) {
+                    json_read_member_number(reader, &score0);
+                } else if (!longer && json_key_is(key, "player1")) {
+                    json_read_member_number(reader, &score1);
+                } else {
+                    json_read_skip(reader);
+                }
+            }
+        } else if (json_key_is(key, "board") && board_type == JSON_INVALID) {
+            board_type = json_peek(reader);
+            if (board_type != JSON_ARRAY) {
+                json_read_skip(reader);
+                continue;
+            }
+            bool first_cell = true;
+            json_read_begin(reader, '[');
+            for (; json_read_next(reader, ']', &first_cell); board_count++) {
+                if (board_count < BOARD_SIZE) json_read_member_number(reader, &board[board_count]);
+                else json_read_skip(reader);
+            }
+        } else if (json_key_is(key, "pits") && pits_type == JSON_INVALID) {
+            pits_type = json_peek(reader);
+            if (pits_type != JSON_ARRAY) {
+                json_read_skip(reader);
+                continue;
+            }
+            bool first_pit = true;
+            json_read_begin(reader, '[');
+            for (; json_read_next(reader, ']', &first_pit); pits_count++) {
+                if (pits_count < 2 * BOARD_SIZE) json_read_member_number(reader, &pits[pits_count]);
+                else json_read_skip(reader);
+            }
+        } else {
+            json_read_skip(reader);
+        }
+    }
+    if (reader->error) {
+        return -1;
+    }
+
+    // Same checks as json_to_delta
+    if (deltas && move.type != JSON_INVALID) {
+        int state_value = json_to_int(state.value);
+        if (version.type != JSON_NUMBER || move.type != JSON_NUMBER || pits_type != JSON_ARRAY ||
+            captured.type != JSON_NUMBER || score0.type != JSON_NUMBER || score1.type != JSON_NUMBER ||
+            state.type != JSON_NUMBER || state_value < MOVE_PLAYER_0 || state_value > DRAW ||
+            pits_count % 2 != 0 || pits_count > 2 * BOARD_SIZE) {
+            return -1;
+        }
+        delta->count = pits_count / 2;
+        for (int i = 0; i < delta->count; i++) {
+            int pit = json_to_int(pits[2 * i].value);
+            if (pits[2 * i].type != JSON_NUMBER || pits[2 * i + 1].type != JSON_NUMBER || pit < 0 || pit >= BOARD_SIZE) {
+                return -1;
+            }
+            delta->pits[i] = pit;
+            delta->seeds[i] = json_to_int(pits[2 * i + 1].value);
+        }
+        delta->version = json_to_version(version.value);
+        delta->move = json_to_int(move.value);
+        delta->captured = json_to_int(captured.value);
+        delta->score.player0 = json_to_int(score0.value);
+        delta->score.player1 = json_to_int(score1.value);
+        delta->state = (GAME_STATE) state_value;
+        return 1;
+    }
+
+    // Same fields as json_to_game
+    if (player0_type == JSON_STRING && player1_type == JSON_STRING) {
+        memcpy(game->player0, player0, sizeof(game->player0));  // Both terminated by json_read_member_string
+        memcpy(game->player1, player1, sizeof(game->player1));
+    }
+    if (state.type == JSON_NUMBER) {
+        game->current_state = (GAME_STATE) json_to_int(state.value);
+    }
+    if (score0.type == JSON_NUMBER && score1.type == JSON_NUMBER) {
+        game->score.player0 = json_to_int(score0.value);
+        game->score.player1 = json_to_int(score1.value);
+    }
+    for (int i = 0; i < board_count && i < BOARD_SIZE; i++) {
+        if (board[i].type == JSON_NUMBER) {
+            game->board[i] = json_to_int(board[i].value);
+        }
+    }
+    if (version.type == JSON_NUMBER) {
+        game->version = json_to_version(version.value);
+    }
     return 0;
 }
 
+// Decodes a game or the changes of a move from a message, see json_read_game
+int json_decode_game(const char* json, size_t length, Game* game, GameDelta* delta) {
+    JsonReader reader;
+    json_reader_init(&reader, json, length);
+    return json_read_game(&reader, game, delta, true);
+}
+
+/**
+ * @brief Decodes the games sent in response to GAMES_BATCH with cJSON.
+ *
+ * @details Reference for json_decode_games, which awale_bench decode checks against it.
+ *
+ * @param json The message.
+ * @param count Set to the number of games.
+ *
+ * @return Game* The games (to be freed), or NULL if the message is not an array of games.
+ */
+Game* cjson_decode_games(const char* json, int* count) {
+    *count = 0;
+    Game* games = NULL;
+    cJSON* games_json = cJSON_Parse(json);
+    if (cJSON_IsArray(games_json)) {
+        games = malloc(sizeof(Game) * (cJSON_GetArraySize(games_json) + 1));
+        cJSON* game_json;
+        cJSON_ArrayForEach(game_json, games_json) {
+            if (!games) break;
+            memset(&games[*count], 0, sizeof(Game));
+            json_to_game(game_json, &games[(*count)++]);
+        }
+    }
+    cJSON_Delete(games_json);
+    return games;
+}
+
+// Decodes the games sent in response to GAMES_BATCH in one pass, see json_read_game. Only the array of games is allocated
+Game* json_decode_games(const char* json, size_t length, int* count) {
+    *count = 0;
+    JsonReader reader;
+    json_reader_init(&reader, json, length);
+    if (json_peek(&reader) != JSON_ARRAY) {
+        json_read_skip(&reader);
+        return NULL;
+    }
+
+    int capacity = 8;
+    Game* games = malloc(sizeof(Game) * capacity);
+    bool first = true;
+    json_read_begin(&reader, '[');
+    while (games && json_read_next(&reader, ']', &first)) {
+        if (*count == capacity) {
+            capacity *= 2;
+            Game* grown = realloc(games, sizeof(Game) * capacity);
+            if (!grown) {
+                break;
+            }
+            games = grown;
+        }
+        memset(&games[*count], 0, sizeof(Game));
+        json_read_game(&reader, &games[(*count)++], NULL, false);
+    }
+    if (!games || reader.error || reader.depth) {
+        free(games);
+        *count = 0;
+        return NULL;
+    }
+    return games;
+}
+
+/**
+ * @brief Reads a game sent in response to a request, or pushed with ID 0.
+ *
+ * @param conn The connection.
+ * @param id The correlation ID of the request.
+ * @param game Replaced by a whole game, or updated by the changes of a move. Left as it was if the request
+ * failed or the game was not modified.
+ *
+ * @return int Returns 0 on success, 1 if changes were received that do not follow the version of
+ * the game (it must be fetched again), or -1 on failure.
+ */
+int receive_game(Connection* conn, uint32_t id, Game* game) {
+    size_t length;
+    char* buffer = receive_response(conn, id, &length);
+    if (!buffer) {
+        fprintf(stderr, "Error: Failed to receive game state\n");
+        return -1;
+    }
+
+    // A failed request leaves the game as it was, as with "false" in JSON
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryReader reader;
+        reader_init(&reader, buffer, length);
+        uint8_t tag = read_byte(&reader);
+        Game received;
+        GameDelta delta;
+        int result = 0;
+        if (tag == BINARY_GAME) {
+            result = read_game(&reader, &received);
+            if (result == 0) *game = received;
+        } else if (tag == BINARY_DELTA) {
+            result = read_delta(&reader, &delta);
+        } else if (tag != BINARY_FALSE && tag != BINARY_NOT_MODIFIED) {
+            result = -1;
+        }
+        free(buffer);
+        if (result) {
+            fprintf(stderr, "Error: Invalid game state received\n");
+            return result;
+        }
+        return tag == BINARY_DELTA && apply_delta(game, &delta) ? 1 : 0;
+    }
+
+    if (strcmp(buffer, NOT_MODIFIED_NAME) == 0) {
+        free(buffer);
+        return 0;
+    }
+
+    GameDelta delta;
+    int result = json_decode_game(buffer, length, game, &delta);
+    free(buffer);
+    if (result < 0) {
+        fprintf(stderr, "Error: Invalid game state received\n");
+        return -1;
+    }
+    return result == 1 && apply_delta(game, &delta) ? 1 : 0;
+}
+
+/**
+ * @brief Reads the games sent in response to GAMES_BATCH.
+ *
+ * @param conn The connection.
+ * @param id The correlation ID of the request.
+ * @param count Set to the number of games.
+ *
+ * @return Game* The games (to be freed), or NULL on failure or if the request failed.
+ */
+Game* receive_games(Connection* conn, uint32_t id, int* count) {
+    *count = 0;
+    size_t length;
+    char* buffer = receive_response(conn, id, &length);
+    if (!buffer) {
+        fprintf(stderr, "Error: Failed to receive games\n");
+        return NULL;
+    }
+
+    Game* games = NULL;
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryReader reader;
+        reader_init(&reader, buffer, length);
+        uint64_t size = read_byte(&reader) == BINARY_GAMES ? read_varint(&reader) : 0;
+        if (!reader.error && size <= length) {  // Every game takes more than a byte
+            games = malloc(sizeof(Game) * (size ? size : 1));
+        }
+        for (uint64_t i = 0; games && i < size; i++) {
+            if (read_game(&reader, &games[i])) {
+                free(games);
+                games = NULL;
+            }
+        }
+        if (games) *count = (int) size;
+    } else {
+        games = json_decode_games(buffer, length, count);
+    }
+
+    free(buffer);
+    if (!games) {
+        fprintf(stderr, "Error: Invalid games received\n");
+    }
+    return games;
+}
+
 #endif
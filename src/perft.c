@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "game.h"
+
+#define PERFT_MAX_THREADS 256
+#define PERFT_SPLIT_PLIES 2        // Positions at this ply are shared out between threads
+#define PERFT_MAX_SPLIT 36         // 6 ^ PERFT_SPLIT_PLIES
+
+#define PERFT_EXPECTED_DEPTH 9
+
+// Reference positions with their leaf counts, any change means the rules (or their implementation) changed
+typedef struct {
+    const char* name;
+    int board[BOARD_SIZE];
+    int score0;
+    int score1;
+    unsigned long long expected[PERFT_EXPECTED_DEPTH + 1];
+} PerftPosition;
+
+const PerftPosition PERFT_POSITIONS[] = {
+    {"init_game", {4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4}, 0, 0,
+     {1, 6, 36, 190, 1014, 5219, 27332, 139157, 709969, 3574679}},
+    {"midgame 1", {7, 2, 7, 7, 1, 1, 6, 6, 2, 0, 8, 1}, 0, 0,
+     {1, 6, 32, 166, 835, 4253, 21479, 108389, 546052, 2727891}},
+    {"midgame 2", {1, 8, 0, 1, 1, 5, 9, 8, 0, 2, 3, 10}, 0, 0,
+     {1, 5, 26, 120, 621, 2965, 14997, 74024, 366928, 1832267}},
+    {"midgame 3", {1, 12, 2, 2, 4, 0, 0, 9, 1, 3, 4, 1}, 2, 6,
+     {1, 5, 26, 121, 588, 2826, 13369, 64474, 299163, 1435158}},
+};
+#define PERFT_POSITION_COUNT (sizeof(PERFT_POSITIONS) / sizeof(PERFT_POSITIONS[0]))
+
+typedef struct {
+    unsigned long long leaves;    // Positions reached after exactly depth plies
+    unsigned long long finished;  // Games that ended before (or at) depth
+} PerftCount;
+
+// Work shared between the threads of one count
+typedef struct {
+    Game positions[PERFT_MAX_SPLIT];
+    int count;
+    int depth;                    // Remaining plies below the split positions
+    _Atomic int next;
+    _Atomic unsigned long long leaves;
+    _Atomic unsigned long long finished;
+} PerftWork;
+
+void perft(const Game* game, int depth, PerftCount* count) {
+    if (depth == 0) {
+        count->leaves++;
+        return;
+    }
+
+    int moves[6];
+    int move_count = list_moves(game, moves);
+    for (int i = 0; i < move_count; i++) {
+        Game child = *game;
+        if (play_turn(&child, moves[i])) {
+            count->finished++;
+            continue;
+        }
+        perft(&child, depth - 1, count);
+    }
+}
+
+// Positions after up to PERFT_SPLIT_PLIES plies, games ending on the way are counted directly
+void perft_split(const Game* game, int plies, int depth, PerftWork* work, PerftCount* count) {
+    if (plies == 0 || depth == 0) {
+        work->positions[work->count++] = *game;
+        return;
+    }
+
+    int moves[6];
+    int move_count = list_moves(game, moves);
+    for (int i = 0; i < move_count; i++) {
+        Game child = *game;
+        if (play_turn(&child, moves[i])) {
+            count->finished++;
+            continue;
+        }
+        perft_split(&child, plies - 1, depth - 1, work, count);
+    }
+}
+
+void* perft_worker(void* arg) {
+    PerftWork* work = arg;
+    int index;
+    while ((index = atomic_fetch_add(&work->next, 1)) < work->count) {
+        PerftCount count = {0, 0};
+        perft(&work->positions[index], work->depth, &count);
+        atomic_fetch_add(&work->leaves, count.leaves);
+        atomic_fetch_add(&work->finished, count.finished);
+    }
+    return NULL;
+}
+
+// Count from a position on the given number of threads, returns the time taken in ms
+double perft_count(const Game* game, int depth, int threads, PerftCount* count) {
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    count->leaves = 0;
+    count->finished = 0;
+
+    if (threads <= 1) {
+        perft(game, depth, count);
+    } else {
+        PerftWork work;
+        work.count = 0;
+        int split = depth < PERFT_SPLIT_PLIES ? depth : PERFT_SPLIT_PLIES;
+        perft_split(game, split, depth, &work, count);
+        work.depth = depth - split;
+        atomic_init(&work.next, 0);
+        atomic_init(&work.leaves, 0);
+        atomic_init(&work.finished, 0);
+
+        pthread_t workers[PERFT_MAX_THREADS];
+        for (int i = 0; i < threads; i++) {
+            pthread_create(&workers[i], NULL, perft_worker, &work);
+        }
+        for (int i = 0; i < threads; i++) {
+            pthread_join(workers[i], NULL);
+        }
+        count->leaves += atomic_load(&work.leaves);
+        count->finished += atomic_load(&work.finished);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    return (double) (end.tv_sec - start.tv_sec) * 1000.0 + (double) (end.tv_nsec - start.tv_nsec) / 1e6;
+}
+
+// Print counts for depths 1 to max_depth, returns the number of counts differing from expected (NULL for none)
+int run_position(const char* name, const Game* game, int max_depth, int threads, const unsigned long long* expected) {
+    int errors = 0;
+    printf("\n%s\n", name);
+    printf("depth\tleaves\tfinished\tms (1 thread)\tms (%d threads)\tMplies/s\n", threads);
+
+    for (int depth = 1; depth <= max_depth; depth++) {
+        PerftCount single, multi;
+        double ms_single = perft_count(game, depth, 1, &single);
+        double ms_multi = perft_count(game, depth, threads, &multi);
+        unsigned long long plies = single.leaves + single.finished;
+
+        printf("%d\t%llu\t%llu\t%.1f\t%.1f\t%.1f", depth, single.leaves, single.finished, ms_single, ms_multi,
+               ms_single > 0 ? plies / ms_single / 1000.0 : 0.0);
+
+        if (single.leaves != multi.leaves || single.finished != multi.finished) {
+            printf("\tMISMATCH (%llu / %llu with threads)", multi.leaves, multi.finished);
+            errors++;
+        }
+        if (expected && depth <= PERFT_EXPECTED_DEPTH && single.leaves != expected[depth]) {
+            printf("\tEXPECTED %llu", expected[depth]);
+            errors++;
+        }
+        printf("\n");
+    }
+    return errors;
+}
+
+int main(int argc, char** argv) {
+    int depth = argc > 1 ? atoi(argv[1]) : 9;
+    long threads = argc > 2 ? atol(argv[2]) : sysconf(_SC_NPROCESSORS_ONLN);
+    const char* store = argc > 3 ? argv[3] : JSON_FILENAME;
+
+    if (depth < 1 || threads < 1) {
+        printf("Usage: awale_perft [depth] [threads] [store]\n");
+        exit(0);
+    }
+    if (threads > PERFT_MAX_THREADS) threads = PERFT_MAX_THREADS;
+
+    int errors = 0;
+    for (size_t i = 0; i < PERFT_POSITION_COUNT; i++) {
+        const PerftPosition* position = &PERFT_POSITIONS[i];
+        Game game;
+        init_game(&game, "player0", "player1");
+        memcpy(game.board, position->board, sizeof(game.board));
+        game.score.player0 = position->score0;
+        game.score.player1 = position->score1;
+        errors += run_position(position->name, &game, depth, (int) threads, position->expected);
+    }
+
+    // Stored games that are still being played
+    GameData* gameData = malloc(sizeof(GameData));
+    if (gameData && access(store, R_OK) == 0 && parse_json(gameData, store) == 0) {
+        for (int i = 0; i < gameData->game_count; i++) {
+            Game* stored = &gameData->games[i];
+            if (stored->current_state != MOVE_PLAYER_0 && stored->current_state != MOVE_PLAYER_1) {
+                continue;
+            }
+            char name[2 * MAX_NAME_LENGTH + 16];
+            snprintf(name, sizeof(name), "%s vs %s", stored->player0, stored->player1);
+            errors += run_position(name, stored, depth, (int) threads, NULL);
+        }
+    }
+    free(gameData);
+
+    if (errors) {
+        printf("\n%d mismatching counts\n", errors);
+        return 1;
+    }
+    return 0;
+}
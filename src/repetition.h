@@ -0,0 +1,140 @@
+//
+// Detection of repeated positions, so that games which loop forever come to an end.
+// To be used by the server to adjudicate games and by the engine to prune cycles
+//
+
+#ifndef AWALEGAME_REPETITION_H
+#define AWALEGAME_REPETITION_H
+
+#include <stdint.h>
+
+#include "game.h"
+#include "zobrist.h"
+#include "tablebase.h"
+
+// Plies remembered since the last capture, longer cycles are not detected
+#define REPETITION_SIZE 64
+
+// Hashes of the last positions of a game, oldest first. A capture removes seeds for good,
+// so no position before it can come back and the ring is cleared
+typedef struct {
+    uint64_t hashes[REPETITION_SIZE];
+    int count;  // Positions stored, at most REPETITION_SIZE
+    int next;   // Where the next one goes
+} RepetitionRing;
+
+void ring_clear(RepetitionRing* ring) {
+    ring->count = 0;
+    ring->next = 0;
+}
+
+void ring_push(RepetitionRing* ring, uint64_t hash) {
+    ring->hashes[ring->next] = hash;
+    ring->next = (ring->next + 1) % REPETITION_SIZE;
+    if (ring->count < REPETITION_SIZE) ring->count++;
+}
+
+// i-th stored hash, 0 being the oldest
+uint64_t ring_at(const RepetitionRing* ring, int i) {
+    return ring->hashes[(ring->next - ring->count + i + REPETITION_SIZE) % REPETITION_SIZE];
+}
+
+// Hash of the stored positions in order, 0 for an empty ring. Results which depend on the path
+// to a position, like a search scoring repetitions, are keyed by it along with hash_game
+uint64_t ring_hash(const RepetitionRing* ring) {
+    uint64_t state = 0;
+    uint64_t hash = 0;
+    for (int i = 0; i < ring->count; i++) {
+        state ^= ring_at(ring, i);
+        hash = zobrist_next(&state);
+    }
+    return hash;
+}
+
+bool ring_contains(const RepetitionRing* ring, uint64_t hash) {
+    for (int i = 0; i < ring->count; i++) {
+        if (ring->hashes[i] == hash) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Result of a game stopped because its position repeated.
+ *
+ * @details The tablebase decides when it covers the position (a draw there means neither
+ * player can force a win). Otherwise the player who captured more seeds wins.
+ *
+ * @param game The repeated position.
+ * @param tb Tablebase to consult, can be NULL.
+ *
+ * @return GAME_STATE WIN_PLAYER_0, WIN_PLAYER_1 or DRAW.
+ */
+GAME_STATE adjudicate(const Game* game, const Tablebase* tb) {
+    TBResult result;
+    if (tb_probe(tb, game, &result)) {
+        if (result.value == TB_DRAW) return DRAW;
+        bool mover_wins = result.value == TB_WIN;
+        return (game->current_state == MOVE_PLAYER_0) == mover_wins ? WIN_PLAYER_0 : WIN_PLAYER_1;
+    }
+
+    if (game->score.player0 > game->score.player1) return WIN_PLAYER_0;
+    if (game->score.player1 > game->score.player0) return WIN_PLAYER_1;
+    return DRAW;
+}
+
+/**
+ * @brief Plays a move like play_turn, then ends the game if the new position was already seen.
+ *
+ * @param game The game, updated in place. Its state is set to the result when the game ends.
+ * @param slot The slot to empty, from 0 to 11.
+ * @param ring Positions since the last capture, the new one is added.
+ * @param tb Tablebase used to adjudicate, can be NULL.
+ *
+ * @return int 1 if the player who moved won, 2 if the game was adjudicated on a repetition, 0 otherwise.
+ */
+int play_turn_tracked(Game* game, int slot, RepetitionRing* ring, const Tablebase* tb) {
+    MoveUndo undo;
+    if (make_move(game, slot, &undo)) {
+        game->current_state = game->current_state == MOVE_PLAYER_0 ? WIN_PLAYER_0 : WIN_PLAYER_1;
+        return 1;
+    }
+
+    if (undo.captured) {
+        ring_clear(ring);
+    }
+    uint64_t hash = hash_game(game);
+    if (ring_contains(ring, hash)) {
+        game->current_state = adjudicate(game, tb);
+        return 2;
+    }
+    ring_push(ring, hash);
+    return 0;
+}
+
+/**
+ * @brief Rebuilds the ring of a game by replaying its recorded moves.
+ *
+ * @param game The game, only its player names are used.
+ * @param history The moves played in the game.
+ * @param ring Filled with the positions since the last capture, current one included.
+ *
+ * @return int Returns 0 on success, or -1 if the history is incomplete.
+ */
+int ring_from_history(const Game* game, const MoveHistory* history, RepetitionRing* ring) {
+    if (!history->complete) {
+        return -1;
+    }
+
+    Game position;
+    init_game(&position, game->player0, game->player1);
+    ring_clear(ring);
+    ring_push(ring, hash_game(&position));
+    for (int i = 0; i < history->count; i++) {
+        if (play_turn_tracked(&position, history->slots[i], ring, NULL)) {
+            break;
+        }
+    }
+    return 0;
+}
+
+#endif //AWALEGAME_REPETITION_H
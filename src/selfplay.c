@@ -0,0 +1,275 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "game.h"
+#include "engine.h"
+#include "mcts.h"
+#include "book.h"
+
+#define SELFPLAY_MAX_PLIES 400     // Longer games are scored as draws
+#define SELFPLAY_OPENING_PLIES 4   // Random first moves so that deterministic engines play different games
+#define SELFPLAY_TT_MB 16
+#define SELFPLAY_MAX_THREADS 256
+
+typedef enum {
+    PLAYER_RANDOM,
+    PLAYER_GREEDY,  // Best immediate capture, random otherwise
+    PLAYER_ALPHABETA,
+    PLAYER_MCTS
+} PLAYER_TYPE;
+
+// An engine configuration, parsed from "random", "greedy", "ab:<depth>" or "mcts:<playouts>"
+typedef struct {
+    PLAYER_TYPE type;
+    int strength;  // Depth or playouts
+    char name[32];
+} PlayerConfig;
+
+// Everything a worker thread owns, nothing in here is shared
+typedef struct {
+    const PlayerConfig* players[2];
+    long first_game;
+    long games;
+    long stride;
+    uint64_t rng;
+    TransTable tt;
+    MctsPool pool;
+    long wins;    // For players[0]
+    long draws;
+    long losses;
+    long plies;
+    pthread_t thread;
+} Worker;
+
+int parse_player(const char* spec, PlayerConfig* config) {
+    strncpy(config->name, spec, sizeof(config->name) - 1);
+    config->name[sizeof(config->name) - 1] = '\0';
+    config->strength = 0;
+
+    if (strcmp(spec, "random") == 0) {
+        config->type = PLAYER_RANDOM;
+    } else if (strcmp(spec, "greedy") == 0) {
+        config->type = PLAYER_GREEDY;
+    } else if (strncmp(spec, "ab:", 3) == 0) {
+        config->type = PLAYER_ALPHABETA;
+        config->strength = atoi(spec + 3);
+    } else if (strncmp(spec, "mcts:", 5) == 0) {
+        config->type = PLAYER_MCTS;
+        config->strength = atoi(spec + 5);
+    } else {
+        return -1;
+    }
+
+    if ((config->type == PLAYER_ALPHABETA || config->type == PLAYER_MCTS) && config->strength <= 0) {
+        return -1;
+    }
+    return 0;
+}
+
+// Pick a move for the player to move, returns -1 if there is none
+int choose_move(Worker* worker, const PlayerConfig* player, const Game* game) {
+    int moves[6];
+    int count = list_moves(game, moves);
+    if (count == 0) {
+        return -1;
+    }
+
+    // Engines play the opening instantly from the compiled-in book
+    if (player->type == PLAYER_ALPHABETA || player->type == PLAYER_MCTS) {
+        int book_move = book_probe(game);
+        if (book_move >= 0) {
+            return book_move;
+        }
+    }
+
+    switch (player->type) {
+        case PLAYER_RANDOM:
+            return moves[mcts_random(&worker->rng) % count];
+
+        case PLAYER_GREEDY: {
+            int choice = moves[mcts_random(&worker->rng) % count];
+            int best_gain = 0;
+            for (int i = 0; i < count; i++) {
+                Game next = *game;
+                if (play_turn(&next, moves[i])) {
+                    return moves[i];
+                }
+                int gain = mcts_own_score(&next, game->current_state) - mcts_own_score(game, game->current_state);
+                if (gain > best_gain) {
+                    best_gain = gain;
+                    choice = moves[i];
+                }
+            }
+            return choice;
+        }
+
+        case PLAYER_ALPHABETA: {
+            SearchLimits limits = {.depth = player->strength, .time_ms = 0, .nodes = 0, .history = NULL};
+            SearchResult result;
+            if (engine_search(game, &limits, &worker->tt, &result)) {
+                return moves[0];
+            }
+            return result.move;
+        }
+
+        case PLAYER_MCTS: {
+            MctsLimits limits = {(uint32_t) player->strength, 0, POLICY_LIGHT};
+            MctsResult result;
+            if (mcts_search(game, &limits, &worker->pool, 1, &result)) {
+                return moves[0];
+            }
+            return result.move;
+        }
+    }
+    return moves[0];
+}
+
+/**
+ * @brief Plays one complete game.
+ *
+ * @param worker The calling worker.
+ * @param swap Whether players[1] moves first.
+ * @param plies Set to the length of the game.
+ *
+ * @return int 1 if players[0] won, -1 if it lost, 0 for a draw.
+ */
+int play_one_game(Worker* worker, bool swap, int* plies) {
+    Game game;
+    init_game(&game, "player0", "player1");
+
+    for (*plies = 0; *plies < SELFPLAY_MAX_PLIES; (*plies)++) {
+        int side = game.current_state;
+        bool first = (side == 0) != swap;  // Whether players[0] is to move
+        const PlayerConfig* player = worker->players[first ? 0 : 1];
+
+        int move;
+        if (*plies < SELFPLAY_OPENING_PLIES) {
+            PlayerConfig opening = {PLAYER_RANDOM, 0, "random"};
+            move = choose_move(worker, &opening, &game);
+        } else {
+            move = choose_move(worker, player, &game);
+        }
+
+        if (move < 0) {
+            return first ? -1 : 1;  // Nothing to sow, the player to move loses
+        }
+        if (play_turn(&game, move)) {
+            (*plies)++;
+            return first ? 1 : -1;
+        }
+    }
+    return 0;
+}
+
+void* worker_main(void* arg) {
+    Worker* worker = arg;
+
+    for (long i = 0; i < worker->games; i++) {
+        long game_number = worker->first_game + i * worker->stride;
+        int plies;
+        int result = play_one_game(worker, game_number % 2 == 1, &plies);
+
+        worker->plies += plies;
+        if (result > 0) worker->wins++;
+        else if (result < 0) worker->losses++;
+        else worker->draws++;
+    }
+    return NULL;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        printf("Usage: awale_selfplay <player A> <player B> [games] [threads]\n");
+        printf("Players: random, greedy, ab:<depth>, mcts:<playouts>\n");
+        exit(0);
+    }
+
+    PlayerConfig players[2];
+    for (int i = 0; i < 2; i++) {
+        if (parse_player(argv[i + 1], &players[i])) {
+            fprintf(stderr, "Error: Invalid player %s\n", argv[i + 1]);
+            return 1;
+        }
+    }
+    long games = argc > 3 ? atol(argv[3]) : 1000;
+    if (games < 1) {
+        printf("Usage: awale_selfplay <player A> <player B> [games] [threads]\n");
+        printf("Players: random, greedy, ab:<depth>, mcts:<playouts>\n");
+        return 1;
+    }
+    long threads = argc > 4 ? atol(argv[4]) : sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1;
+    if (threads > SELFPLAY_MAX_THREADS) threads = SELFPLAY_MAX_THREADS;
+    if (threads > games) threads = games;
+
+    init_engine();
+
+    Worker* workers = calloc(threads, sizeof(Worker));
+    if (!workers) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+
+    // Each worker gets every threads-th game, its own table, node pool and random state
+    for (long t = 0; t < threads; t++) {
+        Worker* worker = &workers[t];
+        worker->players[0] = &players[0];
+        worker->players[1] = &players[1];
+        worker->first_game = t;
+        worker->stride = threads;
+        worker->games = games / threads + (t < games % threads ? 1 : 0);
+        worker->rng = 0x9E3779B97F4A7C15ull * (uint64_t) (t + 1);
+
+        bool needs_tt = players[0].type == PLAYER_ALPHABETA || players[1].type == PLAYER_ALPHABETA;
+        int playouts = players[0].type == PLAYER_MCTS ? players[0].strength : 0;
+        if (players[1].type == PLAYER_MCTS && players[1].strength > playouts) playouts = players[1].strength;
+
+        if ((needs_tt && tt_init(&worker->tt, SELFPLAY_TT_MB, false)) ||
+            (playouts && mcts_pool_init(&worker->pool, (uint32_t) playouts * 6 + 64))) {
+            return 1;
+        }
+    }
+
+    printf("%s vs %s: %ld games on %ld threads\n", players[0].name, players[1].name, games, threads);
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long t = 0; t < threads; t++) {
+        pthread_create(&workers[t].thread, NULL, worker_main, &workers[t]);
+    }
+
+    long wins = 0, draws = 0, losses = 0, plies = 0;
+    for (long t = 0; t < threads; t++) {
+        pthread_join(workers[t].thread, NULL);
+        wins += workers[t].wins;
+        draws += workers[t].draws;
+        losses += workers[t].losses;
+        plies += workers[t].plies;
+        tt_free(&workers[t].tt);
+        mcts_pool_free(&workers[t].pool);
+    }
+    double seconds = elapsed_ms(&start) / 1000.0;
+
+    // Score of A with a 95% confidence interval (normal approximation), and the matching Elo difference
+    double n = (double) (wins + draws + losses);
+    double score = (wins + 0.5 * draws) / n;
+    double variance = (wins * pow(1.0 - score, 2) + draws * pow(0.5 - score, 2) + losses * pow(score, 2)) / n;
+    double margin = 1.96 * sqrt(variance / n);
+
+    printf("\n%.0f games in %.2f s: %.1f games/s, %.1f plies per game (%.0f plies/s)\n",
+           n, seconds, n / seconds, plies / n, plies / seconds);
+    printf("%s: +%ld =%ld -%ld\n", players[0].name, wins, draws, losses);
+    printf("Score: %.3f +- %.3f (95%%)\n", score, margin);
+
+    double low = score - margin, high = score + margin;
+    if (low > 0 && high < 1) {
+        printf("Elo: %.0f [%.0f, %.0f]\n", -400 * log10(1 / score - 1), -400 * log10(1 / low - 1), -400 * log10(1 / high - 1));
+    }
+
+    free(workers);
+    return 0;
+}
@@ -2,12 +2,26 @@
 #include <netinet/in.h>
 #include <unistd.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/epoll.h>
 
 #include "game.h"
 #include "server.h"
 #include "network.h"
 
-int handle(int client_socket);
+#define MAX_EVENTS 64
+
+// Tags of the event loop's file descriptors which are not sessions
+static int listen_tag, analysis_tag;
+
+Session* session_open(int epoll_fd, int client_socket);
+void session_close(int epoll_fd, Session* session);
+void session_readable(int epoll_fd, Session* session);
+void session_writable(int epoll_fd, Session* session);
+void session_flush(Session* session, double now, int* timeout);
+void session_update_events(int epoll_fd, Session* session);
+bool session_can_process(const Session* session);
+void session_process(int epoll_fd, Session* session);
 
 int main(int argc, char *argv[]) {
     int server_socket, client_socket;
@@ -51,134 +65,428 @@ int main(int argc, char *argv[]) {
     }
 
     printf("Server listening on port %d\n", PORT_NO);
+    fcntl(server_socket, F_SETFL, fcntl(server_socket, F_GETFL) | O_NONBLOCK);
 
-    // Wait for client to connect
-    while (1) {
-        clilen = sizeof (cli_addr);
+    // Versions of the stored games, for the requests answered without reading the store
+    GameData gameData;
+    if (parse_json(&gameData, JSON_FILENAME) == 0) {
+        remember_versions(&gameData);
+    }
 
-        // Client connects, attempt to accept
-        client_socket = accept(server_socket, (struct sockaddr*) &cli_addr, &clilen);
+    // Start the engine workers before accepting, they must not inherit the client sockets
+    init_engine();
+    static Tablebase tablebase;
+    if (tb_open(&tablebase, TABLEBASE_FILENAME) == 0) {
+        engine_tablebase = &tablebase;
+        printf("Tablebase loaded, %d seeds\n", tablebase.max_seeds);
+    }
+    analysis_pool = analysis_start((int) sysconf(_SC_NPROCESSORS_ONLN));
+    if (analysis_pool) {
+        printf("Analysis pool started with %d workers\n", analysis_pool->worker_count);
+    } else {
+        fprintf(stderr, "Error: Could not start the analysis pool, ANALYZE is disabled\n");
+    }
 
-        if (client_socket < 0) {
-            printf("Error accepting\n");
-            exit(errno);
-        }
+    // A single process serves every client: it waits for whichever socket has something to read,
+    // so that a move can be pushed to the clients watching the game
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd < 0) {
+        perror("Error creating epoll instance");
+        close(server_socket);
+        exit(EXIT_FAILURE);
+    }
+    struct epoll_event event = {.events = EPOLLIN, .data.ptr = &listen_tag};
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, server_socket, &event);
+    if (analysis_pool) {
+        event.data.ptr = &analysis_tag;
+        epoll_ctl(epoll_fd, EPOLL_CTL_ADD, analysis_pool->notify[0], &event);
+    }
 
-        int pid = fork();
+    struct epoll_event events[MAX_EVENTS];
+    while (1) {
+        int timeout = expire_waiters();
+        int analysis_timeout = analysis_pool ? analysis_poll() : -1;
+        if (analysis_timeout >= 0 && (timeout < 0 || analysis_timeout < timeout)) {
+            timeout = analysis_timeout;
+        }
 
-        // Error case
-        if (pid < 0) {
-            perror("Connection accepted, forking unsuccessful\n");
-            perror("Error on fork");
-            close(client_socket);
-            continue;
+        // The responses and pushes queued since the last pass go out together, those left wait until
+        // writable and stay dirty for their deadline. Sessions are freed here, once the events which
+        // may point to them are handled
+        double now = monotonic_ms();
+        Session* session = dirty_sessions;
+        dirty_sessions = NULL;
+        while (session) {
+            Session* next = session->next_dirty;
+            if (!session->closed) {
+                session_flush(session, now, &timeout);
+            }
+            if (session->closed) {
+                session_close(epoll_fd, session);
+            } else {
+                session->dirty = false;
+                if (session->conn.queue_count > 0) {
+                    mark_dirty(session);
+                }
+                session_update_events(epoll_fd, session);
+            }
+            session = next;
         }
 
-        // Child thread
-        else if (pid == 0) {
-            printf("Connection accepted, fork %d\n", pid);
-            close(server_socket);
-            handle(client_socket);
-            close(client_socket);
-            exit(0);  // Terminate child process
+        int count = epoll_wait(epoll_fd, events, MAX_EVENTS, timeout);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            perror("Error waiting for events");
+            break;
         }
 
-        // Main thread
-        else {
-            close(client_socket);
+        for (int i = 0; i < count; i++) {
+            void* tag = events[i].data.ptr;
+
+            // Client connects, accept everyone waiting
+            if (tag == &listen_tag) {
+                while (1) {
+                    clilen = sizeof (cli_addr);
+                    client_socket = accept(server_socket, (struct sockaddr*) &cli_addr, &clilen);
+                    if (client_socket < 0) {
+                        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                            perror("Error accepting");
+                        }
+                        break;
+                    }
+                    fcntl(client_socket, F_SETFL, fcntl(client_socket, F_GETFL) | O_NONBLOCK);
+                    set_no_delay(client_socket);
+                    if (!session_open(epoll_fd, client_socket)) {
+                        close(client_socket);
+                    }
+                }
+                continue;
+            }
+
+            // Searches ended, their requests are answered by analysis_poll
+            if (tag == &analysis_tag) {
+                analysis_drain(analysis_pool);
+                continue;
+            }
+
+            Session* session = tag;
+            if (events[i].events & EPOLLOUT) {
+                session_writable(epoll_fd, session);
+            }
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                session_readable(epoll_fd, session);
+            }
         }
 
+        // Analyses answered may let paused sessions go on with their requests
+        if (analysis_pool) {
+            analysis_poll();
+        }
+        Session* paused = paused_sessions;
+        while (paused) {
+            Session* next = paused->next_paused;
+            if (session_can_process(paused)) {
+                session_process(epoll_fd, paused);
+            }
+            paused = next;
+        }
     }
 
     // Close server socket at end
+    close(epoll_fd);
     close(server_socket);
 
     return 0;
 }
 
-int handle(int client_socket) {
-    bool logged_in = false;
-    char username[MAX_NAME_LENGTH] = {'\0'};
+Session* session_open(int epoll_fd, int client_socket) {
+    Session* session = calloc(1, sizeof(Session));
+    if (!session) {
+        fprintf(stderr, "%d Error: Memory allocation failed\n", client_socket);
+        return NULL;
+    }
+    connection_init(&session->conn, client_socket);
+    session->conn.deferred = true;
+    session->conn.max_frame = MAX_REQUEST_SIZE;
+    session->watching = -1;
+    session->events = EPOLLIN;
+
+    struct epoll_event event = {.events = EPOLLIN, .data.ptr = session};
+    if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, client_socket, &event)) {
+        perror("Error watching the connection");
+        connection_free(&session->conn);
+        free(session);
+        return NULL;
+    }
+
+    session->next_session = all_sessions;
+    if (all_sessions) all_sessions->prev_session = session;
+    all_sessions = session;
+    printf("%d Connection accepted\n", client_socket);
+    return session;
+}
+
+// Waits for requests unless paused, and until writable while pushes are queued
+void session_update_events(int epoll_fd, Session* session) {
+    uint32_t events = (session->paused ? 0 : EPOLLIN) | (session->conn.queue_count > 0 ? EPOLLOUT : 0);
+    if (session->events == events) {
+        return;
+    }
+    session->events = events;
+    struct epoll_event event = {.events = events, .data.ptr = session};
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, session->conn.socket, &event);
+}
+
+// Stops or resumes reading a session's socket, its requests stay buffered meanwhile
+void session_set_paused(int epoll_fd, Session* session, bool paused) {
+    if (session->paused == paused) {
+        return;
+    }
+    session->paused = paused;
+    if (paused) {
+        session->prev_paused = NULL;
+        session->next_paused = paused_sessions;
+        if (paused_sessions) paused_sessions->prev_paused = session;
+        paused_sessions = session;
+    } else {
+        if (session->prev_paused) {
+            session->prev_paused->next_paused = session->next_paused;
+        } else {
+            paused_sessions = session->next_paused;
+        }
+        if (session->next_paused) {
+            session->next_paused->prev_paused = session->prev_paused;
+        }
+    }
+    session_update_events(epoll_fd, session);
+}
+
+// Whether the requests of a session can be answered now: the analyses still running answer first,
+// and a peer must read its responses before it is sent more
+bool session_can_process(const Session* session) {
+    return session->analyses < ANALYSIS_MAX_IN_FLIGHT && !queue_is_full(&session->conn);
+}
+
+// Sends what is queued for a session, then goes on with its requests if its output held them back
+void session_writable(int epoll_fd, Session* session) {
+    if (session->closed) {
+        return;
+    }
+    if (flush_queue(&session->conn)) {
+        fprintf(stderr, "%d Error: Failed to send to the client\n", session->conn.socket);
+        session_fail(session);
+        return;
+    }
+    if (session->paused && session_can_process(session)) {
+        session_process(epoll_fd, session);
+    }
+}
+
+/**
+ * @brief Sends what is queued for a session without waiting, and gives up on a peer which has not
+ * read anything for SEND_TIMEOUT_MS.
+ *
+ * @param session The session, closed on failure.
+ * @param now The monotonic time in milliseconds.
+ * @param timeout The event loop's timeout in milliseconds (-1 for none), shortened to the session's deadline.
+ */
+void session_flush(Session* session, double now, int* timeout) {
+    Connection* conn = &session->conn;
+    if (flush_queue(conn)) {
+        fprintf(stderr, "%d Error: Failed to send to the client\n", conn->socket);
+        session_fail(session);
+        return;
+    }
+    if (conn->queue_count == 0) {
+        session->sent_at = 0;
+        return;
+    }
+    if (session->sent_at == 0 || session->sent_mark != conn->bytes_sent) {
+        session->sent_mark = conn->bytes_sent;
+        session->sent_at = now;
+    } else if (now - session->sent_at >= SEND_TIMEOUT_MS) {
+        fprintf(stderr, "%d Error: Peer is not reading, giving up sending\n", conn->socket);
+        session_fail(session);
+        return;
+    }
+    int wait = (int) (session->sent_at + SEND_TIMEOUT_MS - now) + 1;
+    if (*timeout < 0 || wait < *timeout) {
+        *timeout = wait;
+    }
+}
+
+void session_readable(int epoll_fd, Session* session) {
+    if (session->closed) {
+        return;
+    }
+    if (session->paused) {
+        session_fail(session);  // Only hang ups are reported while paused
+        return;
+    }
+
+    ssize_t bytes_received = fill_buffer(&session->conn);
+    if (bytes_received == 0 || (bytes_received < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        session_fail(session);
+        return;
+    }
+    session_process(epoll_fd, session);
+}
+
+// Answers the whole requests buffered for a session
+void session_process(int epoll_fd, Session* session) {
+    mark_dirty(session);  // For the responses
+    while (!session->closed) {
+        // The analyses still running answer first, and responses the peer has not read yet
+        if (queue_is_full(&session->conn) && flush_queue(&session->conn)) {
+            fprintf(stderr, "%d Error: Failed to send to the client\n", session->conn.socket);
+            session_fail(session);
+            break;
+        }
+        if (!session_can_process(session)) {
+            session_set_paused(epoll_fd, session, true);
+            return;
+        }
+
+        uint32_t id;
+        size_t length;
+        bool invalid;
+        char* message = take_frame(&session->conn, &id, &length, &invalid);
+        if (!message) {
+            if (invalid) session_fail(session);
+            break;
+        }
 
-    while (true) {
         Request req = empty_request();
-        if (receive_request(client_socket, &req)) {
-            fprintf(stderr, "%d Error: could not get request\n", client_socket);
+        int error = parse_request(&session->conn, message, length, &req);
+        free(message);
+        if (error) {
+            fprintf(stderr, "%d Error: could not get request\n", session->conn.socket);
+            session_fail(session);
             break;
         }
+        req.id = id;
 
 //        print_request(&req);
 
+        // Every request but LOGIN acts for the user named first, who must be the one logged in here
+        if (req.action != LOGIN && !session_is(session, req.arguments[0])) {
+            fprintf(stderr, "%d Error: %s refused for %s\n", session->conn.socket,
+                    action_to_string(req.action), req.arguments[0]);
+            send_bool(&session->conn, req.id, false);
+            continue;
+        }
+
         switch (req.action) {
             case LOGIN: {
-                if (! login(client_socket, req.arguments, username)) {
-                    logged_in = true;  // set logged_in flag to true on successful login
-                }
-                continue;
+                login(session, req.id, req.arguments);
+                break;
             }
 
             case LIST: {
-                list(client_socket, req.arguments);
-                continue;
+                list(session, req.id, req.arguments);
+                break;
             }
 
             case CHALLENGE: {
-                challenge(client_socket, req.arguments);
-                continue;
+                challenge(session, req.id, req.arguments);
+                break;
             }
 
             case ACCEPT: {
-                accept_request(client_socket, req.arguments);
-                continue;
+                accept_request(session, req.id, req.arguments);
+                break;
             }
 
             case DECLINE: {
-                decline(client_socket, req.arguments);
-                continue;
+                decline(session, req.id, req.arguments);
+                break;
             }
 
-
             case GAME: {
-                get_game(client_socket, req.arguments);
-                continue;
+                get_game(session, req.id, req.arguments);
+                break;
             }
 
             case LIST_GAMES: {
-                get_all_games(client_socket, req.arguments);
-                continue;
+                get_all_games(session, req.id, req.arguments);
+                break;
             }
 
             case MOVE: {
-                move(client_socket, req.arguments);
-                continue;
+                move(session, req.id, req.arguments);
+                break;
+            }
+
+            case ANALYZE: {
+                analyze(session, req.id, req.arguments);
+                break;
+            }
+
+            case WATCH: {
+                watch(session, req.id, req.arguments);
+                break;
+            }
+
+            case WAIT_FOR_MOVE: {
+                wait_for_move(session, req.id, req.arguments);
+                break;
+            }
+
+            case GAMES_BATCH: {
+                get_games_batch(session, req.id, req.arguments);
+                break;
+            }
+
+            case SPECTATE: {
+                spectate(session, req.id, req.arguments);
+                break;
             }
         }
     }
+    session_set_paused(epoll_fd, session, false);
+}
+
+void session_close(int epoll_fd, Session* session) {
+    Connection* conn = &session->conn;
+    session_set_paused(epoll_fd, session, false);
+    unwatch_game(session);
+    cancel_analyses(session);
+    cancel_waits(session);
 
     // Log out at end
     // Handle disconnection cleanup if user is logged in
-    if (logged_in) {
-        printf("%d User %s disconnected, logging out\n", client_socket, username);
+    if (session->logged_in) {
+        printf("%d User %s disconnected, logging out\n", conn->socket, session->username);
         GameData gameData;
         if (parse_json(&gameData, JSON_FILENAME) == 0) {
             // Mark the user as offline
-            for (int i = 0; i < gameData.player_count; i++) {
-                if (strcmp(gameData.players[i].name, username) == 0) {
-                    gameData.players[i].online = false;
-                    break;
-                }
+            int player = session->player;
+            if (player < gameData.player_count && strcmp(gameData.players[player].name, session->username) == 0) {
+                gameData.players[player].online = false;
             }
 
             // Save updated game data to JSON
             if (save_to_json(JSON_FILENAME, &gameData) != 0) {
-                fprintf(stderr, "%d Error: Failed to save updated game data to JSON\n", client_socket);
+                fprintf(stderr, "%d Error: Failed to save updated game data to JSON\n", conn->socket);
             } else {
-                printf("%d Successfully logged out user %s\n", client_socket, username);
+                printf("%d Successfully logged out user %s\n", conn->socket, session->username);
             }
         } else {
-            fprintf(stderr, "%d Error: Failed to parse game data for logout\n", client_socket);
+            fprintf(stderr, "%d Error: Failed to parse game data for logout\n", conn->socket);
         }
     }
 
-    return 0;
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, conn->socket, NULL);
+    close(conn->socket);
+    connection_free(conn);
+
+    if (session->prev_session) {
+        session->prev_session->next_session = session->next_session;
+    } else {
+        all_sessions = session->next_session;
+    }
+    if (session->next_session) {
+        session->next_session->prev_session = session->prev_session;
+    }
+    free(session);
 }
@@ -5,67 +5,535 @@
 #ifndef AWALEGAME_SERVER_H
 #define AWALEGAME_SERVER_H
 
+#include <limits.h>
+
 #include "utils.h"
 #include "network.h"
+#include "analysis.h"
+
+#define WAIT_TIMEOUT_MS 30000      // A parked WAIT_FOR_MOVE is answered "not modified" after this
+#define MAX_WAITS_PER_SESSION 16
+
+typedef struct MoveWaiter MoveWaiter;
+
+// State kept by the server for each client connection
+typedef struct Session Session;
+struct Session {
+    Connection conn;         // Also holds the protocol negotiated at LOGIN
+    bool logged_in;
+    char username[MAX_NAME_LENGTH + 1];
+    int player;              // Index of the user in GameData.players (players are never removed)
+    int games[MAX_GAMES];    // Indices of the user's games in GameData.games, in the order of the store
+    int game_count;
+    int analyses;            // ANALYZE requests waiting for the pool, at most ANALYSIS_MAX_IN_FLIGHT
+    int watching;            // Index of the game pushed to this client after every move, -1 if none
+    Session* next_watcher;   // Next session watching the same game
+    MoveWaiter* waits;       // Its parked WAIT_FOR_MOVE requests
+    int wait_count;
+    bool paused;             // Requests are left unread until one of the analyses ends or the output is sent
+    uint32_t events;         // Events the event loop waits for on the socket
+    size_t sent_mark;        // conn.bytes_sent when the output last made progress
+    double sent_at;          // Monotonic time of that progress in milliseconds, 0 while nothing is queued
+    bool closed;             // Failed or disconnected, freed by the event loop once it is done with it
+    bool dirty;              // On dirty_sessions
+    Session* next_dirty;
+    Session* prev_paused;    // On paused_sessions while paused
+    Session* next_paused;
+    Session* prev_session;
+    Session* next_session;
+};
+
+// Every connected session, most recent first
+Session* all_sessions = NULL;
+
+// Sessions the event loop looks at before it waits again: output was queued for them or is left
+// to send, or they were closed. The others cost nothing per pass, however many are connected
+Session* dirty_sessions = NULL;
+
+// Sessions whose requests are held back, resumed by the event loop once they can go on
+Session* paused_sessions = NULL;
+
+void mark_dirty(Session* session) {
+    if (session->dirty) {
+        return;
+    }
+    session->dirty = true;
+    session->next_dirty = dirty_sessions;
+    dirty_sessions = session;
+}
+
+// Closes a session, the event loop frees it once it is done with it
+void session_fail(Session* session) {
+    session->closed = true;
+    mark_dirty(session);
+}
+
+// Sessions watching each game, indexed like GameData.games (games are never removed)
+Session* game_watchers[MAX_GAMES];
+
+// WAIT_FOR_MOVE request parked until its game moves or it times out
+struct MoveWaiter {
+    Session* session;
+    uint32_t id;
+    int game;                  // Index in GameData.games
+    uint32_t version;          // Version of the game the client has
+    double deadline;           // Monotonic time in milliseconds
+    int heap_index;            // Position in wait_timers
+    MoveWaiter* prev_in_game;
+    MoveWaiter* next_in_game;
+    MoveWaiter* next_in_session;
+};
+
+// Parked requests of each game, indexed like GameData.games
+MoveWaiter* game_waiters[MAX_GAMES];
+
+// Players and version of every game, kept in memory so that a client which has the latest version
+// of a game is answered without reading the store. The server is its only writer and refreshes it
+// whenever it saves games. The positions played are kept as well, for repetitions
+typedef struct {
+    char player0[MAX_NAME_LENGTH + 1];
+    char player1[MAX_NAME_LENGTH + 1];
+    uint32_t version;
+    RepetitionRing ring;    // Positions since the last capture, current one included
+    uint32_t ring_version;  // Version of the game the ring is for
+    bool ring_known;
+} GameVersion;
+
+GameVersion game_versions[MAX_GAMES];
+int game_version_count = 0;
+
+// Min-heap of the parked requests by deadline: the next one to time out is on top and any of them
+// is removed in O(log n), so that waking up costs nothing however many clients are waiting
+MoveWaiter** wait_timers = NULL;
+int wait_timer_count = 0;
+int wait_timer_capacity = 0;
+
+// ANALYZE request answered when its search completes
+typedef struct PendingAnalysis {
+    Session* session;
+    uint32_t id;
+    int index;                // Entry of the analysis pool
+    int time_ms;
+    double deadline;          // Monotonic time in milliseconds after which it fails
+    struct PendingAnalysis* next;
+} PendingAnalysis;
+
+PendingAnalysis* pending_analyses = NULL;
+
+double monotonic_ms() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec * 1000.0 + (double) now.tv_nsec / 1e6;
+}
+
+void remember_versions(const GameData* gameData) {
+    for (int i = 0; i < gameData->game_count; i++) {
+        strcpy(game_versions[i].player0, gameData->games[i].player0);
+        strcpy(game_versions[i].player1, gameData->games[i].player1);
+        game_versions[i].version = gameData->games[i].version;
+    }
+    game_version_count = gameData->game_count;
+}
+
+/**
+ * @brief Gives the positions played in a game, for repetitions.
+ *
+ * @details They are kept in memory after every move, and only rebuilt from the recorded moves when
+ * missing, such as for the first request about the game since the server started.
+ *
+ * @param index The game.
+ * @param game Its current state, read from the store.
+ * @param history Its recorded moves.
+ * @param ring Filled with the positions since the last capture, current one included.
+ *
+ * @return int Returns 0 on success, or -1 if they are unknown (the recorded moves are incomplete).
+ */
+int game_ring(int index, const Game* game, const MoveHistory* history, RepetitionRing* ring) {
+    GameVersion* kept = &game_versions[index];
+    if (!kept->ring_known || kept->ring_version != game->version) {
+        if (ring_from_history(game, history, &kept->ring)) {
+            kept->ring_known = false;
+            return -1;
+        }
+        kept->ring_version = game->version;
+        kept->ring_known = true;
+    }
+    *ring = kept->ring;
+    return 0;
+}
+
+// Keeps the positions of a game after a move, once game_versions has its new version. Those of a game
+// without recorded moves start from the first move the server saw
+void keep_ring(int index, const RepetitionRing* ring) {
+    game_versions[index].ring = *ring;
+    game_versions[index].ring_version = game_versions[index].version;
+    game_versions[index].ring_known = true;
+}
+
+// Whether a version given as a request argument is the latest of a game, without reading the store
+bool is_latest_version(int index, const char* version) {
+    char* end;
+    unsigned long value = strtoul(version, &end, 10);
+    return index >= 0 && version[0] && *end == '\0' && value == game_versions[index].version;
+}
+
+// Whether a request naming this user in args[0] may be served: only after LOGIN, and only for the user
+// logged in on the connection, so that nobody plays or reads games in someone else's name
+bool session_is(const Session* session, const char* username) {
+    return session->logged_in && strcmp(session->username, username) == 0;
+}
+
+// The player facing the session's user in one of their games
+const char* opponent_in(const Session* session, int index) {
+    const GameVersion* game = &game_versions[index];
+    return strcmp(game->player0, session->username) == 0 ? game->player1 : game->player0;
+}
+
+// Index of the user's game against an opponent, found among the session's games instead of the
+// whole store. Returns -1 if they have none
+int session_game(const Session* session, const char* opponent) {
+    for (int i = 0; i < session->game_count; i++) {
+        if (strcmp(opponent_in(session, session->games[i]), opponent) == 0) {
+            return session->games[i];
+        }
+    }
+    return -1;
+}
+
+// Index of the game between two players, in either order, found without reading the store.
+// Returns -1 if they have none
+int game_between(const char* player, const char* other) {
+    for (int i = 0; i < game_version_count; i++) {
+        const GameVersion* game = &game_versions[i];
+        if ((strcmp(game->player0, player) == 0 && strcmp(game->player1, other) == 0) ||
+            (strcmp(game->player0, other) == 0 && strcmp(game->player1, player) == 0)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Gives a new game to the sessions of both its players
+void add_session_game(int index) {
+    const GameVersion* game = &game_versions[index];
+    for (Session* session = all_sessions; session; session = session->next_session) {
+        if (session->game_count < MAX_GAMES && (session_is(session, game->player0) || session_is(session, game->player1))) {
+            session->games[session->game_count++] = index;
+        }
+    }
+}
+
+void timer_swap(int i, int j) {
+    MoveWaiter* waiter = wait_timers[i];
+    wait_timers[i] = wait_timers[j];
+    wait_timers[j] = waiter;
+    wait_timers[i]->heap_index = i;
+    wait_timers[j]->heap_index = j;
+}
+
+void timer_sift_up(int i) {
+    while (i > 0 && wait_timers[(i - 1) / 2]->deadline > wait_timers[i]->deadline) {
+        timer_swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+void timer_sift_down(int i) {
+    while (true) {
+        int smallest = i;
+        for (int child = 2 * i + 1; child <= 2 * i + 2 && child < wait_timer_count; child++) {
+            if (wait_timers[child]->deadline < wait_timers[smallest]->deadline) smallest = child;
+        }
+        if (smallest == i) return;
+        timer_swap(i, smallest);
+        i = smallest;
+    }
+}
+
+// Returns 0 on success, or -1 if the heap could not grow
+int timer_push(MoveWaiter* waiter) {
+    if (wait_timer_count == wait_timer_capacity) {
+        int capacity = wait_timer_capacity ? wait_timer_capacity * 2 : 64;
+        MoveWaiter** timers = realloc(wait_timers, sizeof(MoveWaiter*) * capacity);
+        if (!timers) {
+            return -1;
+        }
+        wait_timers = timers;
+        wait_timer_capacity = capacity;
+    }
+    waiter->heap_index = wait_timer_count;
+    wait_timers[wait_timer_count++] = waiter;
+    timer_sift_up(waiter->heap_index);
+    return 0;
+}
+
+void timer_remove(MoveWaiter* waiter) {
+    int i = waiter->heap_index;
+    wait_timer_count--;
+    if (i == wait_timer_count) {
+        return;
+    }
+    wait_timers[i] = wait_timers[wait_timer_count];
+    wait_timers[i]->heap_index = i;
+    timer_sift_up(i);
+    timer_sift_down(wait_timers[i]->heap_index);
+}
+
+// Parks a WAIT_FOR_MOVE request, returns 0 on success or -1 on failure
+int park_waiter(Session* session, uint32_t id, int game, uint32_t version) {
+    MoveWaiter* waiter = malloc(sizeof(MoveWaiter));
+    if (!waiter) {
+        return -1;
+    }
+    waiter->session = session;
+    waiter->id = id;
+    waiter->game = game;
+    waiter->version = version;
+    waiter->deadline = monotonic_ms() + WAIT_TIMEOUT_MS;
+    if (timer_push(waiter)) {
+        free(waiter);
+        return -1;
+    }
+
+    waiter->prev_in_game = NULL;
+    waiter->next_in_game = game_waiters[game];
+    if (game_waiters[game]) game_waiters[game]->prev_in_game = waiter;
+    game_waiters[game] = waiter;
+    waiter->next_in_session = session->waits;
+    session->waits = waiter;
+    session->wait_count++;
+    return 0;
+}
+
+// Removes a parked request, once answered or given up
+void unpark_waiter(MoveWaiter* waiter) {
+    timer_remove(waiter);
+
+    if (waiter->prev_in_game) {
+        waiter->prev_in_game->next_in_game = waiter->next_in_game;
+    } else {
+        game_waiters[waiter->game] = waiter->next_in_game;
+    }
+    if (waiter->next_in_game) {
+        waiter->next_in_game->prev_in_game = waiter->prev_in_game;
+    }
+
+    Session* session = waiter->session;
+    MoveWaiter** link = &session->waits;
+    while (*link != waiter) {
+        link = &(*link)->next_in_session;
+    }
+    *link = waiter->next_in_session;
+    session->wait_count--;
+    free(waiter);
+}
+
+/**
+ * @brief Answers the requests parked on a game which has just moved.
+ *
+ * @param index The game's index in GameData.games.
+ * @param game The game after the move.
+ * @param delta The changes made by the move, sent to the clients which had the previous version.
+ */
+void wake_waiters(int index, const Game* game, const GameDelta* delta) {
+    MoveWaiter* waiter = game_waiters[index];
+    while (waiter) {
+        MoveWaiter* next = waiter->next_in_game;
+        Session* session = waiter->session;
+        if (!session->closed) {
+            int error = waiter->version + 1 == delta->version ? send_delta(&session->conn, waiter->id, delta)
+                                                              : send_game(&session->conn, waiter->id, game);
+            if (error) session_fail(session);
+            mark_dirty(session);
+        }
+        unpark_waiter(waiter);
+        waiter = next;
+    }
+}
+
+/**
+ * @brief Answers the parked requests whose deadline has passed.
+ *
+ * @return int Milliseconds until the next deadline, or -1 if nothing is parked.
+ */
+int expire_waiters() {
+    double now = monotonic_ms();
+    while (wait_timer_count > 0 && wait_timers[0]->deadline <= now) {
+        MoveWaiter* waiter = wait_timers[0];
+        if (!waiter->session->closed && send_not_modified(&waiter->session->conn, waiter->id)) {
+            session_fail(waiter->session);
+        }
+        mark_dirty(waiter->session);
+        unpark_waiter(waiter);
+    }
+    return wait_timer_count > 0 ? (int) (wait_timers[0]->deadline - now) + 1 : -1;
+}
+
+// Gives up the parked requests of a session that is closing
+void cancel_waits(Session* session) {
+    while (session->waits) {
+        unpark_waiter(session->waits);
+    }
+}
+
+// Stops pushing a game to a session
+void unwatch_game(Session* session) {
+    if (session->watching < 0) {
+        return;
+    }
+    Session** link = &game_watchers[session->watching];
+    while (*link && *link != session) {
+        link = &(*link)->next_watcher;
+    }
+    if (*link) {
+        *link = session->next_watcher;
+    }
+    session->watching = -1;
+    session->next_watcher = NULL;
+}
+
+// Pushes a game to a session after every move, replacing the game it watched before
+void watch_game(Session* session, int index) {
+    unwatch_game(session);
+    session->watching = index;
+    session->next_watcher = game_watchers[index];
+    game_watchers[index] = session;
+}
+
+/**
+ * @brief Pushes the changes of a move to every session watching the game, as a message with correlation ID 0.
+ *
+ * @param index The game's index in GameData.games.
+ * @param game The game after the move.
+ * @param delta The changes made by the move.
+ * @param except Session which made the move and already gets them in its response, can be NULL.
+ *
+ * @details The message is encoded once per protocol and the same frame is queued to every
+ * watcher, so a game followed by many spectators costs one serialization per move. A watcher
+ * whose output is full reads too slowly to keep up: the changes it has not started receiving are
+ * dropped for the whole game, which it can apply instead.
+ */
+void notify_watchers(int index, const Game* game, const GameDelta* delta, const Session* except) {
+    SharedFrame* deltas[2] = {NULL, NULL};
+    SharedFrame* games[2] = {NULL, NULL};
+
+    for (Session* watcher = game_watchers[index]; watcher; watcher = watcher->next_watcher) {
+        if (watcher == except || watcher->closed) {
+            continue;
+        }
+        Connection* conn = &watcher->conn;
+        PROTOCOL protocol = conn->protocol;
+        SharedFrame** frames = deltas;
+        if (queue_is_full(conn)) {
+            printf("%d Watcher behind, pushing the whole game\n", conn->socket);
+            drop_shared_frames(conn);
+            frames = games;
+        }
+        if (!frames[protocol]) {
+            frames[protocol] = frames == games ? shared_game_frame(protocol, 0, game) : shared_delta_frame(protocol, 0, delta);
+        }
+        if (!frames[protocol] || queue_frame(conn, frames[protocol])) {
+            fprintf(stderr, "%d Error: Failed to push game state\n", conn->socket);
+            session_fail(watcher);
+        }
+        mark_dirty(watcher);
+    }
+
+    for (int i = 0; i < 2; i++) {
+        shared_frame_release(deltas[i]);
+        shared_frame_release(games[i]);
+    }
+}
+
+// Names must fit in the store and contain no comma, which separates the opponents of GAMES_BATCH
+bool valid_username(const char* name) {
+    return strlen(name) <= MAX_NAME_LENGTH && strchr(name, ',') == NULL;
+}
 
 
 /**
  * @brief Handles a login request by validating the username, updating player status, and saving changes.
  *
- * @param socket The client socket.
- * @param args args[0] = The username the client is trying to log in with.
- * @param name The string where the logged-in player's username will be stored if successful.
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = The username the client is trying to log in with,
+ * args[1] = "binary" to switch the connection to the binary protocol (replied to with "binary" instead of "true").
  *
  * @return int Returns 0 on successful login, or -1 if there is an error.
  */
-int login(int socket, const char args[3][MAX_ARG_LENGTH], char* name) {
-    printf("%d LOGIN\n", socket);
+int login(Session* session, uint32_t id, const char args[MAX_ARGS][MAX_ARG_LENGTH]) {
+    Connection* conn = &session->conn;
+    printf("%d LOGIN\n", conn->socket);
 
     GameData gameData;
     if (parse_json(&gameData, JSON_FILENAME)) {
         init_game_data(&gameData);  // Fallback for if the file has gone missing
     }
 
-    // Check that username is not longer than limit
-    if (strlen(args[0]) > MAX_NAME_LENGTH) {
-        fprintf(stderr, "%d Error: Name too long\n", socket);
-        send(socket, "false", 5, 0);
+    // Check that username is not longer than limit and has no comma
+    if (!valid_username(args[0])) {
+        fprintf(stderr, "%d Error: Name too long or containing a comma\n", conn->socket);
+        send_bool(conn, id, false);
+        return -1;
+    }
+
+    // A connection stays with the user it logged in as, its games and pushes are theirs
+    if (session->logged_in && strcmp(session->username, args[0]) != 0) {
+        fprintf(stderr, "%d Error: Already logged in as %s\n", conn->socket, session->username);
+        send_bool(conn, id, false);
         return -1;
     }
 
     // Check if the username exists in the player list
-    bool userExists = false;
+    int player = -1;
     for (int i = 0; i < gameData.player_count; i++) {
         if (strcmp(gameData.players[i].name, args[0]) == 0) {
             // Username exists, set the player as online
             gameData.players[i].online = true;
-            userExists = true;
+            player = i;
             break;
         }
     }
 
     // If the user does not exist, add them to the list
-    if (!userExists) {
+    if (player < 0) {
         if (gameData.player_count < MAX_PLAYERS) {
+            player = gameData.player_count;
             strcpy(gameData.players[gameData.player_count].name, args[0]);
             gameData.players[gameData.player_count].online = true;
             gameData.player_count++; // Increment player count
         } else {
-            fprintf(stderr, "%d Error: Player list is full\n", socket);
-            send(socket, "false", 5, 0);
+            fprintf(stderr, "%d Error: Player list is full\n", conn->socket);
+            send_bool(conn, id, false);
             return -1;
         }
     }
 
     // Save the updated GameData back to the JSON file
     if (save_to_json(JSON_FILENAME, &gameData)) {
-        fprintf(stderr, "%d Error: Failed to save updated game data to JSON\n", socket);
-        send(socket, "false", 5, 0);
+        fprintf(stderr, "%d Error: Failed to save updated game data to JSON\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    strcpy(name, args[0]);
-    send(socket, "true", 4, 0);
+    // Later requests find the user's games through the session instead of searching the store by name
+    strcpy(session->username, args[0]);
+    session->logged_in = true;
+    session->player = player;
+    session->game_count = 0;
+    for (int i = 0; i < gameData.game_count; i++) {
+        if (strcmp(gameData.games[i].player0, args[0]) == 0 || strcmp(gameData.games[i].player1, args[0]) == 0) {
+            session->games[session->game_count++] = i;
+        }
+    }
+
+    // The client can ask for the binary protocol, used by both sides from the next message
+    if (conn->protocol == PROTOCOL_JSON && strcmp(args[1], PROTOCOL_BINARY_NAME) == 0) {
+        send_string(conn, id, PROTOCOL_BINARY_NAME);
+        conn->protocol = PROTOCOL_BINARY;
+        return 0;
+    }
+    send_bool(conn, id, true);
     return 0;
 }
 
@@ -73,48 +541,37 @@ int login(int socket, const char args[3][MAX_ARG_LENGTH], char* name) {
 /**
  * @brief Retrieves and sends a list of online players, excluding a given username.
  *
- * @param socket The client socket.
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
  * @param args args[0] = The username of the client requesting the list of online players.
  *
  * @return int Returns 0 on success, or -1 if there is an error.
  */
-int list(int socket, char args[3][255]) {
-    printf("%d LIST\n", socket);
+int list(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d LIST\n", conn->socket);
 
     GameData gameData;
     if (parse_json(&gameData, JSON_FILENAME)) {
-        fprintf(stderr, "%d Error: Failed to parse JSON\n", socket);
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    // Create a JSON array to hold online players
-    cJSON *onlinePlayers = cJSON_CreateArray();
-
+    // Collect the online players
+    const char* onlinePlayers[MAX_PLAYERS];
+    int count = 0;
     for (int i = 0; i < gameData.player_count; i++) {
-        if (gameData.players[i].online && strcmp(gameData.players[i].name, args[0]) != 0) {
-            // Add the online player's name to the JSON array
-            cJSON_AddItemToArray(onlinePlayers, cJSON_CreateString(gameData.players[i].name));
+        if (gameData.players[i].online && i != session->player) {
+            onlinePlayers[count++] = gameData.players[i].name;
         }
     }
 
-    // Serialize the JSON array to a string
-    char *jsonString = cJSON_PrintUnformatted(onlinePlayers);
-    cJSON_Delete(onlinePlayers); // Free JSON object memory
-
-    if (!jsonString) {
-        fprintf(stderr, "%d Error: Failed to serialize JSON\n", socket);
+    // Send the list to the client
+    if (send_names(conn, id, onlinePlayers, count)) {
+        fprintf(stderr, "%d Error: Failed to send online players list\n", conn->socket);
         return -1;
     }
-
-    // Send the JSON string to the client
-    size_t jsonStringLength = strlen(jsonString);
-    if (send(socket, jsonString, jsonStringLength, 0) == -1) {
-        fprintf(stderr, "%d Error: Failed to send online players list\n", socket);
-        free(jsonString);
-        return -1;
-    }
-
-    free(jsonString); // Free the serialized JSON string
     return 0;
 }
 
@@ -122,7 +579,8 @@ int list(int socket, char args[3][255]) {
 /**
  * @brief Handles a challenge request to create a new game between two players.
  *
- * @param socket The client socket.
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
  * @param args args[0] = The username of the player issuing the challenge,
  * args[1] = The username of the player being challenged.
  *
@@ -130,70 +588,71 @@ int list(int socket, char args[3][255]) {
  *
  */
 // TODO: currently just creates a new game, should add a request to the person being challenged
-int challenge(int socket, char args[3][255]) {
-    printf("%d CHALLENGE\n", socket);
+int challenge(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d CHALLENGE\n", conn->socket);
 
-    // Check challenger is not same as recipient
-    if (strcmp(args[0], args[1]) == 0) {
-        send(socket, "false", 5, 0);
+    // Check challenger is not same as recipient, and that the recipient could log in
+    if (strcmp(args[0], args[1]) == 0 || !valid_username(args[1])) {
+        send_bool(conn, id, false);
         return -1;
     }
 
     // Get game data from json
     GameData gameData;
     if (parse_json(&gameData, JSON_FILENAME)) {
-        fprintf(stderr, "%d Error: Failed to parse JSON\n", socket);
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
     // Check there is not already a game between these two
-    bool exists = false;
-    for (int i = 0; i < gameData.game_count; i++) {
-        if ((strcmp(gameData.games[i].player0, args[0]) == 0 && strcmp(gameData.games[i].player1, args[1]) == 0) ||
-        (strcmp(gameData.games[i].player0, args[1]) == 0 && strcmp(gameData.games[i].player1, args[0]) == 0)) {
-            exists = true;
-            break;
-        }
-    }
-    if (exists) {
-        send(socket, "false", 5, 0);
+    if (session_game(session, args[1]) >= 0) {
+        send_bool(conn, id, false);
         return -1;
     }
 
     // If not, assume acceptance and create a new game
     if (gameData.game_count >= MAX_GAMES) {
-        fprintf(stderr, "%d Error: Maximum number of games reached\n", socket);
-        send(socket, "false", 5, 0);
+        fprintf(stderr, "%d Error: Maximum number of games reached\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
     Game *newGame = &gameData.games[gameData.game_count];
     create_game(newGame, args[0], args[1]);
+    init_history(&gameData.histories[gameData.game_count]);
     gameData.game_count++;
 
     if (save_to_json(JSON_FILENAME, &gameData)) {
-        fprintf(stderr, "%d Error: could not update json file\n", socket);
-        send(socket, "false", 5, 0);
+        fprintf(stderr, "%d Error: could not update json file\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
+    remember_versions(&gameData);
+    add_session_game(gameData.game_count - 1);
 
-    send(socket, "true", 4, 0);
+    send_bool(conn, id, true);
     return 0;
 }
 
 
 // TODO
-int accept_request(int socket, char args[3][255]) {
-    printf("%d ACCEPT\n", socket);
+int accept_request(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d ACCEPT\n", conn->socket);
     fprintf(stderr, "Not yet implemented\n");
+    send_bool(conn, id, false);  // Every request gets a reply, or the client would wait forever
     return 0;
 }
 
 
 // TODO
-int decline(int socket, char args[3][255]) {
-    printf("%d DECLINE\n", socket);
+int decline(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d DECLINE\n", conn->socket);
     fprintf(stderr, "Not yet implemented\n");
+    send_bool(conn, id, false);  // Every request gets a reply, or the client would wait forever
     return 0;
 }
 
@@ -201,132 +660,345 @@ int decline(int socket, char args[3][255]) {
 /**
  * @brief Retrieves the game state for the specified players and sends it to the client.
  *
- * @param socket The client socket.
- * @param args args[0] = Player0's username, args[1] = Player1's username.
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = The user's username, args[1] = The opponent's username,
+ * args[2] = Optional number of moves, to get the position after that many moves instead of the current one,
+ * args[3] = Optional version of the game the client has (if_version), answered "not modified" if still the latest.
  *
  * @return int Returns 0 on success, or -1 on failure.
  *
  * @details If no game is found, or if any error occurs (e.g., JSON parsing or sending),
  * an error message is logged, and "false" is sent to the client.
  */
-int get_game(int socket, char args[3][255]) {
-    printf("%d GAME\n", socket);
+int get_game(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d GAME\n", conn->socket);
+    // Nothing is read nor serialized for a client which already has the game
+    int index = session_game(session, args[1]);
+    if (index >= 0 && args[3][0] && !args[2][0] && is_latest_version(index, args[3])) {
+        return send_not_modified(conn, id);
+    }
+
     GameData gameData;
     if (parse_json(&gameData, JSON_FILENAME)) {
-        fprintf(stderr, "%d Error: Failed to parse JSON\n", socket);
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    // Find the game where players match args[0] and args[1] in any order
-    int index = find_game(args[0], args[1], &gameData);
-
-    if (index < 0) {
+    if (index < 0 || index >= gameData.game_count) {
         // No game found
-        fprintf(stderr, "%d Error: No game found for players %s and %s\n", socket, args[0], args[1]);
-        send(socket, "false", 5, 0);
+        fprintf(stderr, "%d Error: No game found for players %s and %s\n", conn->socket, args[0], args[1]);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    // Convert the found game to a JSON string
-    char* json_string = game_to_json_string(&(gameData.games[index]));
-    if (json_string == NULL) {
-        fprintf(stderr, "%d Error: Failed to convert game to JSON\n", socket);
-        send(socket, "false", 5, 0);
+    // Past position, rebuilt from the recorded moves
+    Game* game = &gameData.games[index];
+    Game past;
+    if (args[2][0]) {
+        int ply = convert_and_validate(args[2], 0, MAX_HISTORY);
+        if (ply < 0 || game_at_ply(game, &gameData.histories[index], ply, &past)) {
+            fprintf(stderr, "%d Error: No position after %s moves\n", conn->socket, args[2]);
+            send_bool(conn, id, false);
+            return -1;
+        }
+        game = &past;
+    }
+
+    // Send the found game to the client
+    if (send_game(conn, id, game)) {
+        fprintf(stderr, "%d Error: Failed to send game state\n", conn->socket);
         return -1;
     }
+    return 0;
+}
 
-    // Send the JSON string to the client
-    if (send(socket, json_string, strlen(json_string), 0) == -1) {
-        fprintf(stderr, "%d Error: Failed to send game state\n", socket);
-        free(json_string);
+
+/**
+ * @brief Sends the current state of a game, then pushes it again to the client after every move.
+ *
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = The user's username, args[1] = The opponent's username (empty to stop watching).
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details A session watches at most one game, watching another replaces it. The pushed
+ * games are sent like a response, with correlation ID 0.
+ */
+int watch(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d WATCH\n", conn->socket);
+
+    if (!args[1][0]) {
+        unwatch_game(session);
+        send_bool(conn, id, true);
+        return 0;
+    }
+
+    GameData gameData;
+    if (parse_json(&gameData, JSON_FILENAME)) {
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    free(json_string); // Free the JSON string
+    int index = session_game(session, args[1]);
+    if (index < 0 || index >= gameData.game_count) {
+        fprintf(stderr, "%d Error: No game found for players %s and %s\n", conn->socket, args[0], args[1]);
+        send_bool(conn, id, false);
+        return -1;
+    }
+
+    watch_game(session, index);
+    if (send_game(conn, id, &gameData.games[index])) {
+        fprintf(stderr, "%d Error: Failed to send game state\n", conn->socket);
+        return -1;
+    }
     return 0;
 }
 
 
 /**
- * @brief Finds all the games a given user has and sends a list of the opponent names to the client.
+ * @brief Sends the current state of the game between two players, then pushes its changes to the
+ * client after every move, like WATCH.
  *
- * @param socket The client socket.
- * @param args args[0] = Player's username.
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = The user's username, args[1] and args[2] = The players of the game, in
+ * either order (args[1] empty to stop).
  *
  * @return int Returns 0 on success, or -1 on failure.
  *
- * @details If any error occurs (e.g., JSON parsing or sending),
- * an error message is logged, and "false" is sent to the client.
+ * @details Any logged in user can follow any game, it replaces the game the session watched
+ * before. Spectators share the frames encoded for each move, see notify_watchers.
  */
-int get_all_games(int socket, char args[3][255]) {
-    printf("%d LIST_GAMES\n", socket);
+int spectate(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d SPECTATE\n", conn->socket);
+
+    if (!args[1][0]) {
+        unwatch_game(session);
+        send_bool(conn, id, true);
+        return 0;
+    }
+
+    int index = game_between(args[1], args[2]);
+    if (index < 0) {
+        fprintf(stderr, "%d Error: No game found for players %s and %s\n", conn->socket, args[1], args[2]);
+        send_bool(conn, id, false);
+        return -1;
+    }
 
     GameData gameData;
     if (parse_json(&gameData, JSON_FILENAME)) {
-        fprintf(stderr, "%d Error: Failed to parse JSON\n", socket);
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
+        return -1;
+    }
+    if (index >= gameData.game_count) {
+        fprintf(stderr, "%d Error: No game found for players %s and %s\n", conn->socket, args[1], args[2]);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    // Create a JSON array to hold players
-    cJSON *games = cJSON_CreateArray();
+    watch_game(session, index);
+    if (send_game(conn, id, &gameData.games[index])) {
+        fprintf(stderr, "%d Error: Failed to send game state\n", conn->socket);
+        return -1;
+    }
+    return 0;
+}
 
 
-    for (int i = 0; i < gameData.game_count; i++) {
-        if (strcmp(gameData.games[i].player0, args[0]) == 0) {
-            // Add the other player's name to the JSON array
-            cJSON_AddItemToArray(games, cJSON_CreateString(gameData.games[i].player1));
-        } else if (strcmp(gameData.games[i].player1, args[0]) == 0) {
-            // Add the other player's name to the JSON array
-            cJSON_AddItemToArray(games, cJSON_CreateString(gameData.games[i].player0));
+/**
+ * @brief Replies once a game has moved past the version the client has (long polling).
+ *
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = The user's username, args[1] = The opponent's username,
+ * args[2] = The version of the game the client has.
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details A game already past that version is sent at once. Otherwise the request is parked
+ * without any work until the next move, answered with its changes, or until WAIT_TIMEOUT_MS
+ * have passed, answered "not modified". For clients which cannot take pushes from WATCH.
+ */
+int wait_for_move(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d WAIT_FOR_MOVE\n", conn->socket);
+
+    // The usual case, the client has the latest version: park it without reading the store
+    int index = session_game(session, args[1]);
+    if (index >= 0 && is_latest_version(index, args[2])) {
+        if (session->wait_count >= MAX_WAITS_PER_SESSION || park_waiter(session, id, index, game_versions[index].version)) {
+            fprintf(stderr, "%d Error: Could not park the request\n", conn->socket);
+            send_bool(conn, id, false);
+            return -1;
         }
+        return 0;
     }
 
-    // Serialize the JSON array to a string
-    char *jsonString = cJSON_PrintUnformatted(games);
-    cJSON_Delete(games); // Free JSON object memory
+    GameData gameData;
+    if (parse_json(&gameData, JSON_FILENAME)) {
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
+        return -1;
+    }
 
-    if (!jsonString) {
-        fprintf(stderr, "%d Error: Failed to serialize JSON\n", socket);
+    int version = convert_and_validate(args[2], 0, INT_MAX);
+    if (index < 0 || index >= gameData.game_count || version < 0) {
+        fprintf(stderr, "%d Error: No game found for players %s and %s\n", conn->socket, args[0], args[1]);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    // Send the JSON string to the client
-    size_t jsonStringLength = strlen(jsonString);
-    if (send(socket, jsonString, jsonStringLength, 0) == -1) {
-        fprintf(stderr, "%d Error: Failed to send online players list\n", socket);
-        free(jsonString);
+    if (gameData.games[index].version != (uint32_t) version) {
+        if (send_game(conn, id, &gameData.games[index])) {
+            fprintf(stderr, "%d Error: Failed to send game state\n", conn->socket);
+            return -1;
+        }
+        return 0;
+    }
+
+    if (session->wait_count >= MAX_WAITS_PER_SESSION || park_waiter(session, id, index, (uint32_t) version)) {
+        fprintf(stderr, "%d Error: Could not park the request\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
+    return 0;
+}
+
 
-    free(jsonString); // Free the serialized JSON string
+/**
+ * @brief Finds all the games a given user has and sends a list of the opponent names to the client.
+ *
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = Player's username.
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details The opponents come from the games of the session, the store is not read.
+ */
+int get_all_games(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d LIST_GAMES\n", conn->socket);
+
+    // Collect the opponents
+    const char* opponents[MAX_GAMES];
+    for (int i = 0; i < session->game_count; i++) {
+        opponents[i] = opponent_in(session, session->games[i]);
+    }
+    int count = session->game_count;
+
+    // Send the list to the client
+    if (send_names(conn, id, opponents, count)) {
+        fprintf(stderr, "%d Error: Failed to send games list\n", conn->socket);
+        return -1;
+    }
+    return 0;
+}
+
+
+/**
+ * @brief Sends several games of a player in one response, for a dashboard of their games.
+ *
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = Player's username, args[1] = Opponents separated by commas (empty for all),
+ * args[2] = "active" to leave out the games which are over.
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details The games are those of the session, in the order of the store. Opponents with
+ * no game against the player are left out. The games are sent as a JSON array, or a count then
+ * the games in binary.
+ */
+int get_games_batch(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d GAMES_BATCH\n", conn->socket);
+
+    GameData gameData;
+    if (parse_json(&gameData, JSON_FILENAME)) {
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
+        return -1;
+    }
+
+    // Split the opponents in place
+    char* opponents[MAX_GAMES];
+    int opponent_count = 0;
+    for (char* name = args[1]; *name && opponent_count < MAX_GAMES; ) {
+        opponents[opponent_count++] = name;
+        char* comma = strchr(name, ',');
+        if (!comma) break;
+        *comma = '\0';
+        name = comma + 1;
+    }
+    bool active = strcmp(args[2], "active") == 0;
+
+    const Game* games[MAX_GAMES];
+    int count = 0;
+    for (int i = 0; i < session->game_count; i++) {
+        if (session->games[i] >= gameData.game_count) {
+            continue;
+        }
+        const Game* game = &gameData.games[session->games[i]];
+        const char* opponent = opponent_in(session, session->games[i]);
+        if (active && game->current_state != MOVE_PLAYER_0 && game->current_state != MOVE_PLAYER_1) {
+            continue;
+        }
+
+        bool wanted = opponent_count == 0;
+        for (int j = 0; j < opponent_count && !wanted; j++) {
+            wanted = strcmp(opponents[j], opponent) == 0;
+        }
+        if (wanted) {
+            games[count++] = game;
+        }
+    }
+
+    if (send_games(conn, id, games, count)) {
+        fprintf(stderr, "%d Error: Failed to send games\n", conn->socket);
+        return -1;
+    }
     return 0;
 }
 
 
 /**
- * @brief Handles a player's move in the game, updates the game state, and returns the updated state.
+ * @brief Handles a player's move in the game, updates the game state, and returns the changes.
  *
- * @param socket The client socket.
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
  * @param args args[0] = The player's username, args[1] = The opponent's username,
  * args[2] = The move (slot number) as a string.
  *
  * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details The reply is a GameDelta rather than the whole game: the changed pits, the capture,
+ * the score and state, and the new version of the game. Its watchers get the same changes.
  */
-int move(int socket, char args[3][255]) {
-    printf("%d MOVE\n", socket);
+int move(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d MOVE\n", conn->socket);
 
     // Get game data
     GameData gameData;
     if (parse_json(&gameData, JSON_FILENAME)) {
-        fprintf(stderr, "%d Error: Failed to parse JSON\n", socket);
-        send(socket, "false", 5, 0);
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
     // Find game
-    int index = find_game(args[0], args[1], &gameData);
-    if (index < 0) {
-        send(socket, "false", 5, 0);
+    int index = session_game(session, args[1]);
+    if (index < 0 || index >= gameData.game_count) {
+        send_bool(conn, id, false);
         return -1;
     }
 
@@ -337,18 +1009,21 @@ int move(int socket, char args[3][255]) {
     printf("Slot: %d\n", slot);
 
     if (slot < 0) {
-        send(socket, "false", 5, 0);
+        send_bool(conn, id, false);
         return -1;
     }
 
     // Check the correct person is trying to move
     if (! (gameData.games[index].current_state == MOVE_PLAYER_0 && strcmp(args[0], gameData.games[index].player0) == 0) &&
         ! (gameData.games[index].current_state == MOVE_PLAYER_1 && strcmp(args[0], gameData.games[index].player1) == 0)) {
-        fprintf(stderr, "%d Error: Invalid attempt at move\n", socket);
+        fprintf(stderr, "%d Error: Invalid attempt at move\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
     // Check if this is a surrender
+    Game before = gameData.games[index];
+    RepetitionRing ring;
     if (slot == 0) {
         if (gameData.games[index].current_state == MOVE_PLAYER_0) {
             gameData.games[index].current_state = WIN_PLAYER_1;
@@ -356,35 +1031,238 @@ int move(int socket, char args[3][255]) {
             gameData.games[index].current_state = WIN_PLAYER_0;
         }
     } else {
-        // Perform the player's turn
-        int has_won = play_turn(&gameData.games[index], slot - 1);
-        if (has_won && gameData.games[index].current_state == MOVE_PLAYER_0) {
-            gameData.games[index].current_state = WIN_PLAYER_0;
-        } else if (has_won && gameData.games[index].current_state == MOVE_PLAYER_1) {
-            gameData.games[index].current_state = WIN_PLAYER_1;
+        // Perform the player's turn, the game ends (or is adjudicated) if its position repeats
+        if (game_ring(index, &gameData.games[index], &gameData.histories[index], &ring)) {
+            ring_clear(&ring);  // Moves before this one are unknown, only later repetitions are caught
+            ring_push(&ring, hash_game(&gameData.games[index]));
         }
+        record_move(&gameData.histories[index], slot - 1);
+        play_turn_tracked(&gameData.games[index], slot - 1, &ring, engine_tablebase);
     }
 
+    gameData.games[index].version++;
+
     // Save the updated game data back to the JSON file
     if (save_to_json(JSON_FILENAME, &gameData) != 0) {
-        fprintf(stderr, "%d Error: Failed to save updated game data to JSON\n", socket);
+        fprintf(stderr, "%d Error: Failed to save updated game data to JSON\n", conn->socket);
+        send_bool(conn, id, false);
+        return -1;
+    }
+    remember_versions(&gameData);
+    if (slot != 0) {
+        keep_ring(index, &ring);
+    }
+
+    // Send the changes to the client, and to the other clients watching the game
+    GameDelta delta;
+    diff_games(&before, &gameData.games[index], slot, &delta);
+    notify_watchers(index, &gameData.games[index], &delta, session);
+    wake_waiters(index, &gameData.games[index], &delta);
+    if (send_delta(conn, id, &delta)) {
+        fprintf(stderr, "%d Error: Failed to send game state\n", conn->socket);
         return -1;
     }
+    return 0;
+}
 
-    // Broadcast the updated game state to all players
-    char* json_string = game_to_json_string(&gameData.games[index]);
 
-    // Send the JSON string to the client
-    if (send(socket, json_string, strlen(json_string), 0) == -1) {
-        fprintf(stderr, "%d Error: Failed to send game state\n", socket);
-        free(json_string);  // Free the string created by cJSON_Print
+/**
+ * @brief Sends the result of an analysis.
+ *
+ * @param conn The client connection.
+ * @param id The correlation ID of the ANALYZE request.
+ * @param analysis The result.
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details Moves and the principal variation are slots from 1 to 12 (as in MOVE), the score is
+ * for the player to move. In binary: move, score (signed), depth, nodes, cached, then the number
+ * of pv moves and the moves.
+ */
+int send_analysis(Connection* conn, uint32_t id, const Analysis* analysis) {
+    if (conn->protocol == PROTOCOL_BINARY) {
+        BinaryWriter writer;
+        writer_init(&writer);
+        write_byte(&writer, BINARY_ANALYSIS);
+        write_varint(&writer, analysis->move + 1);
+        write_signed(&writer, analysis->score);
+        write_varint(&writer, analysis->depth);
+        write_varint(&writer, analysis->nodes);
+        write_byte(&writer, analysis->cached);
+        write_varint(&writer, analysis->pv_length);
+        for (int i = 0; i < analysis->pv_length; i++) {
+            write_varint(&writer, analysis->pv[i] + 1);
+        }
+        if (send_writer(conn, id, &writer)) {
+            fprintf(stderr, "%d Error: Failed to send analysis\n", conn->socket);
+            return -1;
+        }
+        return 0;
+    }
+
+    cJSON* json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(json, "move", analysis->move + 1);
+    cJSON_AddNumberToObject(json, "score", analysis->score);
+    cJSON_AddNumberToObject(json, "depth", analysis->depth);
+    cJSON_AddNumberToObject(json, "nodes", (double) analysis->nodes);
+    cJSON_AddBoolToObject(json, "cached", analysis->cached);
+    cJSON* pv = cJSON_AddArrayToObject(json, "pv");
+    for (int i = 0; i < analysis->pv_length; i++) {
+        cJSON_AddItemToArray(pv, cJSON_CreateNumber(analysis->pv[i] + 1));
+    }
+
+    char* json_string = cJSON_PrintUnformatted(json);
+    cJSON_Delete(json);
+    if (!json_string) {
+        fprintf(stderr, "%d Error: Failed to serialize JSON\n", conn->socket);
+        send_bool(conn, id, false);
         return -1;
     }
 
-    // Free the JSON objects after use
-    free(json_string);  // Free the string created by cJSON_Print
+    if (send_string(conn, id, json_string)) {
+        fprintf(stderr, "%d Error: Failed to send analysis\n", conn->socket);
+        free(json_string);
+        return -1;
+    }
+
+    free(json_string);
     return 0;
 }
 
 
+/**
+ * @brief Analyses the current position of a game with the engine and sends the result to the client.
+ *
+ * @param session The client session.
+ * @param id The correlation ID of the request, copied into the response.
+ * @param args args[0] = The user's username, args[1] = The opponent's username,
+ * args[2] = The time budget in milliseconds (empty for the default).
+ *
+ * @return int Returns 0 on success, or -1 on failure.
+ *
+ * @details The search runs on the analysis pool. Unless the result is cached, the request is
+ * added to pending_analyses and answered by analysis_poll when the search ends, while the
+ * server goes on with other requests. "false" is sent if the game is over or not found.
+ */
+int analyze(Session* session, uint32_t id, char args[MAX_ARGS][255]) {
+    Connection* conn = &session->conn;
+    printf("%d ANALYZE\n", conn->socket);
+
+    if (!analysis_pool) {
+        send_bool(conn, id, false);
+        return -1;
+    }
+
+    GameData gameData;
+    if (parse_json(&gameData, JSON_FILENAME)) {
+        fprintf(stderr, "%d Error: Failed to parse JSON\n", conn->socket);
+        send_bool(conn, id, false);
+        return -1;
+    }
+
+    int index = session_game(session, args[1]);
+    if (index < 0 || index >= gameData.game_count) {
+        fprintf(stderr, "%d Error: No game found for players %s and %s\n", conn->socket, args[0], args[1]);
+        send_bool(conn, id, false);
+        return -1;
+    }
+
+    int time_ms = args[2][0] ? convert_and_validate(args[2], 1, ANALYSIS_MAX_TIME_MS) : ANALYSIS_DEFAULT_TIME_MS;
+    int moves[6];
+    if (time_ms < 0 || list_moves(&gameData.games[index], moves) == 0) {
+        send_bool(conn, id, false);
+        return -1;
+    }
+
+    RepetitionRing history;
+    bool known = game_ring(index, &gameData.games[index], &gameData.histories[index], &history) == 0;
+
+    Analysis analysis;
+    int entry;
+    int result = analysis_submit(analysis_pool, &gameData.games[index], known ? &history : NULL, time_ms, &analysis, &entry);
+    if (result < 0) {
+        send_bool(conn, id, false);
+        return -1;
+    }
+    if (result == 1) {
+        return send_analysis(conn, id, &analysis);
+    }
+
+    PendingAnalysis* pending = malloc(sizeof(PendingAnalysis));
+    if (!pending) {
+        fprintf(stderr, "%d Error: Memory allocation failed\n", conn->socket);
+        analysis_cancel(analysis_pool, entry);
+        send_bool(conn, id, false);
+        return -1;
+    }
+    pending->session = session;
+    pending->id = id;
+    pending->index = entry;
+    pending->time_ms = time_ms;
+    pending->deadline = monotonic_ms() + time_ms + ANALYSIS_GRACE_MS;
+    pending->next = NULL;
+    PendingAnalysis** tail = &pending_analyses;  // Oldest first, so that smaller budgets are collected before a re-search
+    while (*tail) tail = &(*tail)->next;
+    *tail = pending;
+    session->analyses++;
+    return 0;
+}
+
+
+/**
+ * @brief Answers the pending ANALYZE requests whose search has ended or timed out.
+ *
+ * @return int Milliseconds until the next deadline, or -1 if nothing is pending.
+ */
+int analysis_poll() {
+    double now = monotonic_ms();
+    double next = -1;
+    PendingAnalysis** link = &pending_analyses;
+    while (*link) {
+        PendingAnalysis* pending = *link;
+        Session* session = pending->session;
+
+        Analysis analysis;
+        int result = analysis_collect(analysis_pool, &pending->index, pending->time_ms, &analysis);
+        if (result == 0 && now < pending->deadline) {
+            if (next < 0 || pending->deadline - now < next) next = pending->deadline - now;
+            link = &pending->next;
+            continue;
+        }
+
+        if (result == 0) {
+            fprintf(stderr, "%d Error: Analysis timed out\n", session->conn.socket);
+            analysis_cancel(analysis_pool, pending->index);
+        }
+        if (!session->closed) {
+            int error = result == 1 ? send_analysis(&session->conn, pending->id, &analysis)
+                                    : send_bool(&session->conn, pending->id, false);
+            if (error) session_fail(session);
+            mark_dirty(session);
+        }
+        session->analyses--;
+        *link = pending->next;
+        free(pending);
+    }
+    return next < 0 ? -1 : (int) next + 1;
+}
+
+
+// Gives up the pending analyses of a session that is closing
+void cancel_analyses(Session* session) {
+    PendingAnalysis** link = &pending_analyses;
+    while (*link) {
+        PendingAnalysis* pending = *link;
+        if (pending->session != session) {
+            link = &pending->next;
+            continue;
+        }
+        analysis_cancel(analysis_pool, pending->index);
+        *link = pending->next;
+        free(pending);
+    }
+    session->analyses = 0;
+}
+
+
 #endif //AWALEGAME_SERVER_H
@@ -0,0 +1,255 @@
+//
+// Endgame tablebase: exact win/draw/loss and distance for every position with few seeds left.
+// The file is written by awale_tablebase and mapped read-only by the server and the engine.
+//
+
+#ifndef AWALEGAME_TABLEBASE_H
+#define AWALEGAME_TABLEBASE_H
+
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "game.h"
+
+#define TABLEBASE_FILENAME "awale.tb"
+#define TB_MAGIC "AWTB"
+#define TB_VERSION 2
+#define TB_TOTAL_SEEDS 48
+// move_pebbles never sows into the pit just before the origin, so a pit holding 11 or more
+// loses seeds. Up to 10 seeds are conserved and the score of player1 follows from the board
+// and player0's score
+#define TB_LIMIT_SEEDS 10
+#define TB_DISTANCE_MASK 0x3FFF
+
+// Value of a position for the player to move
+typedef enum {
+    TB_DRAW,  // Also what unresolved positions are left at
+    TB_WIN,
+    TB_LOSS
+} TB_VALUE;
+
+typedef struct {
+    TB_VALUE value;
+    int distance;  // Plies to the end of the game with perfect play
+} TBResult;
+
+// File layout: this header followed by one uint16_t entry per position
+typedef struct {
+    char magic[4];
+    uint32_t version;
+    uint32_t max_seeds;
+    uint32_t reserved;
+    uint64_t layer_offset[TB_LIMIT_SEEDS + 2];  // First entry of each seed count, last one is the total
+} TablebaseHeader;
+
+typedef struct {
+    const uint16_t* entries;
+    void* map;
+    size_t map_size;
+    int max_seeds;
+    uint64_t layer_offset[TB_LIMIT_SEEDS + 2];
+    // skip[i][r][v]: number of boards that come before pit i holding v seeds when r are left for pits i to 11
+    uint32_t skip[BOARD_SIZE][TB_LIMIT_SEEDS + 1][TB_LIMIT_SEEDS + 2];
+} Tablebase;
+
+uint16_t tb_entry(TB_VALUE value, int distance) {
+    return (uint16_t) (value << 14 | (distance & TB_DISTANCE_MASK));
+}
+
+// Number of ways to spread sum seeds over parts pits
+uint64_t tb_boards(int parts, int sum) {
+    uint64_t result = 1;
+    for (int i = 1; i < parts; i++) {
+        result = result * (uint64_t) (sum + i) / (uint64_t) i;
+    }
+    return result;
+}
+
+// Score of player0 can be anything from 0 to all the captured seeds
+int tb_score_range(int seeds) {
+    return TB_TOTAL_SEEDS - seeds + 1;
+}
+
+// Fill the layer offsets and rank tables for a given number of seeds
+void tb_layout(Tablebase* tb, int max_seeds) {
+    tb->max_seeds = max_seeds;
+
+    uint64_t offset = 0;
+    for (int n = 0; n <= max_seeds; n++) {
+        tb->layer_offset[n] = offset;
+        offset += tb_boards(BOARD_SIZE, n) * tb_score_range(n) * 2;
+    }
+    for (int n = max_seeds + 1; n <= TB_LIMIT_SEEDS + 1; n++) {
+        tb->layer_offset[n] = offset;
+    }
+
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int r = 0; r <= TB_LIMIT_SEEDS; r++) {
+            uint32_t skipped = 0;
+            for (int v = 0; v <= TB_LIMIT_SEEDS + 1; v++) {
+                tb->skip[i][r][v] = skipped;
+                if (v <= r) {
+                    skipped += (uint32_t) tb_boards(BOARD_SIZE - 1 - i, r - v);
+                }
+            }
+        }
+    }
+}
+
+int tb_seeds_on_board(const Game* game) {
+    int seeds = 0;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        seeds += game->board[i];
+    }
+    return seeds;
+}
+
+// Rank of a board among all boards holding the same number of seeds
+uint64_t tb_rank(const Tablebase* tb, const int board[BOARD_SIZE], int seeds) {
+    uint64_t rank = 0;
+    int left = seeds;
+    for (int i = 0; i < BOARD_SIZE - 1; i++) {
+        rank += tb->skip[i][left][board[i]];
+        left -= board[i];
+    }
+    return rank;
+}
+
+// Inverse of tb_rank
+void tb_unrank(const Tablebase* tb, uint64_t rank, int seeds, int board[BOARD_SIZE]) {
+    int left = seeds;
+    for (int i = 0; i < BOARD_SIZE - 1; i++) {
+        int v = 0;
+        while (v < left && tb->skip[i][left][v + 1] <= rank) {
+            v++;
+        }
+        rank -= tb->skip[i][left][v];
+        board[i] = v;
+        left -= v;
+    }
+    board[BOARD_SIZE - 1] = left;
+}
+
+/**
+ * @brief Computes the entry index of a game.
+ *
+ * @return int64_t The index, or -1 if the game is not covered (too many seeds, game over or
+ * scores that do not add up to the seeds missing from the board).
+ */
+int64_t tb_index(const Tablebase* tb, const Game* game) {
+    if (game->current_state != MOVE_PLAYER_0 && game->current_state != MOVE_PLAYER_1) {
+        return -1;
+    }
+
+    int seeds = 0;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        if (game->board[i] < 0) return -1;
+        seeds += game->board[i];
+    }
+    if (seeds > tb->max_seeds ||
+        game->score.player0 < 0 || game->score.player1 < 0 ||
+        game->score.player0 + game->score.player1 + seeds != TB_TOTAL_SEEDS) {
+        return -1;
+    }
+
+    uint64_t rank = tb_rank(tb, game->board, seeds);
+    return (int64_t) (tb->layer_offset[seeds] + (rank * tb_score_range(seeds) + game->score.player0) * 2 + game->current_state);
+}
+
+// Rebuild the game stored at an index of a given layer
+void tb_game_at(const Tablebase* tb, int seeds, uint64_t index, Game* game) {
+    uint64_t local = index - tb->layer_offset[seeds];
+    game->current_state = (GAME_STATE) (local % 2);
+    local /= 2;
+    game->score.player0 = (int) (local % tb_score_range(seeds));
+    game->score.player1 = TB_TOTAL_SEEDS - seeds - game->score.player0;
+    tb_unrank(tb, local / tb_score_range(seeds), seeds, game->board);
+}
+
+/**
+ * @brief Maps a tablebase file in memory.
+ *
+ * @param tb The tablebase to initialise.
+ * @param filename Path of the file written by awale_tablebase.
+ *
+ * @return int Returns 0 on success, or -1 if the file is missing or invalid.
+ */
+int tb_open(Tablebase* tb, const char* filename) {
+    tb->entries = NULL;
+    tb->map = NULL;
+    tb->max_seeds = -1;
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(TablebaseHeader)) {
+        fprintf(stderr, "Error: Tablebase %s is too small\n", filename);
+        close(fd);
+        return -1;
+    }
+
+    void* map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        perror("Error mapping tablebase");
+        return -1;
+    }
+
+    const TablebaseHeader* header = map;
+    if (memcmp(header->magic, TB_MAGIC, 4) != 0 || header->version != TB_VERSION ||
+        header->max_seeds > TB_LIMIT_SEEDS) {
+        fprintf(stderr, "Error: %s is not a valid tablebase\n", filename);
+        munmap(map, st.st_size);
+        return -1;
+    }
+
+    tb_layout(tb, (int) header->max_seeds);
+    uint64_t total = tb->layer_offset[tb->max_seeds + 1];
+    if (memcmp(header->layer_offset, tb->layer_offset, sizeof(tb->layer_offset)) != 0 ||
+        (size_t) st.st_size != sizeof(TablebaseHeader) + total * sizeof(uint16_t)) {
+        fprintf(stderr, "Error: Tablebase %s does not match its header\n", filename);
+        munmap(map, st.st_size);
+        tb->max_seeds = -1;
+        return -1;
+    }
+
+    madvise(map, st.st_size, MADV_RANDOM);
+    tb->map = map;
+    tb->map_size = st.st_size;
+    tb->entries = (const uint16_t*) ((const char*) map + sizeof(TablebaseHeader));
+    return 0;
+}
+
+void tb_close(Tablebase* tb) {
+    if (tb->map) {
+        munmap(tb->map, tb->map_size);
+    }
+    tb->map = NULL;
+    tb->entries = NULL;
+    tb->max_seeds = -1;
+}
+
+// Look up a game, returns false if it is not covered by the tablebase
+bool tb_probe(const Tablebase* tb, const Game* game, TBResult* result) {
+    if (!tb || !tb->entries) {
+        return false;
+    }
+
+    int64_t index = tb_index(tb, game);
+    if (index < 0) {
+        return false;
+    }
+
+    uint16_t entry = tb->entries[index];
+    result->value = (TB_VALUE) (entry >> 14);
+    result->distance = entry & TB_DISTANCE_MASK;
+    return true;
+}
+
+#endif //AWALEGAME_TABLEBASE_H
@@ -0,0 +1,232 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "game.h"
+#include "tablebase.h"
+
+#define DEFAULT_MAX_SEEDS 8
+#define CHUNK_SIZE 4096
+
+// Shared state of the generator, one layer (number of seeds on the board) is solved at a time
+typedef struct {
+    Tablebase layout;
+    _Atomic uint16_t* entries;
+    int seeds;            // Layer being solved
+    int pass;             // Distance assigned during this pass
+    _Atomic uint64_t next;
+    _Atomic bool changed;
+    bool done;
+    pthread_barrier_t barrier;
+} Generator;
+
+/**
+ * @brief Tries to resolve one position during a pass.
+ *
+ * @details Only child values resolved in an earlier pass (distance below the pass number) are
+ * used, so the result does not depend on the order threads visit the layer in. A position is a win
+ * in d plies as soon as one child is a loss in d - 1, and a loss in d once every child is a win in
+ * at most d - 1. Positions never resolved are draws (the game loops forever).
+ */
+void solve_position(Generator* gen, Game* game, uint64_t index) {
+    if (atomic_load_explicit(&gen->entries[index], memory_order_relaxed) != 0) {
+        return;  // Already resolved
+    }
+
+    tb_game_at(&gen->layout, gen->seeds, index, game);
+
+    int moves[6];
+    int move_count = list_moves(game, moves);
+    if (move_count == 0) {
+        if (gen->pass == 0) {
+            atomic_store_explicit(&gen->entries[index], tb_entry(TB_LOSS, 0), memory_order_relaxed);
+            atomic_store_explicit(&gen->changed, true, memory_order_relaxed);
+        }
+        return;
+    }
+    if (gen->pass == 0) {
+        return;
+    }
+
+    bool all_win = true;
+    for (int i = 0; i < move_count; i++) {
+        Game child = *game;
+        if (play_turn(&child, moves[i])) {
+            if (gen->pass == 1) {
+                atomic_store_explicit(&gen->entries[index], tb_entry(TB_WIN, 1), memory_order_relaxed);
+                atomic_store_explicit(&gen->changed, true, memory_order_relaxed);
+                return;
+            }
+            all_win = false;
+            continue;
+        }
+
+        uint16_t entry = atomic_load_explicit(&gen->entries[tb_index(&gen->layout, &child)], memory_order_relaxed);
+        TB_VALUE value = (TB_VALUE) (entry >> 14);
+        int distance = entry & TB_DISTANCE_MASK;
+        bool known = entry != 0 && distance < gen->pass;
+
+        if (known && value == TB_LOSS && distance == gen->pass - 1) {
+            atomic_store_explicit(&gen->entries[index], tb_entry(TB_WIN, gen->pass), memory_order_relaxed);
+            atomic_store_explicit(&gen->changed, true, memory_order_relaxed);
+            return;
+        }
+        if (!known || value != TB_WIN) {
+            all_win = false;
+        }
+    }
+
+    if (all_win) {
+        atomic_store_explicit(&gen->entries[index], tb_entry(TB_LOSS, gen->pass), memory_order_relaxed);
+        atomic_store_explicit(&gen->changed, true, memory_order_relaxed);
+    }
+}
+
+void* generator_worker(void* arg) {
+    Generator* gen = arg;
+    Game game;
+    memset(&game, 0, sizeof(Game));
+
+    while (true) {
+        pthread_barrier_wait(&gen->barrier);  // Wait for the pass to be set up
+        if (gen->done) {
+            break;
+        }
+
+        uint64_t end = gen->layout.layer_offset[gen->seeds + 1];
+        uint64_t start;
+        while ((start = atomic_fetch_add(&gen->next, CHUNK_SIZE)) < end) {
+            uint64_t stop = start + CHUNK_SIZE < end ? start + CHUNK_SIZE : end;
+            for (uint64_t index = start; index < stop; index++) {
+                solve_position(gen, &game, index);
+            }
+        }
+
+        pthread_barrier_wait(&gen->barrier);  // Pass finished
+    }
+    return NULL;
+}
+
+// Write the header and entries to disk
+int write_tablebase(const Generator* gen, const char* filename) {
+    FILE* file = fopen(filename, "wb");
+    if (!file) {
+        perror("Error opening tablebase file");
+        return -1;
+    }
+
+    TablebaseHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TB_MAGIC, 4);
+    header.version = TB_VERSION;
+    header.max_seeds = gen->layout.max_seeds;
+    memcpy(header.layer_offset, gen->layout.layer_offset, sizeof(header.layer_offset));
+    fwrite(&header, sizeof(header), 1, file);
+
+    uint16_t buffer[CHUNK_SIZE];
+    uint64_t total = gen->layout.layer_offset[gen->layout.max_seeds + 1];
+    for (uint64_t start = 0; start < total; start += CHUNK_SIZE) {
+        size_t count = total - start < CHUNK_SIZE ? total - start : CHUNK_SIZE;
+        for (size_t i = 0; i < count; i++) {
+            buffer[i] = atomic_load_explicit(&gen->entries[start + i], memory_order_relaxed);
+        }
+        if (fwrite(buffer, sizeof(uint16_t), count, file) != count) {
+            perror("Error writing tablebase");
+            fclose(file);
+            return -1;
+        }
+    }
+
+    fclose(file);
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int max_seeds = argc > 1 ? atoi(argv[1]) : DEFAULT_MAX_SEEDS;
+    const char* filename = argc > 2 ? argv[2] : TABLEBASE_FILENAME;
+    long threads = argc > 3 ? atol(argv[3]) : sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (max_seeds < 0 || max_seeds > TB_LIMIT_SEEDS || threads < 1) {
+        printf("Usage: awale_tablebase [max_seeds (0-%d)] [output] [threads]\n", TB_LIMIT_SEEDS);
+        exit(0);
+    }
+
+    Generator* gen = malloc(sizeof(Generator));
+    if (!gen) {
+        fprintf(stderr, "Error: Memory allocation failed\n");
+        return 1;
+    }
+    tb_layout(&gen->layout, max_seeds);
+
+    uint64_t total = gen->layout.layer_offset[max_seeds + 1];
+    gen->entries = calloc(total, sizeof(_Atomic uint16_t));
+    if (!gen->entries) {
+        fprintf(stderr, "Error: Could not allocate %llu entries\n", (unsigned long long) total);
+        return 1;
+    }
+
+    printf("Generating tablebase up to %d seeds (%llu positions) with %ld threads\n",
+           max_seeds, (unsigned long long) total, threads);
+
+    gen->done = false;
+    pthread_barrier_init(&gen->barrier, NULL, threads + 1);
+    pthread_t* workers = malloc(sizeof(pthread_t) * threads);
+    for (long i = 0; i < threads; i++) {
+        pthread_create(&workers[i], NULL, generator_worker, gen);
+    }
+
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    int max_distance = 0;
+
+    for (int n = 0; n <= max_seeds; n++) {
+        gen->seeds = n;
+
+        // Keep going while positions resolve, and until every distance of smaller layers has been used
+        for (int pass = 0; ; pass++) {
+            gen->pass = pass;
+            atomic_store(&gen->next, gen->layout.layer_offset[n]);
+            atomic_store(&gen->changed, false);
+
+            pthread_barrier_wait(&gen->barrier);
+            pthread_barrier_wait(&gen->barrier);
+
+            if (atomic_load(&gen->changed)) {
+                max_distance = pass > max_distance ? pass : max_distance;
+            } else if (pass > max_distance) {
+                break;
+            }
+        }
+
+        uint64_t counts[3] = {0, 0, 0};
+        for (uint64_t i = gen->layout.layer_offset[n]; i < gen->layout.layer_offset[n + 1]; i++) {
+            counts[atomic_load_explicit(&gen->entries[i], memory_order_relaxed) >> 14]++;
+        }
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        printf("%2d seeds: %10llu wins %10llu draws %10llu losses, longest %d plies (%.1f s)\n", n,
+               (unsigned long long) counts[TB_WIN], (unsigned long long) counts[TB_DRAW],
+               (unsigned long long) counts[TB_LOSS], max_distance,
+               (double) (now.tv_sec - start.tv_sec) + (double) (now.tv_nsec - start.tv_nsec) / 1e9);
+    }
+
+    gen->done = true;
+    pthread_barrier_wait(&gen->barrier);
+    for (long i = 0; i < threads; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    int status = write_tablebase(gen, filename);
+    if (status == 0) {
+        printf("Written to %s\n", filename);
+    }
+
+    pthread_barrier_destroy(&gen->barrier);
+    free(workers);
+    free(gen->entries);
+    free(gen);
+    return status ? 1 : 0;
+}
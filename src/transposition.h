@@ -0,0 +1,192 @@
+//
+// Fixed size, lock-free transposition table for the engine.
+// Entries are stored as (hash ^ data, data) pairs so that a torn write from
+// another thread is detected on probe instead of needing a lock.
+//
+
+#ifndef AWALEGAME_TRANSPOSITION_H
+#define AWALEGAME_TRANSPOSITION_H
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+
+#define TT_CLUSTER_SIZE 4  // 4 entries of 16 bytes = one 64-byte cache line
+#define TT_NO_MOVE 15
+
+typedef enum {
+    BOUND_NONE,
+    BOUND_UPPER,  // Score is at most the stored value (fail low)
+    BOUND_LOWER,  // Score is at least the stored value (fail high)
+    BOUND_EXACT
+} BOUND;
+
+typedef struct {
+    _Atomic uint64_t key;   // hash ^ data
+    _Atomic uint64_t data;  // Packed score, depth, bound, move and generation
+} TTEntry;
+
+typedef struct {
+    _Alignas(64) TTEntry entries[TT_CLUSTER_SIZE];
+} TTCluster;
+
+typedef struct {
+    TTCluster* clusters;
+    uint64_t mask;       // Number of clusters - 1
+    size_t bytes;        // Size of the mapping
+    uint8_t generation;  // Bumped for every new search, used to age out old entries
+    bool huge_pages;     // Whether the mapping ended up on huge pages
+} TransTable;
+
+// Unpacked content of an entry
+typedef struct {
+    int score;
+    int depth;
+    BOUND bound;
+    int move;
+} TTHit;
+
+uint64_t tt_pack(int score, int depth, BOUND bound, int move, uint8_t generation) {
+    return (uint64_t) (uint16_t) (int16_t) score
+           | (uint64_t) (uint8_t) depth << 16
+           | (uint64_t) bound << 24
+           | (uint64_t) (move & 0xF) << 26
+           | (uint64_t) generation << 32;
+}
+
+int tt_data_depth(uint64_t data) { return (int) ((data >> 16) & 0xFF); }
+uint8_t tt_data_generation(uint64_t data) { return (uint8_t) (data >> 32); }
+
+/**
+ * @brief Allocates a table of roughly the given size, rounded down to a power of two clusters.
+ *
+ * @param tt The table to initialise.
+ * @param megabytes Requested size in MiB (at least one cluster is always allocated).
+ * @param huge_pages Try to back the table with huge pages (explicit first, then transparent).
+ *
+ * @return int Returns 0 on success, or -1 if the memory could not be mapped.
+ */
+int tt_init(TransTable* tt, size_t megabytes, bool huge_pages) {
+    size_t clusters = 1;
+    while (clusters * 2 * sizeof(TTCluster) <= megabytes * 1024 * 1024) {
+        clusters *= 2;
+    }
+
+    tt->bytes = clusters * sizeof(TTCluster);
+    tt->mask = clusters - 1;
+    tt->generation = 0;
+    tt->huge_pages = false;
+    tt->clusters = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+    if (huge_pages && tt->bytes >= 2 * 1024 * 1024) {
+        tt->clusters = mmap(NULL, tt->bytes, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        tt->huge_pages = tt->clusters != MAP_FAILED;
+    }
+#endif
+
+    // Anonymous mappings are page aligned (so cache-line aligned) and already zeroed
+    if (tt->clusters == MAP_FAILED) {
+        tt->clusters = mmap(NULL, tt->bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+    if (tt->clusters == MAP_FAILED) {
+        perror("Error allocating transposition table");
+        tt->clusters = NULL;
+        return -1;
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (huge_pages && !tt->huge_pages) {
+        tt->huge_pages = madvise(tt->clusters, tt->bytes, MADV_HUGEPAGE) == 0;
+    }
+#endif
+
+    return 0;
+}
+
+void tt_free(TransTable* tt) {
+    if (tt->clusters) {
+        munmap(tt->clusters, tt->bytes);
+        tt->clusters = NULL;
+    }
+}
+
+// Wipe every entry, not thread safe
+void tt_clear(TransTable* tt) {
+    memset(tt->clusters, 0, tt->bytes);
+    tt->generation = 0;
+}
+
+// Mark the start of a new search so entries from older ones get replaced first
+void tt_new_search(TransTable* tt) {
+    tt->generation++;
+}
+
+// Look up a position, returns true and fills hit if a valid entry is found
+bool tt_probe(const TransTable* tt, uint64_t hash, TTHit* hit) {
+    TTCluster* cluster = &tt->clusters[hash & tt->mask];
+
+    for (int i = 0; i < TT_CLUSTER_SIZE; i++) {
+        uint64_t key = atomic_load_explicit(&cluster->entries[i].key, memory_order_relaxed);
+        uint64_t data = atomic_load_explicit(&cluster->entries[i].data, memory_order_relaxed);
+
+        if ((key ^ data) == hash && data != 0) {
+            hit->score = (int16_t) (data & 0xFFFF);
+            hit->depth = tt_data_depth(data);
+            hit->bound = (BOUND) ((data >> 24) & 0x3);
+            hit->move = (int) ((data >> 26) & 0xF);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Stores a search result, preferring to keep the deepest and most recent entries.
+ *
+ * @details Within the cluster an entry for the same position is overwritten unless it holds a
+ * deeper result from this search. Otherwise the entry with the lowest depth, minus a penalty for
+ * each search it has survived, is replaced.
+ */
+void tt_store(TransTable* tt, uint64_t hash, int depth, BOUND bound, int score, int move) {
+    TTCluster* cluster = &tt->clusters[hash & tt->mask];
+    TTEntry* replace = NULL;
+    int replace_worth = 0;
+
+    for (int i = 0; i < TT_CLUSTER_SIZE; i++) {
+        TTEntry* entry = &cluster->entries[i];
+        uint64_t key = atomic_load_explicit(&entry->key, memory_order_relaxed);
+        uint64_t data = atomic_load_explicit(&entry->data, memory_order_relaxed);
+
+        if (data == 0) {
+            replace = entry;
+            break;
+        }
+
+        if ((key ^ data) == hash) {
+            if (bound != BOUND_EXACT && tt_data_generation(data) == tt->generation && tt_data_depth(data) > depth) {
+                return;
+            }
+            // Keep the old best move if this result has none
+            if (move == TT_NO_MOVE) {
+                move = (int) ((data >> 26) & 0xF);
+            }
+            replace = entry;
+            break;
+        }
+
+        int age = (uint8_t) (tt->generation - tt_data_generation(data));
+        int worth = tt_data_depth(data) - 8 * age;
+        if (replace == NULL || worth < replace_worth) {
+            replace = entry;
+            replace_worth = worth;
+        }
+    }
+
+    uint64_t data = tt_pack(score, depth, bound, move, tt->generation);
+    atomic_store_explicit(&replace->key, hash ^ data, memory_order_relaxed);
+    atomic_store_explicit(&replace->data, data, memory_order_relaxed);
+}
+
+#endif //AWALEGAME_TRANSPOSITION_H
@@ -98,8 +98,8 @@ int convert_and_validate(const char *str, const int min, const int max) {
     return (int) result;  // Return the converted value as an integer
 }
 
-// Convert a given game object to a json string
-char* game_to_json_string(const Game* game) {
+// Convert a given game object to a JSON object, to be deleted
+cJSON* game_to_json(const Game* game) {
     // Create the JSON object for the game
     cJSON *game_json = cJSON_CreateObject();
 
@@ -122,10 +122,52 @@ char* game_to_json_string(const Game* game) {
         cJSON_AddItemToArray(board_json, cJSON_CreateNumber(game->board[i]));
     }
     cJSON_AddItemToObject(game_json, "board", board_json);
+    cJSON_AddNumberToObject(game_json, "version", game->version);
+    return game_json;
+}
+
+// Convert a given game object to a json string
+char* game_to_json_string(const Game* game) {
+    cJSON* game_json = game_to_json(game);
 
     // Convert the JSON object to a string
-    char* json = cJSON_Print(game_json);  // Converts to string, requires free()
+    char* json = cJSON_PrintUnformatted(game_json);  // Converts to string, requires free()
     cJSON_Delete(game_json);  // Free JSON object
 
     return json;
 }
+
+// Convert a list of games to a json string, an array of the objects of game_to_json
+char* games_to_json_string(const Game* const* games, int count) {
+    cJSON* games_json = cJSON_CreateArray();
+    for (int i = 0; i < count; i++) {
+        cJSON_AddItemToArray(games_json, game_to_json(games[i]));
+    }
+    char* json = cJSON_PrintUnformatted(games_json);
+    cJSON_Delete(games_json);
+    return json;
+}
+
+// Convert the changes of a move to a json string, the changed pits as index and seeds pairs
+char* delta_to_json_string(const GameDelta* delta) {
+    cJSON *delta_json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(delta_json, "version", delta->version);
+    cJSON_AddNumberToObject(delta_json, "move", delta->move);
+
+    cJSON *pits_json = cJSON_AddArrayToObject(delta_json, "pits");
+    for (int i = 0; i < delta->count; i++) {
+        cJSON_AddItemToArray(pits_json, cJSON_CreateNumber(delta->pits[i]));
+        cJSON_AddItemToArray(pits_json, cJSON_CreateNumber(delta->seeds[i]));
+    }
+    cJSON_AddNumberToObject(delta_json, "captured", delta->captured);
+
+    cJSON *score_json = cJSON_CreateObject();
+    cJSON_AddNumberToObject(score_json, "player0", delta->score.player0);
+    cJSON_AddNumberToObject(score_json, "player1", delta->score.player1);
+    cJSON_AddItemToObject(delta_json, "score", score_json);
+    cJSON_AddNumberToObject(delta_json, "currentState", delta->state);
+
+    char* json = cJSON_PrintUnformatted(delta_json);
+    cJSON_Delete(delta_json);
+    return json;
+}
@@ -0,0 +1,77 @@
+//
+// Zobrist hashing of Awale positions.
+// To be used by the engine and by anything that needs to recognise a position
+//
+
+#ifndef AWALEGAME_ZOBRIST_H
+#define AWALEGAME_ZOBRIST_H
+
+#include <stdint.h>
+
+#include "game.h"
+
+// A pit can never hold more than the 48 seeds in play, same for a score
+#define ZOBRIST_MAX_SEEDS 48
+#define ZOBRIST_SEED 0x41574C45u  // "AWLE", keys must be the same on every run
+
+typedef struct {
+    uint64_t pits[BOARD_SIZE][ZOBRIST_MAX_SEEDS + 1];
+    uint64_t state[5];  // One key per GAME_STATE
+    uint64_t score0[ZOBRIST_MAX_SEEDS + 1];
+    uint64_t score1[ZOBRIST_MAX_SEEDS + 1];
+} ZobristKeys;
+
+ZobristKeys zobrist_keys;
+bool zobrist_ready = false;
+
+// splitmix64 step, gives well spread keys from a fixed seed
+uint64_t zobrist_next(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Fill the key tables, must be called once before any thread starts hashing
+void init_zobrist() {
+    if (zobrist_ready) return;
+
+    uint64_t state = ZOBRIST_SEED;
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        for (int s = 0; s <= ZOBRIST_MAX_SEEDS; s++) {
+            // An empty pit contributes nothing so that sowing only touches the pits it changes
+            zobrist_keys.pits[i][s] = s == 0 ? 0 : zobrist_next(&state);
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        zobrist_keys.state[i] = zobrist_next(&state);
+    }
+    for (int s = 0; s <= ZOBRIST_MAX_SEEDS; s++) {
+        zobrist_keys.score0[s] = zobrist_next(&state);
+        zobrist_keys.score1[s] = zobrist_next(&state);
+    }
+    // Drawn, drawn last so that the other keys (and the opening book) do not change
+    zobrist_keys.state[DRAW] = zobrist_next(&state);
+
+    zobrist_ready = true;
+}
+
+// Clamp a seed count into the key table (only reachable with a corrupted game)
+int zobrist_clamp(int seeds) {
+    if (seeds < 0) return 0;
+    if (seeds > ZOBRIST_MAX_SEEDS) return ZOBRIST_MAX_SEEDS;
+    return seeds;
+}
+
+// Hash the board, side to move and scores of a game (player names are ignored)
+uint64_t hash_game(const Game* game) {
+    uint64_t hash = zobrist_keys.state[(unsigned) game->current_state <= DRAW ? game->current_state : DRAW];
+    for (int i = 0; i < BOARD_SIZE; i++) {
+        hash ^= zobrist_keys.pits[i][zobrist_clamp(game->board[i])];
+    }
+    hash ^= zobrist_keys.score0[zobrist_clamp(game->score.player0)];
+    hash ^= zobrist_keys.score1[zobrist_clamp(game->score.player1)];
+    return hash;
+}
+
+#endif //AWALEGAME_ZOBRIST_H